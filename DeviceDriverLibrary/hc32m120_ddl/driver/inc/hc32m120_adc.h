@@ -10,6 +10,9 @@
    2020-01-08       Wuze            1. Modified the type of 'u32Event0' in structure stc_adc_trg_cfg_t,
                                        from 'uint32 enEvent0' to 'en_event_src_t enEvent0'. Same with 'u32Event1'.
                                     2. Modified the definitions of @ref ADC_Trigger_Source_Type
+   2026-10-19       Wuze            Add ADC_DelAdcChannel()
+   2026-10-19       Wuze            Add channel read plan ADC_ReadPlanInit()/ADC_ReadPlanExec()
+                                    and ADC_READ_CONST_CH()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -110,6 +113,18 @@ typedef struct
                                      This parameter can be a value of @ref ADC_Restart_From */
 } stc_adc_init_t;
 
+/**
+ * @brief Structure definition of ADC channel read plan.
+ * @note  Built once from a channel mask by ADC_ReadPlanInit(), then ADC_ReadPlanExec()
+ *        reads only the data registers of the channels without scanning the mask.
+ */
+typedef struct
+{
+    uint8_t u8Num;              /*!< Number of channels in the plan. */
+    uint8_t au8DrIdx[12u];      /*!< Data register index(ADC pin) of each channel, ascending.
+                                     Size is @ref ADC_Channel_Count */
+} stc_adc_read_plan_t;
+
 /**
  * @brief Structure definition of ADC trigger source configuration.
  */
@@ -354,6 +369,33 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup ADC_Read_Const_Channel ADC Read Constant Channels
+ * @brief Read the data registers of a constant channel mask in ascending order. The
+ *        conditions are resolved by the compiler, only the loads of the channels remain.
+ * @{
+ */
+#define ADC_READ_CONST_CH(u16Ch, pu16Dest)                                     \
+do {                                                                           \
+    uint16_t *pu16RdDest = (pu16Dest);                                         \
+    if (((u16Ch) & ADC_CH0)  != 0u) { *pu16RdDest++ = M0P_ADC->DR0;  }         \
+    if (((u16Ch) & ADC_CH1)  != 0u) { *pu16RdDest++ = M0P_ADC->DR1;  }         \
+    if (((u16Ch) & ADC_CH2)  != 0u) { *pu16RdDest++ = M0P_ADC->DR2;  }         \
+    if (((u16Ch) & ADC_CH3)  != 0u) { *pu16RdDest++ = M0P_ADC->DR3;  }         \
+    if (((u16Ch) & ADC_CH4)  != 0u) { *pu16RdDest++ = M0P_ADC->DR4;  }         \
+    if (((u16Ch) & ADC_CH5)  != 0u) { *pu16RdDest++ = M0P_ADC->DR5;  }         \
+    if (((u16Ch) & ADC_CH6)  != 0u) { *pu16RdDest++ = M0P_ADC->DR6;  }         \
+    if (((u16Ch) & ADC_CH7)  != 0u) { *pu16RdDest++ = M0P_ADC->DR7;  }         \
+    if (((u16Ch) & ADC_CH8)  != 0u) { *pu16RdDest++ = M0P_ADC->DR8;  }         \
+    if (((u16Ch) & ADC_CH9)  != 0u) { *pu16RdDest++ = M0P_ADC->DR9;  }         \
+    if (((u16Ch) & ADC_CH10) != 0u) { *pu16RdDest++ = M0P_ADC->DR10; }         \
+    if (((u16Ch) & ADC_CH11) != 0u) { *pu16RdDest++ = M0P_ADC->DR11; }         \
+    (void)pu16RdDest;                                                          \
+} while (0)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -407,6 +449,7 @@ en_result_t ADC_Init(const stc_adc_init_t *pstcInit);
 void ADC_DeInit(void);
 en_result_t ADC_StructInit(stc_adc_init_t *pstcInit);
 void ADC_AddAdcChannel(uint8_t u8Seq, uint16_t u16Channel);
+void ADC_DelAdcChannel(uint8_t u8Seq, uint16_t u16Channel);
 void ADC_SetExChannel(uint8_t u8ExCh);
 en_result_t ADC_ConfigTriggerSrc(uint8_t u8Seq, const stc_adc_trg_cfg_t *pstcTrgCfg);
 en_result_t ADC_TriggerSrcStructInit(stc_adc_trg_cfg_t *pstcTrgCfg);
@@ -419,6 +462,8 @@ void ADC_ClrEocFlag(uint8_t u8Flag);
 en_result_t ADC_PollingSa(uint16_t *pu16Dest, uint8_t u8Length, uint32_t u32Timeout);
 en_result_t ADC_GetAllData(uint16_t *pu16Dest, uint8_t u8Length);
 en_result_t ADC_GetChannelData(uint16_t u16Channel, uint16_t *pu16Dest, uint8_t u8Length);
+en_result_t ADC_ReadPlanInit(stc_adc_read_plan_t *pstcPlan, uint16_t u16Channel);
+void ADC_ReadPlanExec(const stc_adc_read_plan_t *pstcPlan, uint16_t *pu16Dest);
 uint16_t ADC_GetValue(uint8_t u8AdcPin);
 
 en_result_t ADC_AwdConfig(uint8_t u8AwdNbr, const stc_awd_cfg_t *pstcAwdCfg);
@@ -9,6 +9,8 @@
    2019-06-24       Chengy          First version
    2020-02-28       Chengy          Modified CLK_REG_WRITE_ENABLE/DISABLE 
                                     #Elimate impact on other bits
+   2026-10-19       Chengy          Add func. CLK_SysclkStrucInit()/CLK_SysclkConfig()
+                                    and CLK_GetEfmLatency()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -126,6 +128,21 @@ typedef struct
                                 This parameter can be a value of @ref CLK_XTALSTD_Config    */
 } stc_clk_xtalstd_init_t;
 
+/**
+ * @brief  CLK system clock configuration structure definition
+ */
+typedef struct
+{
+    uint8_t u8SysclkSrc;      /*!< Specifies the system clock source.
+                                This parameter can be a value of @ref CLK_System_Clock_Source   */
+
+    uint8_t u8HrcFreq;        /*!< Specifies the HRC frequency, only valid while u8SysclkSrc is CLK_SYSCLKSOURCE_HRC.
+                                This parameter can be a value of @ref CLK_HRCFreq_Sel           */
+
+    uint8_t u8SysclkDiv;      /*!< Specifies the system clock divider.
+                                This parameter can be a value of @ref CLK_System_Clock_Divider  */
+} stc_clk_sysclk_cfg_t;
+
 /**
  * @}
  */
@@ -294,6 +311,17 @@ typedef struct
  * @}
  */
 
+/**
+ * @defgroup CLK_EFM_Latency_Frequency EFM latency frequency
+ * @brief Maximum HCLK frequency for each EFM read latency.
+ * @{
+ */
+#define CLK_EFM_LATENCY0_MAX_FREQ   (24000000ul)   /*!< HCLK <= 24MHz: EFM 0 wait cycle.  */
+#define CLK_EFM_LATENCY1_MAX_FREQ   (48000000ul)   /*!< HCLK <= 48MHz: EFM 1 wait cycle.  */
+/**
+ * @}
+ */
+
 /**
  * @defgroup CLK_HCLK_Divider HCLK divider
  * @{
@@ -409,6 +437,9 @@ en_flag_status_t CLK_GetXtalStdFlag(void);
 
 void CLK_SetSysclkSrc(uint8_t u8Src);
 void CLK_SetSysclkDiv(uint8_t u8Div);
+en_result_t CLK_SysclkStrucInit(stc_clk_sysclk_cfg_t* pstcSysclk);
+en_result_t CLK_SysclkConfig(const stc_clk_sysclk_cfg_t* pstcSysclk);
+uint32_t CLK_GetEfmLatency(uint32_t u32Hclk);
 void CLK_SetADClkDiv(uint8_t u8Div);
 
 void CLK_FcgPeriphClockCmd(uint32_t u32FcgPeriph, en_functional_state_t enNewState);
@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2019-06-19       Heqb            First version
+   2026-10-19       Heqb            Add streaming API CRC_Start/CRC_Update/CRC_Finish
+                                    and CRC_SaveContext/CRC_RestoreContext
+   2026-10-19       Heqb            Add DMA fed calculation CRC_CalculateDMA
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -64,6 +67,10 @@ extern "C"
  ******************************************************************************/
 #include "hc32_common.h"
 #include "ddl_config.h"
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+#include "hc32m120_dma.h"
+#include "hc32m120_interrupts.h"
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
 
 /**
  * @addtogroup HC32M120_DDL_Driver
@@ -80,6 +87,50 @@ extern "C"
 /*******************************************************************************
  * Global type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup CRC_Global_Types CRC Global Types
+ * @{
+ */
+
+/**
+ * @brief CRC stream context structure definition
+ */
+typedef struct
+{
+    uint32_t u32CrcProtocol;        /*!< CRC protocol of the stream.
+                                         This parameter can be a value of @ref CRC_Protocol_Control_Bit */
+    uint32_t u32CrcState;           /*!< CRC accumulator of the stream. It can be used as the initial value
+                                         to continue the calculation. */
+} stc_crc_context_t;
+
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+/**
+ * @brief CRC DMA calculation complete callback, the parameter is the CRC checksum.
+ */
+typedef void (*func_ptr_crc_cb_t)(uint32_t u32CheckSum);
+
+/**
+ * @brief CRC DMA calculation configuration structure definition
+ */
+typedef struct
+{
+    uint8_t  u8DmaCh;                       /*!< DMA channel which feeds the CRC data register.
+                                                 This parameter can be DMA_CHANNEL_0 or DMA_CHANNEL_1. */
+    uint32_t u32CrcProtocol;                /*!< CRC protocol.
+                                                 This parameter can be a value of @ref CRC_Protocol_Control_Bit */
+    uint32_t u32InitVal;                    /*!< Initialize the CRC calculation. */
+    uint32_t u32SrcAddr;                    /*!< Start address of the memory region(flash or RAM). */
+    uint32_t u32Length;                     /*!< Length of the memory region in bytes. */
+    stc_dma_llp_descriptor_t *pstcLlpDesc;  /*!< Descriptor pool in SRAM for the blocks after the first one,
+                                                 can be NULL if the region fits in one block. */
+    uint32_t u32LlpDescNum;                 /*!< Number of descriptors in the pool. */
+    func_ptr_crc_cb_t pfnCallback;          /*!< Called from CRC_DmaIrqHandler() with the checksum, can be NULL. */
+} stc_crc_dma_cfg_t;
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
@@ -125,6 +176,20 @@ extern "C"
  * @}
  */
 
+/**
+ * @defgroup CRC_DMA_Block CRC DMA Block
+ * @brief The region is transferred as 8/16/32-bit units according to the alignment of
+ *        address and length, each DMA block holds up to CRC_DMA_BLKSIZE_MAX units.
+ * @{
+ */
+#define CRC_DMA_BLKSIZE_MAX             (255ul)
+
+/* Number of LLP descriptors needed for u32Units transfer units. */
+#define CRC_DMA_LLP_DESC_NUM(u32Units)  ((((u32Units) + CRC_DMA_BLKSIZE_MAX - 1ul) / CRC_DMA_BLKSIZE_MAX) - 1ul)
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -152,6 +217,19 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
                            uint32_t u32InitVal,
                            uint32_t u32Length,
                            uint8_t u8BitWidth);
+
+void CRC_Start(uint32_t u32CrcProtocol, uint32_t u32InitVal);
+en_result_t CRC_Update(const void *pvData, uint32_t u32Length, uint8_t u8BitWidth);
+uint32_t CRC_Finish(void);
+
+en_result_t CRC_SaveContext(stc_crc_context_t *pstcContext);
+en_result_t CRC_RestoreContext(const stc_crc_context_t *pstcContext);
+
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+en_result_t CRC_CalculateDMA(const stc_crc_dma_cfg_t *pstcCfg);
+en_result_t CRC_GetDmaResult(uint32_t *pu32CheckSum);
+void CRC_DmaIrqHandler(void);
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
 /**
  * @}
  */
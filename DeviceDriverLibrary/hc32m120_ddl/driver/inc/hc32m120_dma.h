@@ -8,6 +8,7 @@
    Date             Author          Notes
    2019-07-08       Chengy          First version
    2020-02-13       Chengy          Fixed spelling error and format in comment
+   2026-10-19       Chengy          Add func. DMA_LlpCmd()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -298,6 +299,7 @@ void DMA_ChannelCfg(uint8_t u8Ch, const stc_dma_ch_cfg_t* pstcChCfg);
 void DMA_RepeatInit(uint8_t u8Ch, uint32_t u32RptSel, uint32_t u32Cnt);
 void DMA_NonSeqInit(uint8_t u8Ch, uint32_t u32NSeqSel, uint32_t u32Offset, uint32_t u32Cnt);
 void DMA_LlpInit(uint8_t u8Ch, uint32_t u32LlpRun, uint32_t u32Llp);
+void DMA_LlpCmd(uint8_t u8Ch, en_functional_state_t enNewState);
 
 void DMA_SetSrcAddress(uint8_t u8Ch, uint32_t u32Address);
 void DMA_SetDesAddress(uint8_t u8Ch, uint32_t u32Address);
@@ -8,6 +8,7 @@
    Date             Author          Notes
    2019-06-20       Heqb          First version
    2019-12-11       Heqb          Add timeout function for register write
+   2026-10-19       Heqb          Add deferred register write in asynchronous mode
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -170,6 +171,15 @@ typedef struct
 #define TIMER0_BT_HWTRG_FUNC_STOP   (TMR0_BCONR_HSTPA)
 #define TIMER0_BT_HWTRG_FUNC_NONE   (0x00000000ul)
 
+/**
+ * @}
+ */
+
+/** @defgroup TIMER0_Async_Write_Mode_define TIMER0 asynchronous write mode define
+ * @{
+ */
+#define TIMER0_ASYNC_WRITE_WAIT     (0x00u)     /*!< Wait until the write is synchronized to the LRC clock domain */
+#define TIMER0_ASYNC_WRITE_DEFER    (0x01u)     /*!< Return after the write, check it by TIMER0_AsyncWriteStatus() */
 /**
  * @}
  */
@@ -206,6 +216,10 @@ en_result_t TIMER0_WriteCmpReg(uint16_t u16Cnt);
 
 void TIMER0_SetTriggerSrc(en_event_src_t enEvent);
 
+void TIMER0_SetAsyncWriteMode(uint8_t u8Mode);
+en_result_t TIMER0_AsyncWriteStatus(void);
+en_result_t TIMER0_AsyncWaitDone(void);
+
 /**
  * @}
  */
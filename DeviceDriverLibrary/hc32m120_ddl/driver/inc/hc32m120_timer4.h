@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2019-06-24       Hongjh          First version
+   2026-10-19       Hongjh          Fix TIMER4_OCO_OP_LOW value
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -541,7 +542,7 @@ typedef struct
  */
 #define TIMER4_OCO_OP_HOLD                      ((uint16_t)0x0000u)                           /*!< Hold output when the TIMER4 OCO count match */
 #define TIMER4_OCO_OP_HIGH                      (TMR4_OCMRH_OPDCH_0 >> TMR4_OCMRH_OPDCH_POS)  /*!< Output high when the TIMER4 OCO count match */
-#define TIMER4_OCO_OP_LOW                       (TMR4_OCMRH_OPDCH_0 >> TMR4_OCMRH_OPDCH_POS)  /*!< Output low when the TIMER4 OCO count match */
+#define TIMER4_OCO_OP_LOW                       (TMR4_OCMRH_OPDCH_1 >> TMR4_OCMRH_OPDCH_POS)  /*!< Output low when the TIMER4 OCO count match */
 #define TIMER4_OCO_OP_INVERT                    (TMR4_OCMRH_OPDCH >> TMR4_OCMRH_OPDCH_POS)    /*!< Invert output when the TIMER4 OCO count match */
 /**
  * @}
@@ -6,6 +6,9 @@
    Change Logs:
    Date             Author          Notes
    2019-06-28       Yangjp          First version
+   2026-10-19       Yangjp          Added function SysTick_AddTick
+   2026-10-19       Yangjp          Added functions DDL_LrcSyncDelay and DDL_LrcSyncElapsed
+   2026-10-19       Yangjp          Added function DDL_LrcSyncCntElapsed
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -99,10 +102,16 @@ extern "C"
 /* Imprecise delay */
 void DDL_Delay1ms(uint32_t u32Cnt);
 
+/* Synchronization of a write to a timer clocked by LRC */
+void DDL_LrcSyncDelay(void);
+en_flag_status_t DDL_LrcSyncCntElapsed(uint16_t u16WriteCnt, uint16_t u16Cnt, uint32_t u32DivShift);
+en_flag_status_t DDL_LrcSyncElapsed(uint32_t u32WriteTick);
+
 /* Systick functions */
 en_result_t SysTick_Init(uint32_t u32Freq);
 void SysTick_Delay(uint32_t u32Delay);
 void SysTick_IncTick(void);
+void SysTick_AddTick(uint32_t u32Tick);
 uint32_t SysTick_GetTick(void);
 void SysTick_Suspend(void);
 void SysTick_Resume(void);
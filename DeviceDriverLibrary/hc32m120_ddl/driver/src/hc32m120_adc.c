@@ -9,6 +9,8 @@
    2019-06-09       Wuze            First version
    2020-01-08       Wuze            Modified the type of 'u32Event0' in structure stc_adc_trg_cfg_t,
                                     from 'uint32 enEvent0' to 'en_event_src_t enEvent0'. Same with 'u32Event1'.
+   2026-10-19       Wuze            Add ADC_DelAdcChannel()
+   2026-10-19       Wuze            Add channel read plan ADC_ReadPlanInit()/ADC_ReadPlanExec()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -420,6 +422,36 @@ void ADC_AddAdcChannel(uint8_t u8Seq, uint16_t u16Channel)
     }
 }
 
+/**
+ * @brief  ADC delete ADC channel(s).
+ * @param  [in]  u8Seq              The specified sequence for the channel(s) to be deleted from.
+ *                                  This parameter can be a value of @ref ADC_Sequence
+ *   @arg  ADC_SEQ_A:               Delete channels from sequence A.
+ *   @arg  ADC_SEQ_B:               Delete channels from sequence B.
+ * @param  [in]  u16Channel         The specified channel(s) to be deleted from the specified sequence.
+ *                                  This parameter can be values of @ref ADC_Channels
+ *   @arg  ADC_CH0 ~ ADC_CH11
+ * @retval None.
+ * @note   The specified sequence must not be converting.
+ */
+void ADC_DelAdcChannel(uint8_t u8Seq, uint16_t u16Channel)
+{
+    uint16_t u16Ch;
+
+    u16Ch = u16Channel & ADC_CH_ALL;
+
+    DDL_ASSERT(IS_ADC_SEQUENCE(u8Seq));
+
+    if (u8Seq == ADC_SEQ_A)
+    {
+        M0P_ADC->CHSELRA0 &= (uint16_t)(~u16Ch);
+    }
+    else
+    {
+        M0P_ADC->CHSELRB0 &= (uint16_t)(~u16Ch);
+    }
+}
+
 /**
  * @brief  ADC set extend channel.
  * @param  [in]  u8ExCh             The specified source for the extend channel(channel 11).
@@ -738,6 +770,73 @@ en_result_t ADC_GetChannelData(uint16_t u16Channel, uint16_t *pu16Dest, uint8_t
     return enRet;
 }
 
+/**
+ * @brief  Build the read plan of the specified channel(s).
+ * @param  [out] pstcPlan           Pointer to a @ref stc_adc_read_plan_t structure.
+ * @param  [in]  u16Channel         The specified Channel(s).
+ *                                  This parameter can be values of @ref ADC_Channels
+ *   @arg  ADC_CH0 ~ ADC_CH11
+ * @retval An en_result_t enumeration value.
+ *   @arg  Ok:                      No errors occurred.
+ *   @arg  ErrorInvalidParameter:   pstcPlan == NULL or u16Channel == 0
+ */
+en_result_t ADC_ReadPlanInit(stc_adc_read_plan_t *pstcPlan, uint16_t u16Channel)
+{
+    uint8_t i;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    u16Channel &= ADC_CH_ALL;
+    if ((pstcPlan != NULL) && (u16Channel != 0u))
+    {
+        pstcPlan->u8Num = 0u;
+        for (i = 0u; i < ADC_CH_COUNT; i++)
+        {
+            if ((u16Channel & (uint16_t)(1ul << i)) != 0u)
+            {
+                pstcPlan->au8DrIdx[pstcPlan->u8Num] = i;
+                pstcPlan->u8Num++;
+            }
+        }
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Read the ADC data by a read plan.
+ * @param  [in]  pstcPlan           Pointer to a @ref stc_adc_read_plan_t structure
+ *                                  built by ADC_ReadPlanInit().
+ * @param  [out] pu16Dest           Pointer to the buffer the ADC data to be stored,
+ *                                  at least pstcPlan->u8Num elements.
+ * @retval None
+ * @note   The plan and the buffer are not checked, it is called per scan.
+ *         One load and one store per channel in the plan, four channels per iteration.
+ */
+void ADC_ReadPlanExec(const stc_adc_read_plan_t *pstcPlan, uint16_t *pu16Dest)
+{
+    uint32_t u32Num = pstcPlan->u8Num;
+    const uint8_t *pu8DrIdx = pstcPlan->au8DrIdx;
+    __IO uint16_t *io16AdcDr = &M0P_ADC->DR0;
+
+    while (u32Num >= 4u)
+    {
+        pu16Dest[0u] = io16AdcDr[pu8DrIdx[0u]];
+        pu16Dest[1u] = io16AdcDr[pu8DrIdx[1u]];
+        pu16Dest[2u] = io16AdcDr[pu8DrIdx[2u]];
+        pu16Dest[3u] = io16AdcDr[pu8DrIdx[3u]];
+        pu16Dest += 4u;
+        pu8DrIdx += 4u;
+        u32Num   -= 4u;
+    }
+    while (u32Num > 0u)
+    {
+        *pu16Dest++ = io16AdcDr[*pu8DrIdx++];
+        u32Num--;
+    }
+}
+
 /**
  * @brief  Get the ADC value of the specified ADC pin.
  * @param  [in]  u8AdcPin           The ADC pin number.
@@ -12,6 +12,8 @@
    2020-07-07       Chengy          Add func.CLK_GetXtalStdFlag()
                                     Remove Enable from func. CLK_MCOConfig()
                                     Modified spell error
+   2026-10-19       Chengy          Add func. CLK_SysclkStrucInit()/CLK_SysclkConfig()
+                                    and CLK_GetEfmLatency()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -90,6 +92,10 @@
 #define CLK_TIMEOUT             (0x1000U)
 #define CLK_XTAL_TIMEOUT        (0x20000U)
 
+/* HRC base frequency selected by ICG.HRCFREQS[3] */
+#define CLK_HRC_BASE_FREQ_32M   (32000000ul)
+#define CLK_HRC_BASE_FREQ_48M   (48000000ul)
+
 
 /**
  * @defgroup CLK_Check_Parameters_Validity CLK Check Parameters Validity
@@ -238,6 +244,8 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static uint32_t ClkGetSysclkSrcFreq(uint8_t u8Src, uint8_t u8HrcFreq);
+static void ClkSetEfmLatency(uint32_t u32Latency);
 
 /*******************************************************************************
  * Local variable definitions ('static')
@@ -698,6 +706,141 @@ void CLK_SetSysclkDiv(uint8_t u8Div)
     SystemCoreClockUpdate();
 }
 
+/**
+ * @brief  Init system clock configuration structure with default value.
+ * @param  pstcSysclk specifies the parameter of system clock.
+ *            @arg    u8SysclkSrc  : The system clock source.
+ *            @arg    u8HrcFreq    : The HRC frequency.
+ *            @arg    u8SysclkDiv  : The system clock divider.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: Invalid parameter
+ */
+en_result_t CLK_SysclkStrucInit(stc_clk_sysclk_cfg_t* pstcSysclk)
+{
+    en_result_t enRet = Ok;
+
+    /* Check if pointer is NULL */
+    if (NULL == pstcSysclk)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Configure to default value */
+        pstcSysclk->u8SysclkSrc = CLK_SYSCLKSOURCE_HRC;
+        pstcSysclk->u8HrcFreq   = CLK_HRCFREQ_8;
+        pstcSysclk->u8SysclkDiv = CLK_SYSCLK_DIV1;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Configure the system clock and keep the EFM read latency legal.
+ * @note   The EFM latency is raised before the system clock speeds up and
+ *         lowered after it slows down, the EFM cache is only enabled while
+ *         the EFM works with wait cycle. The clock switch is sequenced so that
+ *         no intermediate frequency exceeds max(old, new).
+ * @note   XTAL must be initialized by CLK_XTALInit() and LRC must be enabled
+ *         before they are selected as system clock source. HRC is initialized
+ *         by this function.
+ * @param  pstcSysclk specifies the parameter of system clock.
+ *            @arg    u8SysclkSrc  : The system clock source.
+ *            @arg    u8HrcFreq    : The HRC frequency.
+ *            @arg    u8SysclkDiv  : The system clock divider.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Configure success
+ *           - ErrorInvalidParameter: Invalid parameter
+ *           - ErrorNotReady: The selected clock source is not ready
+ *           - ErrorTimeout: HRC stable timeout
+ */
+en_result_t CLK_SysclkConfig(const stc_clk_sysclk_cfg_t* pstcSysclk)
+{
+    uint8_t u8CurDiv;
+    uint32_t u32CurFreq;
+    uint32_t u32NewFreq;
+    en_result_t enRet = Ok;
+
+    if (NULL == pstcSysclk)
+    {
+        enRet = ErrorInvalidParameter;
+    }
+    else
+    {
+        /* Paramers check */
+        DDL_ASSERT(IS_VALID_CLK_SYSCLK_SRC(pstcSysclk->u8SysclkSrc));
+        DDL_ASSERT(IS_VALID_CLK_SYSCLK_DIV(pstcSysclk->u8SysclkDiv));
+
+        if ((CLK_SYSCLKSOURCE_XTAL == pstcSysclk->u8SysclkSrc) &&
+            (CLK_FLAG_XTALSTB != READ_REG8_BIT(M0P_CMU->OSCSTBSR, CMU_OSCSTBSR_XTALSTBF)))
+        {
+            enRet = ErrorNotReady;
+        }
+        else if ((CLK_SYSCLKSOURCE_LRC == pstcSysclk->u8SysclkSrc) &&
+                 (CLK_LRC_OFF == READ_REG8_BIT(M0P_CMU->LRCCR, CMU_LRCCR_LRCSTP)))
+        {
+            enRet = ErrorNotReady;
+        }
+        else
+        {
+            if (CLK_SYSCLKSOURCE_HRC == pstcSysclk->u8SysclkSrc)
+            {
+                DDL_ASSERT(IS_VALID_CLK_HRC_FREQ_SEL(pstcSysclk->u8HrcFreq));
+            }
+
+            SystemCoreClockUpdate();
+            u32CurFreq = SystemCoreClock;
+            u32NewFreq = ClkGetSysclkSrcFreq(pstcSysclk->u8SysclkSrc, pstcSysclk->u8HrcFreq) >> \
+                         pstcSysclk->u8SysclkDiv;
+
+            /* Latency for the higher of the two frequencies covers every intermediate step. */
+            ClkSetEfmLatency(CLK_GetEfmLatency((u32CurFreq > u32NewFreq) ? u32CurFreq : u32NewFreq));
+
+            /* Slow down by the divider first. */
+            u8CurDiv = READ_REG8_BIT(M0P_CMU->SCKDIVR, CMU_SCKDIVR_SCKDIV);
+            if (pstcSysclk->u8SysclkDiv > u8CurDiv)
+            {
+                CLK_SetSysclkDiv(pstcSysclk->u8SysclkDiv);
+            }
+
+            if (CLK_SYSCLKSOURCE_HRC == pstcSysclk->u8SysclkSrc)
+            {
+                enRet = CLK_HRCInit(CLK_HRC_ON, pstcSysclk->u8HrcFreq);
+            }
+
+            if (Ok == enRet)
+            {
+                CLK_SetSysclkSrc(pstcSysclk->u8SysclkSrc);
+
+                /* Speed up by the divider last. */
+                if (pstcSysclk->u8SysclkDiv < u8CurDiv)
+                {
+                    CLK_SetSysclkDiv(pstcSysclk->u8SysclkDiv);
+                }
+            }
+
+            /* Lower the latency to the minimum legal value of the final frequency. */
+            SystemCoreClockUpdate();
+            ClkSetEfmLatency(CLK_GetEfmLatency(SystemCoreClock));
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the minimum EFM read latency for the specified HCLK frequency.
+ * @param  u32Hclk              HCLK frequency in Hz.
+ * @retval The EFM read wait cycles, same encoding as EFM_LATENCY_0/EFM_LATENCY_1.
+ */
+uint32_t CLK_GetEfmLatency(uint32_t u32Hclk)
+{
+    DDL_ASSERT(u32Hclk <= CLK_EFM_LATENCY1_MAX_FREQ);
+
+    return (u32Hclk > CLK_EFM_LATENCY0_MAX_FREQ) ? 1ul : 0ul;
+}
+
 /**
  * @brief  Set the HCLK divider witch used as ADC clock.
  * @param  u8Div specifies the divider of HCLK.
@@ -890,6 +1033,64 @@ en_flag_status_t CLK_GetStableFlag(uint8_t u8Flag)
     return enFlagStatus;
 }
 
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CLK_Local_Functions CLK Local Functions
+ * @{
+ */
+/**
+ * @brief  Get the frequency of the system clock source.
+ * @param  u8Src                System clock source, @ref CLK_System_Clock_Source
+ * @param  u8HrcFreq            HRC frequency, @ref CLK_HRCFreq_Sel
+ * @retval Frequency in Hz.
+ */
+static uint32_t ClkGetSysclkSrcFreq(uint8_t u8Src, uint8_t u8HrcFreq)
+{
+    uint32_t u32Freq;
+
+    switch (u8Src)
+    {
+        case CLK_SYSCLKSOURCE_XTAL:
+            u32Freq = XTAL_VALUE;
+            break;
+        case CLK_SYSCLKSOURCE_LRC:
+            u32Freq = LRC_VALUE;
+            break;
+        default:
+            if (EFM_HRCCFGR_HRCFREQS_3 == (M0P_EFM->HRCCFGR & EFM_HRCCFGR_HRCFREQS_3))
+            {
+                u32Freq = CLK_HRC_BASE_FREQ_48M >> u8HrcFreq;
+            }
+            else
+            {
+                u32Freq = CLK_HRC_BASE_FREQ_32M >> u8HrcFreq;
+            }
+            break;
+    }
+
+    return u32Freq;
+}
+
+/**
+ * @brief  Set the EFM read latency, EFM cache is enabled only with wait cycle.
+ * @param  u32Latency           EFM read wait cycles, 0 or 1.
+ * @retval None
+ */
+static void ClkSetEfmLatency(uint32_t u32Latency)
+{
+    if (0ul != u32Latency)
+    {
+        SET_REG32_BIT(M0P_EFM->FRMC, EFM_FRMC_FLWT | EFM_FRMC_CACHE);
+    }
+    else
+    {
+        CLEAR_REG32_BIT(M0P_EFM->FRMC, EFM_FRMC_FLWT | EFM_FRMC_CACHE);
+    }
+}
+
 /**
  * @}
  */
@@ -7,6 +7,11 @@
    Change Logs:
    Date             Author          Notes
    2019-06-19       Heqb            First version
+   2026-10-19       Heqb            Add streaming API CRC_Start/CRC_Update/CRC_Finish
+                                    and CRC_SaveContext/CRC_RestoreContext
+   2026-10-19       Heqb            CRC_8BitWrite: Write the word aligned interior of
+                                    the buffer in words
+   2026-10-19       Heqb            Add DMA fed calculation CRC_CalculateDMA
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -110,6 +115,28 @@
  * @}
  */
 
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+/**
+ * @defgroup CRC_DMA_Configuration CRC DMA Configuration
+ * @{
+ */
+/* LLP field of CHxCTL0 holds bit[11:2] of the descriptor address. */
+#define CRC_DMA_LLP_MASK            (0x00000FFCul)
+#define CRC_DMA_LLP_FIELD(addr)     (((addr) & CRC_DMA_LLP_MASK) << (DMA_CH0CTL0_LLP_POS - 2ul))
+
+/* TC is set at the end of every descriptor, the hardware clears the channel enable bit at the end of the chain. */
+#define CRC_DMA_CH_ENABLED(ch)      (0ul != READ_REG32_BIT(M0P_DMA->CHEN, (1ul << (ch))))
+
+/* DMA transfer states */
+#define CRC_DMA_IDLE                (0u)
+#define CRC_DMA_BUSY                (1u)
+#define CRC_DMA_DONE                (2u)
+/**
+ * @}
+ */
+
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
+
 /**
  * @defgroup CRC_Check_Parameters_Validity CRC check parameters validity
  * @{
@@ -118,6 +145,15 @@
 (   ((x) == CRC_CRC16)                      ||                                 \
     ((x) == CRC_CRC32))
 
+#define IS_CRC_DMA_CH(x)                                                       \
+(   ((x) == DMA_CHANNEL_0)                      ||                             \
+    ((x) == DMA_CHANNEL_1))
+
+#define IS_CRC_BIT_WIDTH(x)                                                    \
+(   ((x) == CRC_BW_8)                       ||                                 \
+    ((x) == CRC_BW_16)                      ||                                 \
+    ((x) == CRC_BW_32))
+
 /**
  * @}
  */
@@ -140,6 +176,11 @@
 static void CRC_8BitWrite(const void *pvData, uint32_t u32Length);
 static void CRC_16BitWrite(const void *pvData, uint32_t u32Length);
 static void CRC_32BitWrite(const void *pvData, uint32_t u32Length);
+static void CRC_WriteData(const void *pvData, uint32_t u32Length, uint8_t u8BitWidth);
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+static uint32_t CRC_DmaBuildChain(const stc_crc_dma_cfg_t *pstcCfg, uint32_t u32Width,
+                                  uint32_t u32Units, uint32_t u32UnitSize);
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
 /**
  * @}
  */
@@ -147,6 +188,19 @@ static void CRC_32BitWrite(const void *pvData, uint32_t u32Length);
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+/**
+ * @defgroup CRC_Local_Variables CRC Local Variables
+ * @{
+ */
+static volatile uint8_t m_u8CrcDmaState = CRC_DMA_IDLE;
+static uint8_t m_u8CrcDmaCh = DMA_CHANNEL_0;
+static uint32_t m_u32CrcDmaCheckSum = 0ul;
+static func_ptr_crc_cb_t m_pfnCrcDmaCallback = NULL;
+/**
+ * @}
+ */
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -194,18 +248,7 @@ uint32_t CRC_Calculate(uint32_t u32CrcProtocol,
             CRC16_INIT_REG = (uint16_t)u32InitVal;
         }
 
-        if (u8BitWidth == CRC_BW_8)
-        {
-            CRC_8BitWrite(pvData, u32Length);
-        }
-        else if (u8BitWidth == CRC_BW_16)
-        {
-            CRC_16BitWrite(pvData, u32Length);
-        }
-        else
-        {
-            CRC_32BitWrite(pvData, u32Length);
-        }
+        CRC_WriteData(pvData, u32Length, u8BitWidth);
 
         if (u32CrcProtocol == CRC_CRC32)
         {
@@ -262,18 +305,7 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
             CRC16_INIT_REG = (uint16_t)u32InitVal;
         }
 
-        if (u8BitWidth == CRC_BW_8)
-        {
-            CRC_8BitWrite(pvData, u32Length);
-        }
-        else if (u8BitWidth == CRC_BW_16)
-        {
-            CRC_16BitWrite(pvData, u32Length);
-        }
-        else
-        {
-            CRC_32BitWrite(pvData, u32Length);
-        }
+        CRC_WriteData(pvData, u32Length, u8BitWidth);
     
         if (u32CrcProtocol == CRC_CRC32)
         {
@@ -294,6 +326,317 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
     return enFlag;
 }
 
+/**
+ * @brief  Start a CRC stream.
+ * @note   The CRC accumulator is kept in the hardware between CRC_Update() calls,
+ *         CRC_Calculate() and CRC_Check() must not be called before the stream
+ *         is finished or saved by CRC_SaveContext().
+ * @param  [in]  u32CrcProtocol     CRC protocol control bit.
+ *                                  This parameter can be a value of @ref CRC_Protocol_Control_Bit
+ * @param  [in]  u32InitVal         Initialize the CRC calculation.
+ * @retval None
+ */
+void CRC_Start(uint32_t u32CrcProtocol, uint32_t u32InitVal)
+{
+    DDL_ASSERT(IS_CRC_PROCOTOL(u32CrcProtocol));
+
+    bM0P_CRC->CR_b.CR = u32CrcProtocol;
+
+    if (u32CrcProtocol == CRC_CRC32)
+    {
+        CRC32_INIT_REG = u32InitVal;
+    }
+    else
+    {
+        CRC16_INIT_REG = (uint16_t)u32InitVal;
+    }
+}
+
+/**
+ * @brief  Feed a chunk of data to the CRC stream started by CRC_Start().
+ * @param  [in]  pvData             Pointer to the buffer containing the data to be computed.
+ * @param  [in]  u32Length          The length(countted in bytes or half word or word, depending on
+ *                                  the bit width) of the data to be computed.
+ * @param  [in]  u8BitWidth         Bit width of the data.
+ *   @arg  CRC_BW_8:                The pointer pvData points to a byte array.
+ *   @arg  CRC_BW_16:               The pointer pvData points to a half word array.
+ *   @arg  CRC_BW_32:               The pointer pvData points to a word array.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      No error occurred.
+ *   @arg  ErrorInvalidParameter:   pvData == NULL or u8BitWidth is invalid.
+ */
+en_result_t CRC_Update(const void *pvData, uint32_t u32Length, uint8_t u8BitWidth)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pvData != NULL) && IS_CRC_BIT_WIDTH(u8BitWidth))
+    {
+        CRC_WriteData(pvData, u32Length, u8BitWidth);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the checksum of the CRC stream.
+ * @note   The accumulator is not changed, the stream can be continued by CRC_Update().
+ * @param  None
+ * @retval CRC checksum.
+ */
+uint32_t CRC_Finish(void)
+{
+    uint32_t u32CheckSum;
+
+    if ((M0P_CRC->CR & CRC_CR_CR) == CRC_CRC32)
+    {
+        u32CheckSum = CRC32_RSLT_REG;
+    }
+    else
+    {
+        u32CheckSum = (uint32_t)CRC16_RSLT_REG;
+    }
+
+    return u32CheckSum;
+}
+
+/**
+ * @brief  Save the context of the current CRC stream.
+ * @note   The result register holds the inverted accumulator, the saved state is
+ *         the value to be reloaded as initial value to continue the stream.
+ * @param  [out] pstcContext        Pointer to a stc_crc_context_t structure to store the context.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      No error occurred.
+ *   @arg  ErrorInvalidParameter:   pstcContext == NULL.
+ */
+en_result_t CRC_SaveContext(stc_crc_context_t *pstcContext)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcContext != NULL)
+    {
+        pstcContext->u32CrcProtocol = M0P_CRC->CR & CRC_CR_CR;
+        if (pstcContext->u32CrcProtocol == CRC_CRC32)
+        {
+            pstcContext->u32CrcState = ~CRC32_RSLT_REG;
+        }
+        else
+        {
+            pstcContext->u32CrcState = (uint32_t)(uint16_t)(~CRC16_RSLT_REG);
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Restore a CRC stream saved by CRC_SaveContext().
+ * @param  [in]  pstcContext        Pointer to a stc_crc_context_t structure which holds the context.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      No error occurred.
+ *   @arg  ErrorInvalidParameter:   pstcContext == NULL.
+ */
+en_result_t CRC_RestoreContext(const stc_crc_context_t *pstcContext)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pstcContext != NULL)
+    {
+        CRC_Start(pstcContext->u32CrcProtocol, pstcContext->u32CrcState);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+/**
+ * @brief  Calculate the CRC of a memory region by DMA, the CPU is free during the transfer.
+ * @note   1. The function clocks of CRC, DMA and AOS must be enabled before calling this function.
+ *         2. The region is moved as words, half words or bytes, depending on the alignment of
+ *            u32SrcAddr and u32Length. The first block is loaded into the channel registers and
+ *            every further block of CRC_DMA_BLKSIZE_MAX units takes one descriptor of
+ *            pstcLlpDesc, see CRC_DMA_LLP_DESC_NUM(). The descriptors must be located in SRAM
+ *            and kept untouched until the calculation completes.
+ *         3. One software trigger starts the transfer, the following blocks are chained with
+ *            DMA_LLP_RUN. The transfer complete interrupt of the channel is enabled, call
+ *            CRC_DmaIrqHandler() from DmaTc0_IrqHandler() or DmaTc1_IrqHandler(), or poll the
+ *            result by CRC_GetDmaResult().
+ *         4. The CRC unit must not be used by other functions until the calculation completes.
+ *         5. Available with DDL_DMA_ENABLE and DDL_INTERRUPTS_ENABLE, the transfer is started
+ *            by AOS_SW_Trigger().
+ * @param  [in]  pstcCfg            Pointer to a stc_crc_dma_cfg_t structure.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      The calculation is started.
+ *   @arg  ErrorInvalidParameter:   pstcCfg == NULL, u32Length == 0 or the descriptor pool is too small.
+ *   @arg  ErrorOperationInProgress: The previous DMA calculation is not finished.
+ */
+en_result_t CRC_CalculateDMA(const stc_crc_dma_cfg_t *pstcCfg)
+{
+    uint32_t u32Width;
+    uint32_t u32UnitSize;
+    uint32_t u32Units;
+    uint32_t u32FirstUnits;
+    uint32_t u32LlpAddr;
+    stc_dma_ch_cfg_t stcDmaCfg;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((pstcCfg != NULL) && (pstcCfg->u32Length != 0ul))
+    {
+        DDL_ASSERT(IS_CRC_DMA_CH(pstcCfg->u8DmaCh));
+        DDL_ASSERT(IS_CRC_PROCOTOL(pstcCfg->u32CrcProtocol));
+
+        if (m_u8CrcDmaState == CRC_DMA_BUSY)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            /* The widest unit allowed by the alignment of both address and length. */
+            if (((pstcCfg->u32SrcAddr | pstcCfg->u32Length) & 3ul) == 0ul)
+            {
+                u32Width    = DMA_DATAWIDTH_32BIT;
+                u32UnitSize = 4ul;
+            }
+            else if (((pstcCfg->u32SrcAddr | pstcCfg->u32Length) & 1ul) == 0ul)
+            {
+                u32Width    = DMA_DATAWIDTH_16BIT;
+                u32UnitSize = 2ul;
+            }
+            else
+            {
+                u32Width    = DMA_DATAWIDTH_8BIT;
+                u32UnitSize = 1ul;
+            }
+            u32Units = pstcCfg->u32Length / u32UnitSize;
+
+            if ((CRC_DMA_LLP_DESC_NUM(u32Units) == 0ul) ||
+                ((pstcCfg->pstcLlpDesc != NULL) && (pstcCfg->u32LlpDescNum >= CRC_DMA_LLP_DESC_NUM(u32Units))))
+            {
+                u32FirstUnits = (u32Units > CRC_DMA_BLKSIZE_MAX) ? CRC_DMA_BLKSIZE_MAX : u32Units;
+
+                m_u8CrcDmaCh        = pstcCfg->u8DmaCh;
+                m_pfnCrcDmaCallback = pstcCfg->pfnCallback;
+                m_u8CrcDmaState     = CRC_DMA_BUSY;
+
+                CRC_Start(pstcCfg->u32CrcProtocol, pstcCfg->u32InitVal);
+
+                DMA_ChannelDisable(pstcCfg->u8DmaCh);
+
+                stcDmaCfg.u32DataWidth   = u32Width;
+                stcDmaCfg.u32BlockSize   = u32FirstUnits;
+                stcDmaCfg.u32TransferCnt = 1ul;
+                stcDmaCfg.u32SrcAddr     = pstcCfg->u32SrcAddr;
+                stcDmaCfg.u32DesAddr     = (uint32_t)(&M0P_CRC->DAT0);
+                stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_INC;
+                stcDmaCfg.u32DesInc      = DMA_DESADDRINC_FIX;
+                DMA_ChannelCfg(pstcCfg->u8DmaCh, &stcDmaCfg);
+
+                u32LlpAddr = CRC_DmaBuildChain(pstcCfg, u32Width, u32Units - u32FirstUnits, u32UnitSize);
+                if (u32LlpAddr != 0ul)
+                {
+                    DMA_LlpInit(pstcCfg->u8DmaCh, DMA_LLP_RUN, u32LlpAddr);
+                }
+                else
+                {
+                    DMA_LlpCmd(pstcCfg->u8DmaCh, Disable);
+                }
+
+                DMA_ClearCplFlag(pstcCfg->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+                DMA_CplIrqCmd(pstcCfg->u8DmaCh, DMA_IRQ_TC, Enable);
+                DMA_Cmd(Enable);
+                DMA_ChannelEnable(pstcCfg->u8DmaCh);
+
+                /* One software request moves the first block, the chain runs by itself. */
+                DMA_SetTriggerSrc(pstcCfg->u8DmaCh, EVT_AOS_STRG);
+                AOS_SW_Trigger();
+
+                enRet = Ok;
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the result of the calculation started by CRC_CalculateDMA().
+ * @note   Can be used instead of CRC_DmaIrqHandler() when the DMA interrupt is not used.
+ * @param  [out] pu32CheckSum       Pointer to a variable to store the CRC checksum.
+ * @retval An en_result_t enumeration value:
+ *   @arg  Ok:                      The calculation is completed.
+ *   @arg  ErrorInvalidParameter:   pu32CheckSum == NULL.
+ *   @arg  ErrorNotReady:           No calculation has been started.
+ *   @arg  OperationInProgress:     The calculation is ongoing.
+ */
+en_result_t CRC_GetDmaResult(uint32_t *pu32CheckSum)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (pu32CheckSum != NULL)
+    {
+        if (m_u8CrcDmaState == CRC_DMA_BUSY)
+        {
+            if (DMA_GetCplFlag(m_u8CrcDmaCh, DMA_FLAG_TC) == Set)
+            {
+                DMA_ClearCplFlag(m_u8CrcDmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+                /* Only the last descriptor of the chain completes the calculation. */
+                if (!CRC_DMA_CH_ENABLED(m_u8CrcDmaCh))
+                {
+                    m_u32CrcDmaCheckSum = CRC_Finish();
+                    m_u8CrcDmaState = CRC_DMA_DONE;
+                }
+            }
+        }
+
+        if (m_u8CrcDmaState == CRC_DMA_DONE)
+        {
+            *pu32CheckSum = m_u32CrcDmaCheckSum;
+            enRet = Ok;
+        }
+        else if (m_u8CrcDmaState == CRC_DMA_BUSY)
+        {
+            enRet = OperationInProgress;
+        }
+        else
+        {
+            enRet = ErrorNotReady;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  DMA transfer complete handler of the CRC calculation.
+ * @note   Call this function in DmaTc0_IrqHandler() or DmaTc1_IrqHandler() according to
+ *         the channel used by CRC_CalculateDMA(). The callback is invoked with the checksum.
+ * @param  None
+ * @retval None
+ */
+void CRC_DmaIrqHandler(void)
+{
+    if ((m_u8CrcDmaState == CRC_DMA_BUSY) && (DMA_GetCplFlag(m_u8CrcDmaCh, DMA_FLAG_TC) == Set))
+    {
+        DMA_ClearCplFlag(m_u8CrcDmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+    }
+
+    /* The chain completes when the hardware has disabled the channel, TC is set per descriptor. */
+    if ((m_u8CrcDmaState == CRC_DMA_BUSY) && (!CRC_DMA_CH_ENABLED(m_u8CrcDmaCh)))
+    {
+        DMA_CplIrqCmd(m_u8CrcDmaCh, DMA_IRQ_TC, Disable);
+        m_u32CrcDmaCheckSum = CRC_Finish();
+        m_u8CrcDmaState = CRC_DMA_DONE;
+
+        if (m_pfnCrcDmaCallback != NULL)
+        {
+            m_pfnCrcDmaCallback(m_u32CrcDmaCheckSum);
+        }
+    }
+}
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
+
 /**
  * @}
  */
@@ -305,6 +648,10 @@ en_flag_status_t CRC_Check(uint32_t u32CrcProtocol,
 
 /**
  * @brief  Write CRC data register in bytes.
+ * @note   The CRC unit consumes a word from the least significant byte, which
+ *         is the order of the bytes in memory. The unaligned head and the tail
+ *         are written in bytes and the word aligned interior is written in
+ *         words, the checksum is the same as writing every byte.
  * @param  [in]  pvData             Pointer to the buffer containing the data to be written.
  * @param  [in]  u32Length          The length of data the in bytes.
  * @retval None
@@ -313,10 +660,35 @@ static void CRC_8BitWrite(const void *pvData, uint32_t u32Length)
 {
     uint32_t u32Count;
     const uint8_t *pu8Data = pvData;
+    const uint32_t *pu32Data;
 
-    for (u32Count = 0u; u32Count < u32Length; u32Count++)
+    /* Unaligned head. */
+    while ((u32Length != 0u) && (((uint32_t)pu8Data & 0x3u) != 0u))
     {
-        CRC8_DAT_REG = pu8Data[u32Count];
+        CRC8_DAT_REG = *pu8Data++;
+        u32Length--;
+    }
+
+    /* Word aligned interior, 4 words per loop. */
+    pu32Data = (const uint32_t *)(const void *)pu8Data;
+    for (u32Count = (u32Length >> 4u); u32Count != 0u; u32Count--)
+    {
+        CRC32_DAT_REG = pu32Data[0u];
+        CRC32_DAT_REG = pu32Data[1u];
+        CRC32_DAT_REG = pu32Data[2u];
+        CRC32_DAT_REG = pu32Data[3u];
+        pu32Data += 4u;
+    }
+    for (u32Count = ((u32Length >> 2u) & 0x3u); u32Count != 0u; u32Count--)
+    {
+        CRC32_DAT_REG = *pu32Data++;
+    }
+
+    /* Tail. */
+    pu8Data = (const uint8_t *)(const void *)pu32Data;
+    for (u32Count = (u32Length & 0x3u); u32Count != 0u; u32Count--)
+    {
+        CRC8_DAT_REG = *pu8Data++;
     }
 }
 
@@ -354,6 +726,75 @@ static void CRC_32BitWrite(const void *pvData, uint32_t u32Length)
     }
 }
 
+/**
+ * @brief  Write CRC data register according to the bit width.
+ * @param  [in]  pvData             Pointer to the buffer containing the data to be written.
+ * @param  [in]  u32Length          The length of the data in unit of the bit width.
+ * @param  [in]  u8BitWidth         Bit width of the data, @ref CRC_Bit_Width
+ * @retval None
+ */
+static void CRC_WriteData(const void *pvData, uint32_t u32Length, uint8_t u8BitWidth)
+{
+    if (u8BitWidth == CRC_BW_8)
+    {
+        CRC_8BitWrite(pvData, u32Length);
+    }
+    else if (u8BitWidth == CRC_BW_16)
+    {
+        CRC_16BitWrite(pvData, u32Length);
+    }
+    else
+    {
+        CRC_32BitWrite(pvData, u32Length);
+    }
+}
+
+#if ((DDL_DMA_ENABLE == DDL_ON) && (DDL_INTERRUPTS_ENABLE == DDL_ON))
+/**
+ * @brief  Build the LLP descriptors for the blocks after the first one.
+ * @param  [in]  pstcCfg            Pointer to a stc_crc_dma_cfg_t structure.
+ * @param  [in]  u32Width           DMA data width, @ref DMA_DataWidth
+ * @param  [in]  u32Units           Number of units left after the first block.
+ * @param  [in]  u32UnitSize        Size of one unit in bytes.
+ * @retval Address of the first descriptor, 0 if no descriptor is needed.
+ */
+static uint32_t CRC_DmaBuildChain(const stc_crc_dma_cfg_t *pstcCfg, uint32_t u32Width,
+                                  uint32_t u32Units, uint32_t u32UnitSize)
+{
+    uint32_t u32BlkUnits;
+    uint32_t u32SrcAddr;
+    stc_dma_llp_descriptor_t *pstcDesc = pstcCfg->pstcLlpDesc;
+    uint32_t u32FirstAddr = 0ul;
+
+    if (u32Units != 0ul)
+    {
+        u32FirstAddr = (uint32_t)pstcDesc;
+        u32SrcAddr = pstcCfg->u32SrcAddr + (CRC_DMA_BLKSIZE_MAX * u32UnitSize);
+
+        while (u32Units != 0ul)
+        {
+            u32BlkUnits = (u32Units > CRC_DMA_BLKSIZE_MAX) ? CRC_DMA_BLKSIZE_MAX : u32Units;
+            u32Units -= u32BlkUnits;
+
+            pstcDesc->SARx    = u32SrcAddr;
+            pstcDesc->DARx    = (uint32_t)(&M0P_CRC->DAT0);
+            pstcDesc->CHxCTL1 = DMA_SRCADDRINC_INC | DMA_DESADDRINC_FIX;
+            pstcDesc->CHxCTL0 = u32BlkUnits | (1ul << DMA_CH0CTL0_CNT_POS) | u32Width;
+            if (u32Units != 0ul)
+            {
+                pstcDesc->CHxCTL0 |= CRC_DMA_LLP_FIELD((uint32_t)(&pstcDesc[1])) |
+                                     DMA_LLP_ENABLE | DMA_LLP_RUN;
+            }
+
+            u32SrcAddr += u32BlkUnits * u32UnitSize;
+            pstcDesc++;
+        }
+    }
+
+    return u32FirstAddr;
+}
+#endif /* DDL_DMA_ENABLE && DDL_INTERRUPTS_ENABLE */
+
 /**
  * @}
  */
@@ -12,6 +12,7 @@
    2020-02-24       Chengy          Bug fixed# Eliminate impact on other bits in
                                         function DMA_LlpInit.
    2020-02-27       Zhangxl         Use new macro in hc32_common.h
+   2026-10-19       Chengy          Add func. DMA_LlpCmd()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -387,6 +388,29 @@ void DMA_LlpInit(uint8_t u8Ch, uint32_t u32LlpRun, uint32_t u32Llp)
                ((u32Llp & DMA_LLP_MASK) << (DMA_CH0CTL0_LLP_POS - 2ul)));
 }
 
+/**
+ * @brief  Enable or disable the DMA LLP(link listed pointer) of the specified channel.
+ * @param  u8Ch                 The specified DMA channel.
+ *           @arg  This parameter can be: DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  enNewState           The function new state.
+ *           @arg  This parameter can be: Enable or Disable.
+ * @retval None
+ */
+void DMA_LlpCmd(uint8_t u8Ch, en_functional_state_t enNewState)
+{
+    DDL_ASSERT(IS_VALID_DMA_CH(u8Ch));
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    if (Enable == enNewState)
+    {
+        SET_REG32_BIT(DMA_CH_REG(M0P_DMA->CH0CTL0, u8Ch), DMA_LLP_ENABLE);
+    }
+    else
+    {
+        CLEAR_REG32_BIT(DMA_CH_REG(M0P_DMA->CH0CTL0, u8Ch), DMA_LLP_ENABLE);
+    }
+}
+
 /**
  * @brief  Set the source address of the specified ADM channel.
  * @param  u8Ch                 The specified DMA channel.
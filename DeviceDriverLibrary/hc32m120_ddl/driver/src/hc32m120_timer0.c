@@ -8,6 +8,10 @@
    Date             Author          Notes
    2019-06-20       Heqb          First version
    2019-12-11       Heqb          Add timeout function for register write
+   2026-10-19       Heqb          Shorten AsyncDelay to the LRC synchronization time,
+                                  add deferred register write in asynchronous mode
+   2026-10-19       Heqb          The deferred write completes 3 LRC cycles after the write
+   2026-10-19       Heqb          Measure the synchronization time by the counter
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -118,6 +122,10 @@
 (   ((x) == TIMER0_FUNC_CMP)                       ||                          \
     ((x) == TIMER0_FUNC_CAPTURE))
 
+#define IS_VALID_ASYNC_WRITE_MODE(x)                                           \
+(   ((x) == TIMER0_ASYNC_WRITE_WAIT)               ||                          \
+    ((x) == TIMER0_ASYNC_WRITE_DEFER))
+
 /**
  * @}
  */
@@ -133,10 +141,21 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static en_result_t AsyncPollReg(__IO const uint32_t *pu32Reg, uint32_t u32Val);
+static uint16_t AsyncReadCnt(void);
+static en_flag_status_t AsyncElapsed(void);
+static en_result_t AsyncWrite(__IO uint32_t *pu32Reg, uint32_t u32Val);
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static uint8_t m_u8AsyncWriteMode = TIMER0_ASYNC_WRITE_WAIT;
+/* Register, value, counter and SysTick tick of the deferred write which is not
+   synchronized yet. */
+static __IO uint32_t *m_pu32AsyncReg = NULL;
+static uint32_t m_u32AsyncVal = 0ul;
+static uint16_t m_u16AsyncCnt = 0u;
+static uint32_t m_u32AsyncTick = 0ul;
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -164,17 +183,118 @@ static uint32_t TIMER0_GetClkMode(void)
  * @param  None
  *
  * @retval None
+ * @note   The delay is the LRC synchronization time, see DDL_LrcSyncDelay().
  */
 static void AsyncDelay(void)
 {
-    uint32_t i;
     if(TIMER0_CLK_SRC_LRC == TIMER0_GetClkMode())
     {
-        for(i=0u; i<SystemCoreClock/10000u; i++)
+        DDL_LrcSyncDelay();
+    }
+}
+
+/**
+ * @brief  Wait until the register reads back the written value
+ * @param  [in] pu32Reg   Register or bit-band alias written
+ * @param  [in] u32Val    Value written
+ *
+ * @retval Ok: Success
+ * @retval ErrorTimeout: Process timeout
+ * @note   The read back value does not prove the synchronization, call it after
+ *         the LRC synchronization time.
+ */
+static en_result_t AsyncPollReg(__IO const uint32_t *pu32Reg, uint32_t u32Val)
+{
+    en_result_t enRet = Ok;
+    uint32_t u32TimeOut = 0ul;
+    while(u32Val != *pu32Reg)
+    {
+        if(u32TimeOut++ > TIMER0_TMOUT)
         {
-            __NOP();
+            enRet = ErrorTimeout;
+            break;
         }
     }
+    return enRet;
+}
+
+/**
+ * @brief  Read the counter in asynchronous mode
+ * @param  None
+ *
+ * @retval The counter register data
+ * @note   The counter runs on LRC, it is read until two reads agree.
+ */
+static uint16_t AsyncReadCnt(void)
+{
+    uint16_t u16Cnt;
+    do
+    {
+        u16Cnt = TIMER0_GetCntReg();
+    } while(u16Cnt != TIMER0_GetCntReg());
+    return u16Cnt;
+}
+
+/**
+ * @brief  Check whether the LRC synchronization time of the deferred write passed
+ * @param  None
+ *
+ * @retval Set: The time passed
+ * @retval Reset: The time may not have passed yet
+ * @note   The time is measured by the counter, see DDL_LrcSyncCntElapsed(). The
+ *         SysTick tick is the fallback while the counter is stopped, or for a
+ *         write to the counter itself.
+ */
+static en_flag_status_t AsyncElapsed(void)
+{
+    en_flag_status_t enRet = Reset;
+    const uint32_t u32DivShift = (M0P_TMR0->BCONR & TMR0_BCONR_CKDIVA) >> TMR0_BCONR_CKDIVA_POS;
+
+    if(&M0P_TMR0->CNTAR != m_pu32AsyncReg)
+    {
+        enRet = DDL_LrcSyncCntElapsed(m_u16AsyncCnt, AsyncReadCnt(), u32DivShift);
+    }
+    if(Reset == enRet)
+    {
+        enRet = DDL_LrcSyncElapsed(m_u32AsyncTick);
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Write a register, wait or defer the synchronization in asynchronous mode
+ * @param  [in] pu32Reg   Register or bit-band alias to write
+ * @param  [in] u32Val    Value to write
+ *
+ * @retval Ok: Success, or the write is deferred
+ * @retval ErrorTimeout: Process timeout
+ * @note   The previous deferred write is completed first, a register of Timer0
+ *         in asynchronous mode is written again only after the synchronization.
+ *         A deferred write is synchronized 3 LRC cycles after the write, the
+ *         time is measured by the counter, see AsyncElapsed().
+ */
+static en_result_t AsyncWrite(__IO uint32_t *pu32Reg, uint32_t u32Val)
+{
+    en_result_t enRet = TIMER0_AsyncWaitDone();
+    if(Ok == enRet)
+    {
+        if((TIMER0_ASYNC_WRITE_DEFER == m_u8AsyncWriteMode) &&
+           (TIMER0_CLK_SRC_LRC == TIMER0_GetClkMode()))
+        {
+            *pu32Reg = u32Val;
+            m_u16AsyncCnt = AsyncReadCnt();
+            m_u32AsyncTick = SysTick_GetTick();
+            m_u32AsyncVal = u32Val;
+            m_pu32AsyncReg = pu32Reg;
+        }
+        else
+        {
+            *pu32Reg = u32Val;
+            AsyncDelay();
+            enRet = AsyncPollReg(pu32Reg, u32Val);
+        }
+    }
+    return enRet;
 }
 
 /**
@@ -310,19 +430,7 @@ en_flag_status_t TIMER0_GetFlag(void)
  */
 en_result_t TIMER0_ClearFlag(void)
 {
-    en_result_t enRet = Ok;
-    uint32_t u32TimeOut = 0ul;
-    bM0P_TMR0->STFLR_b.CMFA = 0u;
-    AsyncDelay();
-    while(0u != bM0P_TMR0->STFLR_b.CMFA)
-    {
-        if(u32TimeOut++ > TIMER0_TMOUT)
-        {
-            enRet = ErrorTimeout;
-            break;
-        }
-    }
-    return enRet;
+    return AsyncWrite(&bM0P_TMR0->STFLR_b.CMFA, 0ul);
 }
 
 /**
@@ -334,21 +442,9 @@ en_result_t TIMER0_ClearFlag(void)
  */
 en_result_t TIMER0_Cmd(en_functional_state_t enNewState)
 {
-    en_result_t enRet = Ok;
-    uint32_t u32TimeOut = 0ul;
     DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
 
-    bM0P_TMR0->BCONR_b.CSTA = enNewState;
-    AsyncDelay();
-    while(enNewState != bM0P_TMR0->BCONR_b.CSTA)
-    {
-        if(u32TimeOut++ > TIMER0_TMOUT)
-        {
-            enRet = ErrorTimeout;
-            break;
-        }
-    }
-    return enRet;
+    return AsyncWrite(&bM0P_TMR0->BCONR_b.CSTA, (uint32_t)enNewState);
 }
 
 /**
@@ -360,21 +456,9 @@ en_result_t TIMER0_Cmd(en_functional_state_t enNewState)
  */
 en_result_t TIMER0_IntCmd(en_functional_state_t enNewState)
 {
-    en_result_t enRet = Ok;
-    uint32_t u32TimeOut = 0ul;
     DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
 
-    bM0P_TMR0->BCONR_b.INTENA = enNewState;
-    AsyncDelay();
-    while(enNewState != bM0P_TMR0->BCONR_b.INTENA)
-    {
-        if(u32TimeOut++ > TIMER0_TMOUT)
-        {
-            enRet = ErrorTimeout;
-            break;
-        }
-    }
-    return enRet;
+    return AsyncWrite(&bM0P_TMR0->BCONR_b.INTENA, (uint32_t)enNewState);
 }
 
 /**
@@ -398,19 +482,7 @@ uint16_t TIMER0_GetCntReg(void)
  */
 en_result_t TIMER0_WriteCntReg(uint16_t u16Cnt)
 {
-    en_result_t enRet = Ok;
-    uint32_t u32TimeOut = 0ul;
-    M0P_TMR0->CNTAR = (uint32_t)u16Cnt;
-    AsyncDelay();
-    while((uint32_t)u16Cnt != M0P_TMR0->CNTAR)
-    {
-        if(u32TimeOut++ > TIMER0_TMOUT)
-        {
-            enRet = ErrorTimeout;
-            break;
-        }
-    }
-    return enRet;
+    return AsyncWrite(&M0P_TMR0->CNTAR, (uint32_t)u16Cnt);
 }
 
 /**
@@ -434,19 +506,7 @@ uint16_t TIMER0_GetCmpReg(void)
  */
 en_result_t TIMER0_WriteCmpReg(uint16_t u16Cnt)
 {
-    en_result_t enRet = Ok;
-    uint32_t u32TimeOut = 0ul;
-    M0P_TMR0->CMPAR = (uint32_t)u16Cnt;
-    AsyncDelay();
-    while((uint32_t)u16Cnt != M0P_TMR0->CMPAR)
-    {
-        if(u32TimeOut++ > TIMER0_TMOUT)
-        {
-            enRet = ErrorTimeout;
-            break;
-        }
-    }
-    return enRet;
+    return AsyncWrite(&M0P_TMR0->CMPAR, (uint32_t)u16Cnt);
 }
 
 /**
@@ -458,8 +518,9 @@ en_result_t TIMER0_WriteCmpReg(uint16_t u16Cnt)
  */
 en_result_t TIMER0_DeInit(void)
 {
-    en_result_t enRet = Ok;
+    en_result_t enRet;
     uint32_t u32TimeOut = 0ul;
+    enRet = TIMER0_AsyncWaitDone();
     M0P_TMR0->BCONR = 0x00000000ul;
     AsyncDelay();
     while(0x00000000ul != M0P_TMR0->BCONR)
@@ -487,6 +548,77 @@ void TIMER0_SetTriggerSrc(en_event_src_t enEvent)
     M0P_AOS->TMR0_HTSSR_f.TRGSEL = enEvent;  
 }
 
+/**
+ * @brief  Set the register write mode in asynchronous mode
+ * @param  [in] u8Mode    Write mode, @ref TIMER0_Async_Write_Mode_define
+ *   @arg  TIMER0_ASYNC_WRITE_WAIT:  TIMER0_Cmd(), TIMER0_IntCmd(), TIMER0_ClearFlag(),
+ *                                   TIMER0_WriteCntReg() and TIMER0_WriteCmpReg() return
+ *                                   after the write is synchronized
+ *   @arg  TIMER0_ASYNC_WRITE_DEFER: These functions return after the write
+ *
+ * @retval None
+ * @note   In mode TIMER0_ASYNC_WRITE_DEFER, the write is checked by
+ *         TIMER0_AsyncWriteStatus(), e.g. after the next wakeup, or completed by
+ *         TIMER0_AsyncWaitDone(). The next write waits for it if necessary.
+ */
+void TIMER0_SetAsyncWriteMode(uint8_t u8Mode)
+{
+    DDL_ASSERT(IS_VALID_ASYNC_WRITE_MODE(u8Mode));
+    m_u8AsyncWriteMode = u8Mode;
+}
+
+/**
+ * @brief  Get the status of the deferred write
+ * @param  None
+ *
+ * @retval Ok: No deferred write, or it is synchronized
+ * @retval OperationInProgress: The deferred write is not synchronized yet
+ * @note   The write is synchronized when the counter counted the LRC synchronization
+ *         time since the write and the register reads back the value. While the
+ *         counter is stopped, the time is measured by the SysTick tick instead:
+ *         more than two tick periods, or never while the SysTick is not
+ *         initialized. TIMER0_AsyncWaitDone() completes the write then.
+ */
+en_result_t TIMER0_AsyncWriteStatus(void)
+{
+    en_result_t enRet = Ok;
+    if(NULL != m_pu32AsyncReg)
+    {
+        if((Set == AsyncElapsed()) &&
+           (m_u32AsyncVal == *m_pu32AsyncReg))
+        {
+            m_pu32AsyncReg = NULL;
+        }
+        else
+        {
+            enRet = OperationInProgress;
+        }
+    }
+    return enRet;
+}
+
+/**
+ * @brief  Wait until the deferred write is synchronized
+ * @param  None
+ *
+ * @retval Ok: Success
+ * @retval ErrorTimeout: Process timeout
+ */
+en_result_t TIMER0_AsyncWaitDone(void)
+{
+    en_result_t enRet = Ok;
+    if(OperationInProgress == TIMER0_AsyncWriteStatus())
+    {
+        if(Reset == AsyncElapsed())
+        {
+            AsyncDelay();
+        }
+        enRet = AsyncPollReg(m_pu32AsyncReg, m_u32AsyncVal);
+        m_pu32AsyncReg = NULL;
+    }
+    return enRet;
+}
+
 /**
  * @}
  */
@@ -8,6 +8,9 @@
    2019-06-28       Yangjp          First version
    2020-01-08       Wuze            Added function '_write' for printf in GCC compiler.
    2020-12-03       Yangjp          Fixed SysTick_Delay function overflow handling
+   2026-10-19       Yangjp          Added function SysTick_AddTick
+   2026-10-19       Yangjp          Added functions DDL_LrcSyncDelay and DDL_LrcSyncElapsed
+   2026-10-19       Yangjp          Added function DDL_LrcSyncCntElapsed
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -77,6 +80,21 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/**
+ * @defgroup UTILITY_Local_Macros UTILITY Local Macros
+ * @{
+ */
+
+/* A write to a timer clocked by LRC is synchronized in 3 LRC cycles, one more
+   cycle covers the phase of LRC and the LRC frequency deviation. */
+#define LRC_SYNC_CYCLE                  (4ul)
+/* CPU cycles of one loop of DDL_LrcSyncDelay() at least, fewer than the actual
+   cycles with the flash wait cycles so that the delay is never too short. */
+#define LRC_SYNC_LOOP_CYCLE             (4ul)
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
@@ -135,6 +153,87 @@ void DDL_Delay1ms(uint32_t u32Cnt)
     }
 }
 
+/**
+ * @brief Wait until a write to a timer clocked by LRC is synchronized.
+ * @note  The delay is LRC_SYNC_CYCLE LRC cycles from the ratio of SystemCoreClock
+ *        to LRC. Skip it if DDL_LrcSyncCntElapsed() or DDL_LrcSyncElapsed()
+ *        returns Set for the write.
+ * @param None
+ * @retval None
+ */
+void DDL_LrcSyncDelay(void)
+{
+    uint32_t i;
+    uint32_t u32Loop;
+
+    u32Loop = (((SystemCoreClock / LRC_VALUE) + 1ul) * LRC_SYNC_CYCLE) / LRC_SYNC_LOOP_CYCLE;
+    for (i = 0ul; i < u32Loop; i++)
+    {
+        __NOP();
+    }
+}
+
+/**
+ * @brief Check by the counter of a timer clocked by LRC whether a write to the
+ *        timer is synchronized by now.
+ * @note  1. The counter counts once per (1 << u32DivShift) LRC cycles, the
+ *           first count may follow the write at once. A count more than the
+ *           LRC_SYNC_CYCLE LRC cycles proves the time since the write, the delay
+ *           of the counter read cancels out.
+ *        2. A counter below u16WriteCnt was cleared or wrapped after the write,
+ *           it counted at least u16Cnt times since then.
+ *        3. The counter has to run since the write and the write must not be
+ *           to the counter. A stopped counter returns Reset, use
+ *           DDL_LrcSyncElapsed() or DDL_LrcSyncDelay() then.
+ * @param [in] u16WriteCnt              Counter read after the write.
+ * @param [in] u16Cnt                   Counter read now.
+ * @param [in] u32DivShift              log2 of the clock division of the counter.
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The write is synchronized
+ *           - Reset: The write may not be synchronized yet
+ */
+en_flag_status_t DDL_LrcSyncCntElapsed(uint16_t u16WriteCnt, uint16_t u16Cnt, uint32_t u32DivShift)
+{
+    en_flag_status_t enRet = Reset;
+    uint32_t u32Count = (uint32_t)u16Cnt;
+    /* ceil(LRC_SYNC_CYCLE / division) counts, plus one for the first count. */
+    const uint32_t u32Need = ((LRC_SYNC_CYCLE - 1ul) >> u32DivShift) + 2ul;
+
+    if (u16Cnt >= u16WriteCnt)
+    {
+        u32Count = (uint32_t)u16Cnt - (uint32_t)u16WriteCnt;
+    }
+    if (u32Count >= u32Need)
+    {
+        enRet = Set;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief Check by the SysTick whether a write to a timer clocked by LRC is
+ *        synchronized by now.
+ * @note  The fallback of DDL_LrcSyncCntElapsed() while the counter of the timer
+ *        does not run. More than two tick periods are far more than the
+ *        synchronization. Reset is returned while the SysTick is not initialized.
+ * @param [in] u32WriteTick             SysTick_GetTick() at the write.
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The write is synchronized
+ *           - Reset: The write may not be synchronized yet
+ */
+en_flag_status_t DDL_LrcSyncElapsed(uint32_t u32WriteTick)
+{
+    en_flag_status_t enRet = Reset;
+
+    if ((0ul != u32TickStep) && ((SysTick_GetTick() - u32WriteTick) > (2ul * u32TickStep)))
+    {
+        enRet = Set;
+    }
+
+    return enRet;
+}
+
 /**
  * @brief This function Initializes the interrupt frequency of the SysTick.
  * @param [in] u32Freq                  SysTick interrupt frequency (1 to 1000).
@@ -200,6 +299,18 @@ __WEAKDEF void SysTick_IncTick(void)
     u32TickCount += u32TickStep;
 }
 
+/**
+ * @brief Add the time passed while the SysTick was suspended to "u32TickCount".
+ * @note  Used after a low power mode in which the SysTick interrupt was disabled,
+ *        the time is measured by another clock.
+ * @param [in] u32Tick                  Time in millisecond.
+ * @retval None
+ */
+__WEAKDEF void SysTick_AddTick(uint32_t u32Tick)
+{
+    u32TickCount += u32Tick;
+}
+
 /**
  * @brief Provides a tick value in millisecond.
  * @param None
@@ -0,0 +1,240 @@
+/**
+ *******************************************************************************
+ * @file  adc/adc_09_filter_bench/source/main.c
+ * @brief Main program of the cycle benchmark of the ADC filter midware.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+#include "adc_filter.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Examples
+ * @{
+ */
+
+/**
+ * @addtogroup ADC_Filter_Bench
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Input samples of one run, a half buffer of 8 frames of 32 samples. */
+#define BENCH_SAMPLE_NUM            (256u)
+/* OSR 16, 12-bit input, 14-bit output. */
+#define BENCH_DECIM_SHIFT           (4u)
+#define BENCH_OUT_NUM               ((BENCH_SAMPLE_NUM >> BENCH_DECIM_SHIFT) + 1u)
+/* IIR on, alpha = 1/8 in Q15. */
+#define BENCH_IIR_ALPHA             (0x1000u)
+/* Runs of each configuration, the minimum is taken. */
+#define BENCH_RUN_NUM               (8u)
+
+/* SysTick counts HCLK down from 0xFFFFFF, one run must be shorter than 2^24 cycles. */
+#define BENCH_SYSTICK_MAX           (0x00FFFFFFul)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void SystemClockConfig(void);
+static void BenchSysTickConfig(void);
+static uint32_t BenchRun(uint8_t u8CicOrder);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint16_t m_au16In[BENCH_SAMPLE_NUM];
+static uint16_t m_au16Out[BENCH_OUT_NUM];
+static stc_adc_flt_t m_stcFlt;
+
+/* Results of CIC order 1 ~ 3, cycles of one run and cycles per input sample x 100.
+   __IO keeps them for the debugger at any optimization level. */
+static __IO uint32_t m_au32RunCycles[ADC_FLT_CIC_ORDER_MAX];
+static __IO uint32_t m_au32SampleCycles100[ADC_FLT_CIC_ORDER_MAX];
+/* Cycles of an empty measurement, subtracted from every run. */
+static uint32_t m_u32Overhead;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+
+/**
+ * @brief  Main function of adc_09_filter_bench project
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t i;
+    uint32_t u32Start;
+    uint32_t u32Seed = 1ul;
+
+    /* Configure the system clock to HRC32MHz. */
+    SystemClockConfig();
+
+    /* SysTick as a free-running cycle counter, no interrupt. */
+    BenchSysTickConfig();
+
+    /* 12-bit samples around mid scale with a few LSB of noise, xorshift32. */
+    for (i = 0ul; i < BENCH_SAMPLE_NUM; i++)
+    {
+        u32Seed ^= u32Seed << 13u;
+        u32Seed ^= u32Seed >> 17u;
+        u32Seed ^= u32Seed << 5u;
+        m_au16In[i] = (uint16_t)(0x800ul + (u32Seed & 0x7ul));
+    }
+
+    /***************** Configuration end, application start **************/
+
+    u32Start = SysTick->VAL;
+    m_u32Overhead = (u32Start - SysTick->VAL) & BENCH_SYSTICK_MAX;
+
+    for (i = 0ul; i < ADC_FLT_CIC_ORDER_MAX; i++)
+    {
+        m_au32RunCycles[i] = BenchRun((uint8_t)(i + 1ul));
+        m_au32SampleCycles100[i] = (m_au32RunCycles[i] * 100ul) / BENCH_SAMPLE_NUM;
+    }
+
+    /* Read m_au32SampleCycles100[] here, e.g. 2150 is 21.50 cycles per sample. */
+    __NOP();
+
+    while (1u)
+    {
+        ;
+    }
+}
+
+/**
+ * @brief  Configures a new system clock -- HRC32MHz.
+ * @param  None
+ * @retval None
+ */
+static void SystemClockConfig(void)
+{
+    /* Set EFM read latency when system clock greater than 24MHz. */
+    EFM_SetLatency(EFM_LATENCY_1);
+
+    /* Configure the system clock to HRC32MHz. */
+    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_32);
+}
+
+/**
+ * @brief  Let SysTick count HCLK down from 0xFFFFFF without interrupt.
+ * @param  None
+ * @retval None
+ */
+static void BenchSysTickConfig(void)
+{
+    SysTick->CTRL = 0ul;
+    SysTick->LOAD = BENCH_SYSTICK_MAX;
+    SysTick->VAL  = 0ul;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+/**
+ * @brief  Measure ADC_FLT_Process over BENCH_SAMPLE_NUM samples.
+ * @param  [in] u8CicOrder              CIC order, 1 ~ ADC_FLT_CIC_ORDER_MAX.
+ * @retval Cycles of the fastest run, 0 if the filter can not be initialized.
+ */
+static uint32_t BenchRun(uint8_t u8CicOrder)
+{
+    uint32_t i;
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t u32Min = BENCH_SYSTICK_MAX;
+    stc_adc_flt_cfg_t stcCfg;
+
+    ADC_FLT_StructInit(&stcCfg);
+    stcCfg.u8CicOrder   = u8CicOrder;
+    stcCfg.u8DecimShift = BENCH_DECIM_SHIFT;
+    stcCfg.u16IirAlpha  = BENCH_IIR_ALPHA;
+    if (Ok != ADC_FLT_Init(&m_stcFlt, &stcCfg))
+    {
+        u32Min = 0ul;
+    }
+    else
+    {
+        for (i = 0ul; i < BENCH_RUN_NUM; i++)
+        {
+            u32Start = SysTick->VAL;
+            (void)ADC_FLT_Process(&m_stcFlt, m_au16In, 1ul, BENCH_SAMPLE_NUM, m_au16Out);
+            /* Down counter, the difference wraps modulo 2^24. */
+            u32Cycles = ((u32Start - SysTick->VAL) & BENCH_SYSTICK_MAX) - m_u32Overhead;
+            if (u32Cycles < u32Min)
+            {
+                u32Min = u32Cycles;
+            }
+        }
+    }
+
+    return u32Min;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
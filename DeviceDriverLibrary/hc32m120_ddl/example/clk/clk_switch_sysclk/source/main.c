@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2019-06-28       chengy          First version
+   2026-10-19       chengy          Use CLK_SysclkConfig() to sequence EFM latency
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
@@ -118,6 +119,7 @@ static void WaitSw1_ShortPress(void)
 int32_t main(void)
 {
     stc_clk_xtal_init_t     stcXTALInit;
+    stc_clk_sysclk_cfg_t    stcSysclkCfg;
 
     /* Confiure clock output system clock */
     CLK_MCOConfig(CLK_MCOSOURCCE_SYSCLK, CLK_MCODIV_8);
@@ -127,8 +129,11 @@ int32_t main(void)
     /* SW1 */
     WaitSw1_ShortPress();
 
-    /* Update HRC to 32MHz */
-    CLK_HRCInit(CLK_HRC_ON, CLK_HRCFREQ_32);
+    /* Update HRC to 32MHz, EFM latency is raised before the clock speeds up */
+    CLK_SysclkStrucInit(&stcSysclkCfg);
+    stcSysclkCfg.u8SysclkSrc = CLK_SYSCLKSOURCE_HRC;
+    stcSysclkCfg.u8HrcFreq   = CLK_HRCFREQ_32;
+    CLK_SysclkConfig(&stcSysclkCfg);
 
     /* Configure XTAL */
     stcXTALInit.u8XtalState = CLK_XTAL_ON;
@@ -142,8 +147,9 @@ int32_t main(void)
     /* SW1 */
     WaitSw1_ShortPress();
 
-    /* Switch system clock from HRC(default) to XTAL */
-    CLK_SetSysclkSrc(CLK_SYSCLKSOURCE_XTAL);
+    /* Switch system clock from HRC to XTAL, EFM latency is lowered after the clock slows down */
+    stcSysclkCfg.u8SysclkSrc = CLK_SYSCLKSOURCE_XTAL;
+    CLK_SysclkConfig(&stcSysclkCfg);
 
     while(1);
 }
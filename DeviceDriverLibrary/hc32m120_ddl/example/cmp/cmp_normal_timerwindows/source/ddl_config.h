@@ -119,6 +119,25 @@ extern "C"
  */
 #define MW_LIN_ENABLE                               (MW_OFF)
 #define MW_W25QXX_ENABLE                            (MW_OFF)
+#define MW_CRC_SW_ENABLE                            (MW_OFF)
+#define MW_ADC_ACQ_ENABLE                           (MW_OFF)
+#define MW_ADC_FILTER_ENABLE                        (MW_OFF)
+#define MW_PWM_ADC_ENABLE                           (MW_OFF)
+#define MW_ADC_SV_ENABLE                            (MW_OFF)
+#define MW_ADC_CAL_ENABLE                           (MW_OFF)
+#define MW_ADC_SCHED_ENABLE                         (MW_OFF)
+#define MW_ADC_RANGE_ENABLE                         (MW_OFF)
+#define MW_SVPWM_ENABLE                             (MW_OFF)
+#define MW_SOFT_TIMER_ENABLE                        (MW_OFF)
+#define MW_TICKLESS_ENABLE                          (MW_OFF)
+#define MW_TIMEBASE_ENABLE                          (MW_OFF)
+#define MW_CAP_MEAS_ENABLE                          (MW_OFF)
+#define MW_QENC_ENABLE                              (MW_OFF)
+#define MW_WAVE_OUT_ENABLE                          (MW_OFF)
+#define MW_STEPPER_ENABLE                           (MW_OFF)
+#define MW_PWM_CALC_ENABLE                          (MW_OFF)
+#define MW_DMA_MGR_ENABLE                           (MW_OFF)
+#define MW_LLP_CHAIN_ENABLE                         (MW_OFF)
 
 /*******************************************************************************
  * Global variable definitions ('extern')
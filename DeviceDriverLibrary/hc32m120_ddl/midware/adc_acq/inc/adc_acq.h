@@ -0,0 +1,212 @@
+/**
+ *******************************************************************************
+ * @file  adc_acq.h
+ * @brief This file contains all the functions prototypes of the ADC continuous
+ *        acquisition midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __ADC_ACQ_H__
+#define __ADC_ACQ_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_ADC_ACQ
+ * @{
+ */
+
+#if (MW_ADC_ACQ_ENABLE == DDL_ON)
+
+#if (DDL_ADC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_ADC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_DMA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_DMA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Global_Types ADC_ACQ Global Types
+ * @{
+ */
+
+/**
+ * @brief Half buffer information passed to the callback.
+ * @note  The sample of pin ADC_ANIx in frame k is
+ *        pu16Data[k * u8FrameSize + (x - u8FirstPin)], the frame k was converted
+ *        at u32Timestamp + k * u32FramePeriod.
+ */
+typedef struct
+{
+    const uint16_t *pu16Data;           /*!< The filled half buffer. */
+    uint32_t u32FrameNum;               /*!< Number of frames(scans of sequence A) in the half buffer. */
+    uint32_t u32FirstFrame;             /*!< Index of the first frame since ADC_ACQ_Start(). */
+    uint32_t u32Timestamp;              /*!< Time of the first frame. */
+    uint32_t u32FramePeriod;            /*!< Time between two frames, the trigger period. */
+    uint8_t  u8FrameSize;               /*!< Number of data registers in a frame. */
+    uint8_t  u8FirstPin;                /*!< ADC pin of the first data register in a frame.
+                                             This parameter can be a value of @ref ADC_Pin_Number */
+    uint8_t  u8Half;                    /*!< 0: the first half buffer, 1: the second half buffer. */
+} stc_adc_acq_block_t;
+
+/**
+ * @brief Half buffer complete callback, called in the DMA interrupt.
+ */
+typedef void (*func_ptr_adc_acq_cb_t)(const stc_adc_acq_block_t *pstcBlock);
+
+/**
+ * @brief Time source of the timestamps, e.g. the counter of a free running timer.
+ */
+typedef uint32_t (*func_ptr_adc_acq_time_t)(void);
+
+/**
+ * @brief ADC acquisition handle structure definition
+ */
+typedef struct
+{
+    uint16_t u16Channel;                /*!< Channels of sequence A.
+                                             This parameter can be values of @ref ADC_Channels */
+    en_event_src_t enTrigEvent;         /*!< Timer event which triggers sequence A, e.g. EVT_TMRB_1_OVF,
+                                             EVT_TMRA_OVF or EVT_TMR4_SCMUH. */
+    uint8_t  u8DmaCh;                   /*!< DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1. */
+    IRQn_Type enDmaIRQn;                /*!< IRQ number of the DMA transfer complete interrupt. */
+    uint16_t *pu16Buf;                  /*!< Ping-pong buffer of 2 * u32FramePerHalf * ADC_ACQ_GetFrameSize()
+                                             half words. */
+    uint32_t u32FramePerHalf;           /*!< Frames per half buffer, 1 ~ ADC_ACQ_FRAME_PER_HALF_MAX. */
+    uint32_t u32FramePeriod;            /*!< Trigger period in unit of the time source. */
+    func_ptr_adc_acq_time_t pfnGetTime; /*!< Time source, can be NULL, then the timestamps are
+                                             u32FirstFrame * u32FramePeriod. */
+    func_ptr_adc_acq_cb_t pfnHalfCplCb; /*!< Half buffer complete callback. */
+
+    /* Internal state, set by ADC_ACQ_Init() */
+    stc_dma_llp_descriptor_t astcLlpDesc[2u];   /*!< Descriptors of the two half buffers. */
+    uint8_t  u8FrameSize;               /*!< Number of data registers in a frame. */
+    uint8_t  u8FirstPin;                /*!< ADC pin of the first data register in a frame. */
+    __IO uint8_t  u8Half;               /*!< The half buffer being filled. */
+    __IO uint32_t u32FrameCnt;          /*!< Frames completed since ADC_ACQ_Start(). */
+} stc_adc_acq_handle_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Global_Macros ADC_ACQ Global Macros
+ * @{
+ */
+#define ADC_ACQ_FRAME_PER_HALF_MAX      (1023ul)    /*!< Limited by the transfer count of DMA. */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_ACQ_Global_Functions
+ * @{
+ */
+en_result_t ADC_ACQ_Init(stc_adc_acq_handle_t *pstcHandle);
+en_result_t ADC_ACQ_Start(stc_adc_acq_handle_t *pstcHandle);
+en_result_t ADC_ACQ_Stop(const stc_adc_acq_handle_t *pstcHandle);
+uint8_t ADC_ACQ_GetFrameSize(uint16_t u16Channel);
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_ACQ_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_ACQ_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,377 @@
+/**
+ *******************************************************************************
+ * @file  adc_acq.c
+ * @brief This midware file provides the timer triggered continuous ADC
+ *        acquisition into DMA ping-pong buffers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "adc_acq.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_ADC_ACQ ADC_ACQ
+ * @brief ADC Continuous Acquisition Midware Library
+ * @{
+ */
+
+#if (MW_ADC_ACQ_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Macros ADC_ACQ Local Macros
+ * @{
+ */
+
+/* Address of the data register of the specified ADC pin. */
+#define ADC_ACQ_DR_ADDR(pin)            ((uint32_t)(&M0P_ADC->DR0) + ((uint32_t)(pin) * 2ul))
+
+/* LLP field of CHxCTL0 holds bit[11:2] of the descriptor address. */
+#define ADC_ACQ_LLP_FIELD(addr)         (((addr) & 0x00000FFCul) << (DMA_CH0CTL0_LLP_POS - 2ul))
+
+#define IS_ADC_ACQ_DMA_CH(x)                                                   \
+(   ((x) == DMA_CHANNEL_0)                      ||                             \
+    ((x) == DMA_CHANNEL_1))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void AdcAcqDmaLoad(const stc_adc_acq_handle_t *pstcHandle);
+static void AdcAcqDmaTcIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_adc_acq_handle_t *m_pstcAcqHandle = NULL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Global_Functions ADC_ACQ Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the ADC acquisition.
+ * @note   1. ADC must be initialized by ADC_Init() in mode ADC_MODE_SA_SINGLE before,
+ *            every trigger event starts one scan of sequence A(one frame).
+ *         2. At each EVT_ADC_EOCA the DMA copies the data registers from the lowest
+ *            to the highest channel of sequence A to the buffer, the two half buffers
+ *            are chained by two LLP descriptors in the handle, so the handle must be
+ *            located in SRAM and kept valid while the acquisition runs.
+ *         3. The timer of the trigger event is configured and started by the application.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_acq_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, or the channels, the buffer or
+ *                                    the frames per half buffer is invalid
+ */
+en_result_t ADC_ACQ_Init(stc_adc_acq_handle_t *pstcHandle)
+{
+    uint32_t i;
+    uint32_t u32HalfSize;
+    uint32_t u32Ctl0;
+    stc_adc_trg_cfg_t stcTrgCfg;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (NULL != pstcHandle->pu16Buf) &&
+        (0u != (pstcHandle->u16Channel & ADC_CH_ALL)) &&
+        (0ul != pstcHandle->u32FramePerHalf) &&
+        (pstcHandle->u32FramePerHalf <= ADC_ACQ_FRAME_PER_HALF_MAX))
+    {
+        DDL_ASSERT(IS_ADC_ACQ_DMA_CH(pstcHandle->u8DmaCh));
+
+        m_pstcAcqHandle = pstcHandle;
+
+        /* A frame is the span of data registers of sequence A. */
+        pstcHandle->u8FirstPin = 0u;
+        while (0u == (pstcHandle->u16Channel & (uint16_t)(1ul << pstcHandle->u8FirstPin)))
+        {
+            pstcHandle->u8FirstPin++;
+        }
+        pstcHandle->u8FrameSize = ADC_ACQ_GetFrameSize(pstcHandle->u16Channel);
+
+        /* Descriptor i fills half buffer i and links to the other one. The DMA source
+           address repeats every frame, the destination address keeps increasing. */
+        u32HalfSize = pstcHandle->u32FramePerHalf * pstcHandle->u8FrameSize;
+        u32Ctl0 = (uint32_t)pstcHandle->u8FrameSize                         |
+                  (pstcHandle->u32FramePerHalf << DMA_CH0CTL0_CNT_POS)      |
+                  DMA_LLP_ENABLE | DMA_LLP_WAIT | DMA_DATAWIDTH_16BIT;
+        for (i = 0ul; i < 2ul; i++)
+        {
+            pstcHandle->astcLlpDesc[i].SARx    = ADC_ACQ_DR_ADDR(pstcHandle->u8FirstPin);
+            pstcHandle->astcLlpDesc[i].DARx    = (uint32_t)(&pstcHandle->pu16Buf[i * u32HalfSize]);
+            pstcHandle->astcLlpDesc[i].CHxCTL0 = u32Ctl0 |
+                        ADC_ACQ_LLP_FIELD((uint32_t)(&pstcHandle->astcLlpDesc[i ^ 1ul]));
+            pstcHandle->astcLlpDesc[i].CHxCTL1 = DMA_SRCADDRINC_INC | DMA_DESADDRINC_INC |
+                        DMA_RPTNSSEL_ENABLE | DMA_RPTNSSEL_SRCRPT    |
+                        ((uint32_t)pstcHandle->u8FrameSize << DMA_CH0CTL1_RPTNSCNT_POS);
+        }
+
+        /* Enable peripheral clock */
+        CLK_FcgPeriphClockCmd(CLK_FCG_DMA | CLK_FCG_AOS, Enable);
+
+        /* Sequence A channels and the timer trigger. */
+        ADC_AddAdcChannel(ADC_SEQ_A, pstcHandle->u16Channel);
+        ADC_TriggerSrcStructInit(&stcTrgCfg);
+        stcTrgCfg.u16TrgSrc = ADC_TRGSRC_IN_EVT0;
+        stcTrgCfg.enEvent0  = pstcHandle->enTrigEvent;
+        ADC_ConfigTriggerSrc(ADC_SEQ_A, &stcTrgCfg);
+
+        /* Register DMA transfer complete IRQ handler && configure NVIC. */
+        stcIrqRegiConf.enIRQn = pstcHandle->enDmaIRQn;
+        stcIrqRegiConf.enIntSrc = (pstcHandle->u8DmaCh == DMA_CHANNEL_0) ? INT_DAM_1_TC0 : INT_DAM_2_TC0;
+        stcIrqRegiConf.pfnCallback = &AdcAcqDmaTcIrqCallback;
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the acquisition from the first half buffer.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_acq_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t ADC_ACQ_Start(stc_adc_acq_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        m_pstcAcqHandle = pstcHandle;
+        pstcHandle->u8Half = 0u;
+        pstcHandle->u32FrameCnt = 0ul;
+
+        ADC_TriggerSrcCmd(ADC_SEQ_A, Disable);
+        AdcAcqDmaLoad(pstcHandle);
+
+        DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+        DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Enable);
+        DMA_SetTriggerSrc(pstcHandle->u8DmaCh, EVT_ADC_EOCA);
+        DMA_ChannelEnable(pstcHandle->u8DmaCh);
+        DMA_Cmd(Enable);
+
+        ADC_TriggerSrcCmd(ADC_SEQ_A, Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the acquisition, the partly filled half buffer is discarded.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_acq_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Stop success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t ADC_ACQ_Stop(const stc_adc_acq_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        ADC_TriggerSrcCmd(ADC_SEQ_A, Disable);
+        DMA_ChannelDisable(pstcHandle->u8DmaCh);
+        DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Disable);
+        DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the number of data registers in a frame.
+ * @param  [in] u16Channel              Channels of sequence A.
+ * @retval Number of data registers from the lowest to the highest channel, 0 if no channel.
+ */
+uint8_t ADC_ACQ_GetFrameSize(uint16_t u16Channel)
+{
+    uint8_t u8First = 0u;
+    uint8_t u8Last  = ADC_CH_COUNT;
+    uint8_t u8Size  = 0u;
+
+    u16Channel &= ADC_CH_ALL;
+    if (0u != u16Channel)
+    {
+        while (0u == (u16Channel & (uint16_t)(1ul << u8First)))
+        {
+            u8First++;
+        }
+        while (0u == (u16Channel & (uint16_t)(1ul << (u8Last - 1u))))
+        {
+            u8Last--;
+        }
+        u8Size = u8Last - u8First;
+    }
+
+    return u8Size;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_ACQ_Local_Functions ADC_ACQ Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Load the descriptor of the first half buffer into the DMA channel.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_acq_handle_t structure
+ * @retval None
+ */
+static void AdcAcqDmaLoad(const stc_adc_acq_handle_t *pstcHandle)
+{
+    stc_dma_ch_cfg_t stcDmaCfg;
+
+    DMA_ChannelDisable(pstcHandle->u8DmaCh);
+
+    stcDmaCfg.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+    stcDmaCfg.u32BlockSize   = pstcHandle->u8FrameSize;
+    stcDmaCfg.u32TransferCnt = pstcHandle->u32FramePerHalf;
+    stcDmaCfg.u32SrcAddr     = pstcHandle->astcLlpDesc[0u].SARx;
+    stcDmaCfg.u32DesAddr     = pstcHandle->astcLlpDesc[0u].DARx;
+    stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_INC;
+    stcDmaCfg.u32DesInc      = DMA_DESADDRINC_INC;
+    DMA_ChannelCfg(pstcHandle->u8DmaCh, &stcDmaCfg);
+    DMA_RepeatInit(pstcHandle->u8DmaCh, DMA_RPTNSSEL_SRCRPT, pstcHandle->u8FrameSize);
+    DMA_LlpInit(pstcHandle->u8DmaCh, DMA_LLP_WAIT, (uint32_t)(&pstcHandle->astcLlpDesc[1u]));
+}
+
+/**
+ * @brief  DMA transfer complete IRQ callback, a half buffer is filled.
+ * @param  None
+ * @retval None
+ */
+static void AdcAcqDmaTcIrqCallback(void)
+{
+    stc_adc_acq_block_t stcBlock;
+    stc_adc_acq_handle_t *pstcHandle = m_pstcAcqHandle;
+
+    DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC);
+
+    stcBlock.u8Half         = pstcHandle->u8Half;
+    stcBlock.u8FrameSize    = pstcHandle->u8FrameSize;
+    stcBlock.u8FirstPin     = pstcHandle->u8FirstPin;
+    stcBlock.u32FrameNum    = pstcHandle->u32FramePerHalf;
+    stcBlock.u32FirstFrame  = pstcHandle->u32FrameCnt;
+    stcBlock.u32FramePeriod = pstcHandle->u32FramePeriod;
+    stcBlock.pu16Data       = &pstcHandle->pu16Buf[(uint32_t)pstcHandle->u8Half *
+                                                   pstcHandle->u32FramePerHalf *
+                                                   pstcHandle->u8FrameSize];
+    if (NULL != pstcHandle->pfnGetTime)
+    {
+        /* The last frame of the half buffer has just been converted. */
+        stcBlock.u32Timestamp = pstcHandle->pfnGetTime() -
+                                ((pstcHandle->u32FramePerHalf - 1ul) * pstcHandle->u32FramePeriod);
+    }
+    else
+    {
+        stcBlock.u32Timestamp = stcBlock.u32FirstFrame * pstcHandle->u32FramePeriod;
+    }
+
+    pstcHandle->u32FrameCnt += pstcHandle->u32FramePerHalf;
+    pstcHandle->u8Half ^= 1u;
+
+    if (NULL != pstcHandle->pfnHalfCplCb)
+    {
+        pstcHandle->pfnHalfCplCb(&stcBlock);
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_ACQ_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
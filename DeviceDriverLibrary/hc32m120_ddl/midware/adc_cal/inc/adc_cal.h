@@ -0,0 +1,212 @@
+/**
+ *******************************************************************************
+ * @file  adc_cal.h
+ * @brief This file contains all the functions prototypes of the ADC calibrated
+ *        conversion midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __ADC_CAL_H__
+#define __ADC_CAL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#if defined (ADC_CAL_HOST)
+#include <stdint.h>
+#include <stddef.h>
+#else
+#include "hc32_ddl.h"
+#endif /* ADC_CAL_HOST */
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_ADC_CAL
+ * @{
+ */
+
+#if defined (ADC_CAL_HOST) || (MW_ADC_CAL_ENABLE == DDL_ON)
+
+#if !defined (ADC_CAL_HOST)
+#if (DDL_ADC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_ADC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_PWC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_PWC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+#endif /* ADC_CAL_HOST */
+
+/* Channels of the channel table, one per ADC pin. */
+#define ADC_CAL_CH_MAX                  (12u)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_CAL_Global_Types ADC_CAL Global Types
+ * @{
+ */
+
+#if defined (ADC_CAL_HOST)
+/**
+ * @brief Result of the host build, same values as hc32_common.h
+ */
+typedef enum
+{
+    Ok                       = 0u,
+    ErrorInvalidParameter    = 4u,
+} en_result_t;
+#endif /* ADC_CAL_HOST */
+
+/**
+ * @brief Linear conversion of a channel from the input voltage to the output unit.
+ * @note  out = (mV * i32Gain) / 65536 + i32Offset, the full scale output must stay
+ *        within +-16383 units(e.g. 16383mV), e.g.
+ *        - pin voltage in mV:                 i32Gain = ADC_CAL_GAIN_ONE, i32Offset = 0;
+ *        - voltage before a 1/3 divider:      i32Gain = 3 * ADC_CAL_GAIN_ONE;
+ *        - temperature sensor in 0.1 degree:  t = 250 - (mV - 1030) / 0.35,
+ *                                             i32Gain = ADC_CAL_GAIN(-1.0 / 0.35), i32Offset = 3193.
+ */
+typedef struct
+{
+    int32_t i32Gain;            /*!< Output units per mV, Q16. */
+    int32_t i32Offset;          /*!< Output at 0mV, -16384 ~ 16383. */
+} stc_adc_cal_ch_t;
+
+/**
+ * @brief ADC calibration structure definition
+ */
+typedef struct
+{
+    uint8_t  u8ResBits;         /*!< ADC resolution in bits, 8, 10 or 12. */
+    uint16_t u16RefMv;          /*!< Voltage of the internal reference(VINREF) in mV, from the datasheet
+                                     or measured once in production. */
+    const stc_adc_cal_ch_t *pstcCh; /*!< Channel table. */
+    uint8_t  u8ChNum;           /*!< Number of channels in the table, 1 ~ ADC_CAL_CH_MAX. */
+
+    /* Internal state, set by ADC_CAL_Init() and ADC_CAL_UpdateRef() */
+    uint16_t u16VddMv;                      /*!< Current VREFH(VDD) in mV. */
+    int32_t  ai32Scale[ADC_CAL_CH_MAX];     /*!< Output units per count, Q16. */
+    int32_t  ai32Offset[ADC_CAL_CH_MAX];    /*!< Output offset, Q16 with the rounding half. */
+} stc_adc_cal_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_CAL_Global_Macros ADC_CAL Global Macros
+ * @{
+ */
+
+/* 1.0 in Q16 */
+#define ADC_CAL_GAIN_ONE                (65536l)
+
+/* Q16 gain from a constant floating expression, evaluated by the compiler. */
+#define ADC_CAL_GAIN(x)                 ((int32_t)(((x) * 65536.0) + (((x) >= 0.0) ? 0.5 : -0.5)))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_CAL_Global_Functions
+ * @{
+ */
+en_result_t ADC_CAL_Init(stc_adc_cal_t *pstcCal, uint16_t u16VddMv);
+en_result_t ADC_CAL_UpdateRef(stc_adc_cal_t *pstcCal, uint16_t u16RefVal);
+uint16_t ADC_CAL_GetVdd(const stc_adc_cal_t *pstcCal);
+void ADC_CAL_Convert(const stc_adc_cal_t *pstcCal, uint8_t u8Index,
+                     const uint16_t *pu16In, uint32_t u32Stride,
+                     int32_t *pi32Out, uint32_t u32Num);
+#if !defined (ADC_CAL_HOST)
+void ADC_CAL_SelectInternal(uint8_t u8PwrMonSel);
+#endif /* ADC_CAL_HOST */
+/**
+ * @}
+ */
+
+#endif /* ADC_CAL_HOST || MW_ADC_CAL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_CAL_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
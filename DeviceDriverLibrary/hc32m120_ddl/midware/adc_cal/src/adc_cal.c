@@ -0,0 +1,333 @@
+/**
+ *******************************************************************************
+ * @file  adc_cal.c
+ * @brief This midware file provides firmware functions to convert ADC samples
+ *        to engineering units with integer arithmetic.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "adc_cal.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_ADC_CAL ADC_CAL
+ * @brief ADC Calibrated Conversion Midware Library
+ * @{
+ */
+
+#if defined (ADC_CAL_HOST) || (MW_ADC_CAL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_CAL_Local_Macros ADC_CAL Local Macros
+ * @{
+ */
+
+#define IS_ADC_CAL_RES_BITS(x)                                                 \
+(   ((x) == 8u)                                 ||                             \
+    ((x) == 10u)                                ||                             \
+    ((x) == 12u))
+
+/* VREFH range accepted from the reference measurement. */
+#define ADC_CAL_VDD_MIN                 (1000ul)
+#define ADC_CAL_VDD_MAX                 (6000ul)
+
+/* count * scale and the offset are each kept below 2^30, their sum fits in 32 bits. */
+#define ADC_CAL_SCALE_MAX(bits)         (0x3FFF0000l >> (bits))
+#define ADC_CAL_OFFSET_MAX              (16383l)
+#define ADC_CAL_OFFSET_MIN              (-16384l)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static en_result_t AdcCalPrecompute(stc_adc_cal_t *pstcCal, uint16_t u16VddMv);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_CAL_Global_Functions ADC_CAL Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the calibration with a nominal VREFH.
+ * @param  [in] pstcCal                 Pointer to a @ref stc_adc_cal_t structure
+ * @param  [in] u16VddMv                Nominal VREFH(VDD) in mV, used until the first
+ *                                      call of ADC_CAL_UpdateRef().
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcCal == NULL, the channel table is invalid, or
+ *                                    a channel gain overflows the conversion
+ */
+en_result_t ADC_CAL_Init(stc_adc_cal_t *pstcCal, uint16_t u16VddMv)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCal) && (NULL != pstcCal->pstcCh) &&
+        (0u != pstcCal->u8ChNum) && (pstcCal->u8ChNum <= ADC_CAL_CH_MAX) &&
+        (IS_ADC_CAL_RES_BITS(pstcCal->u8ResBits)))
+    {
+        enRet = AdcCalPrecompute(pstcCal, u16VddMv);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Track VREFH with a conversion of the internal reference.
+ * @note   1. VDD = u16RefMv * 2^u8ResBits / u16RefVal, the scales of all channels are
+ *            computed again. This is the only division of the module, call it at the
+ *            rate VDD may drift, e.g. every 100ms from a housekeeping scan.
+ *         2. Averaging several reference conversions(adc_filter) before improves the result.
+ * @param  [in] pstcCal                 Pointer to a @ref stc_adc_cal_t structure
+ * @param  [in] u16RefVal               Conversion value of the internal reference.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Update success
+ *           - ErrorInvalidParameter: pstcCal == NULL or VDD out of range, the former
+ *                                    scales are kept
+ */
+en_result_t ADC_CAL_UpdateRef(stc_adc_cal_t *pstcCal, uint16_t u16RefVal)
+{
+    uint32_t u32VddMv;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCal) && (0u != u16RefVal))
+    {
+        u32VddMv = (((uint32_t)pstcCal->u16RefMv << pstcCal->u8ResBits) + ((uint32_t)u16RefVal >> 1u)) /
+                   (uint32_t)u16RefVal;
+        if ((u32VddMv >= ADC_CAL_VDD_MIN) && (u32VddMv <= ADC_CAL_VDD_MAX))
+        {
+            enRet = AdcCalPrecompute(pstcCal, (uint16_t)u32VddMv);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the current VREFH.
+ * @param  [in] pstcCal                 Pointer to a @ref stc_adc_cal_t structure
+ * @retval VREFH(VDD) in mV, 0 if pstcCal == NULL.
+ */
+uint16_t ADC_CAL_GetVdd(const stc_adc_cal_t *pstcCal)
+{
+    uint16_t u16VddMv = 0u;
+
+    if (NULL != pstcCal)
+    {
+        u16VddMv = pstcCal->u16VddMv;
+    }
+
+    return u16VddMv;
+}
+
+/**
+ * @brief  Convert a block of samples of a channel.
+ * @note   out = (in * scale + offset) >> 16, one multiply, one add and one shift per
+ *         sample. Interleaved frames(adc_acq) are converted with u32Stride = frame size.
+ * @param  [in] pstcCal                 Pointer to a @ref stc_adc_cal_t structure
+ * @param  [in] u8Index                 Index of the channel in the channel table.
+ * @param  [in] pu16In                  Pointer to the first sample.
+ * @param  [in] u32Stride               Distance between two samples of the channel, >= 1.
+ * @param  [out] pi32Out                Pointer to the output buffer, u32Num values.
+ * @param  [in] u32Num                  Number of samples.
+ * @retval None
+ */
+void ADC_CAL_Convert(const stc_adc_cal_t *pstcCal, uint8_t u8Index,
+                     const uint16_t *pu16In, uint32_t u32Stride,
+                     int32_t *pi32Out, uint32_t u32Num)
+{
+    int32_t i32Scale;
+    int32_t i32Offset;
+
+    if ((NULL != pstcCal) && (u8Index < pstcCal->u8ChNum) &&
+        (NULL != pu16In) && (NULL != pi32Out) && (0ul != u32Stride))
+    {
+        i32Scale  = pstcCal->ai32Scale[u8Index];
+        i32Offset = pstcCal->ai32Offset[u8Index];
+
+        while (u32Num >= 4ul)
+        {
+            pi32Out[0u] = ((int32_t)pu16In[0u] * i32Scale + i32Offset) >> 16u;
+            pu16In += u32Stride;
+            pi32Out[1u] = ((int32_t)pu16In[0u] * i32Scale + i32Offset) >> 16u;
+            pu16In += u32Stride;
+            pi32Out[2u] = ((int32_t)pu16In[0u] * i32Scale + i32Offset) >> 16u;
+            pu16In += u32Stride;
+            pi32Out[3u] = ((int32_t)pu16In[0u] * i32Scale + i32Offset) >> 16u;
+            pu16In += u32Stride;
+            pi32Out += 4u;
+            u32Num  -= 4ul;
+        }
+        while (u32Num > 0ul)
+        {
+            *pi32Out++ = ((int32_t)pu16In[0u] * i32Scale + i32Offset) >> 16u;
+            pu16In += u32Stride;
+            u32Num--;
+        }
+    }
+}
+
+#if !defined (ADC_CAL_HOST)
+/**
+ * @brief  Connect an internal source to the extended channel(ADC_CH11).
+ * @note   The internal reference and the temperature sensor share the extended channel,
+ *         ADC_CH11 is added to a sequence by the application.
+ * @param  [in] u8PwrMonSel             Internal source.
+ *   @arg  PWC_PWRMON_VINREF:           Internal reference voltage, for ADC_CAL_UpdateRef().
+ *   @arg  PWC_PWRMON_VOTS:             Temperature sensor.
+ * @retval None
+ */
+void ADC_CAL_SelectInternal(uint8_t u8PwrMonSel)
+{
+    stc_pwc_pwrmon_init_t stcPwrMonInit;
+
+    stcPwrMonInit.u8PwrMonEn  = PWC_PWRMON_ON;
+    stcPwrMonInit.u8PwrMonSel = u8PwrMonSel;
+    (void)PWC_PwrMonInit(&stcPwrMonInit);
+
+    ADC_SetExChannel(ADC_EX_CH_SEL_INTERNAL);
+}
+#endif /* ADC_CAL_HOST */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_CAL_Local_Functions ADC_CAL Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Compute the Q16 scale and offset of all channels for a VREFH.
+ * @param  [in] pstcCal                 Pointer to a @ref stc_adc_cal_t structure
+ * @param  [in] u16VddMv                VREFH(VDD) in mV.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: A scale overflows the conversion, nothing changed
+ */
+static en_result_t AdcCalPrecompute(stc_adc_cal_t *pstcCal, uint16_t u16VddMv)
+{
+    uint8_t i;
+    int64_t i64Scale;
+    int32_t ai32Scale[ADC_CAL_CH_MAX];
+    en_result_t enRet = Ok;
+
+    for (i = 0u; i < pstcCal->u8ChNum; i++)
+    {
+        /* mV per count is VDD / 2^bits, so scale = VDD * gain / 2^bits in Q16. */
+        i64Scale = (int64_t)u16VddMv * (int64_t)pstcCal->pstcCh[i].i32Gain;
+        i64Scale = (i64Scale + (1ll << (pstcCal->u8ResBits - 1u))) >> pstcCal->u8ResBits;
+        if ((i64Scale > (int64_t)ADC_CAL_SCALE_MAX(pstcCal->u8ResBits)) ||
+            (i64Scale < -(int64_t)ADC_CAL_SCALE_MAX(pstcCal->u8ResBits)) ||
+            (pstcCal->pstcCh[i].i32Offset > ADC_CAL_OFFSET_MAX) ||
+            (pstcCal->pstcCh[i].i32Offset < ADC_CAL_OFFSET_MIN))
+        {
+            enRet = ErrorInvalidParameter;
+            break;
+        }
+        ai32Scale[i] = (int32_t)i64Scale;
+    }
+
+    if (Ok == enRet)
+    {
+        for (i = 0u; i < pstcCal->u8ChNum; i++)
+        {
+            pstcCal->ai32Scale[i]  = ai32Scale[i];
+            pstcCal->ai32Offset[i] = (int32_t)((uint32_t)pstcCal->pstcCh[i].i32Offset << 16u) + 0x8000l;
+        }
+        pstcCal->u16VddMv = u16VddMv;
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+#endif /* ADC_CAL_HOST || MW_ADC_CAL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
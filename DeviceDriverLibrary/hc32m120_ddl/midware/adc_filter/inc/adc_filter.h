@@ -0,0 +1,197 @@
+/**
+ *******************************************************************************
+ * @file  adc_filter.h
+ * @brief This file contains all the functions prototypes of the ADC fixed-point
+ *        oversampling and decimation filter midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __ADC_FILTER_H__
+#define __ADC_FILTER_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#if defined (ADC_FILTER_HOST)
+#include <stdint.h>
+#include <stddef.h>
+#else
+#include "hc32_ddl.h"
+#endif /* ADC_FILTER_HOST */
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_ADC_FILTER
+ * @{
+ */
+
+#if defined (ADC_FILTER_HOST) || (MW_ADC_FILTER_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_FLT_Global_Types ADC_FLT Global Types
+ * @{
+ */
+
+#if defined (ADC_FILTER_HOST)
+/**
+ * @brief Result of the host build, same values as hc32_common.h
+ */
+typedef enum
+{
+    Ok                       = 0u,
+    ErrorInvalidParameter    = 4u,
+} en_result_t;
+#endif /* ADC_FILTER_HOST */
+
+/**
+ * @brief ADC filter configuration structure definition
+ * @note  The decimation ratio(OSR) is 2^u8DecimShift, every 4 times of oversampling
+ *        gives 1 more effective bit when the input noise is at least 1 LSB:
+ *        u8DecimShift = 2 for 13 bits and u8DecimShift = 4 for 14 bits from 12 bits.
+ */
+typedef struct
+{
+    uint8_t  u8InBits;          /*!< Bits of the input samples, 8, 10 or 12(ADC_RESOLUTION_12B). */
+    uint8_t  u8CicOrder;        /*!< 1: boxcar average, 2 ~ ADC_FLT_CIC_ORDER_MAX: CIC decimator. */
+    uint8_t  u8DecimShift;      /*!< log2 of the decimation ratio, 0 ~ 8. 0: no decimation. */
+    uint8_t  u8OutBits;         /*!< Bits of the output samples, u8InBits ~ 15. */
+    uint16_t u16IirAlpha;       /*!< Q15 coefficient of the single-pole IIR after the decimator,
+                                     y += alpha * (x - y). 0: IIR bypassed. */
+} stc_adc_flt_cfg_t;
+
+/**
+ * @brief ADC filter state structure definition, one per channel
+ */
+typedef struct
+{
+    uint32_t au32Integ[3u];     /*!< Integrators, modulo 2^32. */
+    uint32_t au32Comb[3u];      /*!< Delay lines of the combs. */
+    uint32_t u32Phase;          /*!< Input samples of the current output. */
+    int32_t  i32IirState;       /*!< IIR output with 15 fractional bits. */
+    uint16_t u16IirAlpha;       /*!< Q15 IIR coefficient. */
+    uint8_t  u8CicOrder;        /*!< CIC order. */
+    uint8_t  u8DecimShift;      /*!< log2 of the decimation ratio. */
+    uint8_t  u8OutShift;        /*!< Right shift from the decimator gain to the output bits. */
+    uint8_t  u8IirPrimed;       /*!< The IIR state holds a sample. */
+} stc_adc_flt_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_FLT_Global_Macros ADC_FLT Global Macros
+ * @{
+ */
+#define ADC_FLT_CIC_ORDER_MAX           (3u)
+#define ADC_FLT_DECIM_SHIFT_MAX         (8u)
+#define ADC_FLT_OUT_BITS_MAX            (15u)
+
+/* Convert an output sample of u8Bits bits to Q15(0 ~ 1 - 2^-15 of the full scale). */
+#define ADC_FLT_TO_Q15(u16Val, u8Bits)  ((int16_t)(uint16_t)((uint32_t)(u16Val) << (15u - (uint32_t)(u8Bits))))
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_FLT_Global_Functions
+ * @{
+ */
+en_result_t ADC_FLT_StructInit(stc_adc_flt_cfg_t *pstcCfg);
+en_result_t ADC_FLT_Init(stc_adc_flt_t *pstcFlt, const stc_adc_flt_cfg_t *pstcCfg);
+void ADC_FLT_Reset(stc_adc_flt_t *pstcFlt);
+uint32_t ADC_FLT_Process(stc_adc_flt_t *pstcFlt,
+                         const uint16_t *pu16In,
+                         uint32_t u32Stride,
+                         uint32_t u32Num,
+                         uint16_t *pu16Out);
+/**
+ * @}
+ */
+
+#endif /* ADC_FILTER_HOST || MW_ADC_FILTER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_FILTER_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,355 @@
+/**
+ *******************************************************************************
+ * @file  adc_filter.c
+ * @brief This midware file provides the fixed-point oversampling, decimation
+ *        and smoothing filters for blocks of ADC samples.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "adc_filter.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_ADC_FILTER ADC_FILTER
+ * @brief ADC Oversampling Filter Midware Library
+ * @{
+ */
+
+#if defined (ADC_FILTER_HOST) || (MW_ADC_FILTER_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_FLT_Local_Macros ADC_FLT Local Macros
+ * @{
+ */
+
+/* The integrators wrap modulo 2^32, the decimator gain must fit in 32 bits. */
+#define ADC_FLT_ACC_BITS                (32u)
+
+/* Fractional bits of the IIR state. */
+#define ADC_FLT_IIR_FRAC_BITS           (15u)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint16_t AdcFltIir(stc_adc_flt_t *pstcFlt, uint32_t u32In);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_FLT_Global_Functions ADC_FLT Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the default configuration: 12-bit input, boxcar average of 16 samples,
+ *         14-bit output, IIR bypassed.
+ * @param  [out] pstcCfg                Pointer to a @ref stc_adc_flt_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: No error occurred
+ *           - ErrorInvalidParameter: pstcCfg == NULL
+ */
+en_result_t ADC_FLT_StructInit(stc_adc_flt_cfg_t *pstcCfg)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcCfg)
+    {
+        pstcCfg->u8InBits     = 12u;
+        pstcCfg->u8CicOrder   = 1u;
+        pstcCfg->u8DecimShift = 4u;
+        pstcCfg->u8OutBits    = 14u;
+        pstcCfg->u16IirAlpha  = 0u;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a filter.
+ * @param  [out] pstcFlt                Pointer to a @ref stc_adc_flt_t structure
+ * @param  [in]  pstcCfg                Pointer to a @ref stc_adc_flt_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: No error occurred
+ *           - ErrorInvalidParameter: A pointer is NULL, a member of pstcCfg is out of range,
+ *                                    u8OutBits is more than the decimator gives, or the
+ *                                    decimator gain does not fit in 32 bits
+ */
+en_result_t ADC_FLT_Init(stc_adc_flt_t *pstcFlt, const stc_adc_flt_cfg_t *pstcCfg)
+{
+    uint32_t u32GainBits;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcFlt) && (NULL != pstcCfg) &&
+        (0u != pstcCfg->u8CicOrder) && (pstcCfg->u8CicOrder <= ADC_FLT_CIC_ORDER_MAX) &&
+        (pstcCfg->u8DecimShift <= ADC_FLT_DECIM_SHIFT_MAX) &&
+        (pstcCfg->u8OutBits >= pstcCfg->u8InBits) && (pstcCfg->u8OutBits <= ADC_FLT_OUT_BITS_MAX) &&
+        (pstcCfg->u16IirAlpha <= 0x8000u))
+    {
+        /* The CIC gain is R^N, the output has u8InBits + N * log2(R) bits. */
+        u32GainBits = (uint32_t)pstcCfg->u8InBits +
+                      ((uint32_t)pstcCfg->u8CicOrder * (uint32_t)pstcCfg->u8DecimShift);
+        if ((u32GainBits <= ADC_FLT_ACC_BITS) && (u32GainBits >= (uint32_t)pstcCfg->u8OutBits))
+        {
+            pstcFlt->u8CicOrder   = pstcCfg->u8CicOrder;
+            pstcFlt->u8DecimShift = pstcCfg->u8DecimShift;
+            pstcFlt->u8OutShift   = (uint8_t)(u32GainBits - (uint32_t)pstcCfg->u8OutBits);
+            pstcFlt->u16IirAlpha  = pstcCfg->u16IirAlpha;
+            ADC_FLT_Reset(pstcFlt);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Clear the state of a filter, the configuration is kept.
+ * @param  [in]  pstcFlt                Pointer to a @ref stc_adc_flt_t structure
+ * @retval None
+ */
+void ADC_FLT_Reset(stc_adc_flt_t *pstcFlt)
+{
+    uint32_t i;
+
+    if (NULL != pstcFlt)
+    {
+        for (i = 0ul; i < ADC_FLT_CIC_ORDER_MAX; i++)
+        {
+            pstcFlt->au32Integ[i] = 0ul;
+            pstcFlt->au32Comb[i]  = 0ul;
+        }
+        pstcFlt->u32Phase    = 0ul;
+        pstcFlt->i32IirState = 0;
+        pstcFlt->u8IirPrimed = 0u;
+    }
+}
+
+/**
+ * @brief  Filter a block of samples of one channel.
+ * @note   1. The filter keeps its state between calls, the block can end at any phase
+ *            of the decimation.
+ *         2. Interleaved samples of several channels(e.g. a half buffer of adc_acq) are
+ *            read with u32Stride, pu16In points to the first sample of the channel and
+ *            u32Stride is the number of samples per frame.
+ *         3. Only additions, shifts and one 16 x 16 bit multiplication per IIR output are
+ *            used, no division.
+ *         4. The first CIC_ORDER outputs of a CIC(order >= 2) are transients.
+ * @param  [in]  pstcFlt                Pointer to a @ref stc_adc_flt_t structure
+ * @param  [in]  pu16In                 Pointer to the first input sample.
+ * @param  [in]  u32Stride              Distance between two input samples in half words, 1 for a
+ *                                      buffer of one channel.
+ * @param  [in]  u32Num                 Number of input samples.
+ * @param  [out] pu16Out                Pointer to the output buffer, it must hold
+ *                                      (u32Num >> u8DecimShift) + 1 samples.
+ * @retval Number of output samples.
+ */
+uint32_t ADC_FLT_Process(stc_adc_flt_t *pstcFlt,
+                         const uint16_t *pu16In,
+                         uint32_t u32Stride,
+                         uint32_t u32Num,
+                         uint16_t *pu16Out)
+{
+    uint32_t i;
+    uint32_t u32Acc;
+    uint32_t u32Tmp;
+    uint32_t u32Phase;
+    uint32_t u32Ratio;
+    uint32_t u32OutCnt = 0ul;
+
+    if ((NULL != pstcFlt) && (NULL != pu16In) && (NULL != pu16Out))
+    {
+        u32Ratio = 1ul << pstcFlt->u8DecimShift;
+        u32Phase = pstcFlt->u32Phase;
+
+        if (1u == pstcFlt->u8CicOrder)
+        {
+            /* Boxcar: sum u32Ratio samples and dump, no comb is needed. */
+            u32Acc = pstcFlt->au32Integ[0u];
+            while (0ul != u32Num)
+            {
+                u32Acc += (uint32_t)*pu16In;
+                pu16In += u32Stride;
+                u32Num--;
+                u32Phase++;
+                if (u32Phase == u32Ratio)
+                {
+                    pu16Out[u32OutCnt] = AdcFltIir(pstcFlt, u32Acc >> pstcFlt->u8OutShift);
+                    u32OutCnt++;
+                    u32Acc   = 0ul;
+                    u32Phase = 0ul;
+                }
+            }
+            pstcFlt->au32Integ[0u] = u32Acc;
+        }
+        else
+        {
+            while (0ul != u32Num)
+            {
+                /* Integrators run at the input rate. */
+                pstcFlt->au32Integ[0u] += (uint32_t)*pu16In;
+                for (i = 1ul; i < pstcFlt->u8CicOrder; i++)
+                {
+                    pstcFlt->au32Integ[i] += pstcFlt->au32Integ[i - 1ul];
+                }
+                pu16In += u32Stride;
+                u32Num--;
+                u32Phase++;
+
+                /* Combs run at the output rate. */
+                if (u32Phase == u32Ratio)
+                {
+                    u32Acc = pstcFlt->au32Integ[pstcFlt->u8CicOrder - 1u];
+                    for (i = 0ul; i < pstcFlt->u8CicOrder; i++)
+                    {
+                        u32Tmp = u32Acc;
+                        u32Acc -= pstcFlt->au32Comb[i];
+                        pstcFlt->au32Comb[i] = u32Tmp;
+                    }
+                    pu16Out[u32OutCnt] = AdcFltIir(pstcFlt, u32Acc >> pstcFlt->u8OutShift);
+                    u32OutCnt++;
+                    u32Phase = 0ul;
+                }
+            }
+        }
+
+        pstcFlt->u32Phase = u32Phase;
+    }
+
+    return u32OutCnt;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_FLT_Local_Functions ADC_FLT Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Single-pole IIR smoothing of a decimated sample.
+ * @note   The state is the output with 15 fractional bits(< 2^30 for 15-bit output),
+ *         alpha * (x - y) is done as two 15 x 16 bit products to stay within 32 bits.
+ * @param  [in]  pstcFlt                Pointer to a @ref stc_adc_flt_t structure
+ * @param  [in]  u32In                  The decimated sample.
+ * @retval The filtered sample.
+ */
+static uint16_t AdcFltIir(stc_adc_flt_t *pstcFlt, uint32_t u32In)
+{
+    int32_t i32Diff;
+    int32_t i32Alpha;
+    uint16_t u16Out = (uint16_t)u32In;
+
+    if (0u != pstcFlt->u16IirAlpha)
+    {
+        if (0u == pstcFlt->u8IirPrimed)
+        {
+            /* Start from the first sample instead of ramping up from 0. */
+            pstcFlt->i32IirState = (int32_t)(u32In << ADC_FLT_IIR_FRAC_BITS);
+            pstcFlt->u8IirPrimed = 1u;
+        }
+        else
+        {
+            i32Alpha = (int32_t)pstcFlt->u16IirAlpha;
+            i32Diff  = (int32_t)(u32In << ADC_FLT_IIR_FRAC_BITS) - pstcFlt->i32IirState;
+            pstcFlt->i32IirState += ((i32Diff >> 15) * i32Alpha) +
+                                    (((i32Diff & 0x7FFF) * i32Alpha) >> 15);
+        }
+        u16Out = (uint16_t)((uint32_t)(pstcFlt->i32IirState + (1L << (ADC_FLT_IIR_FRAC_BITS - 1u)))
+                            >> ADC_FLT_IIR_FRAC_BITS);
+    }
+
+    return u16Out;
+}
+
+/**
+ * @}
+ */
+
+#endif /* ADC_FILTER_HOST || MW_ADC_FILTER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,180 @@
+/**
+ *******************************************************************************
+ * @file  adc_filter_bench.c
+ * @brief Host benchmark of the ADC filter midware, the time per input sample of
+ *        ADC_FLT_Process() with the configuration of the target example
+ *        adc/adc_09_filter_bench: 12-bit input, OSR 16, 14-bit output, IIR on.
+ @verbatim
+   Build and run on the host from the directory hc32m120_ddl:
+     gcc -std=c99 -O2 -DADC_FILTER_HOST -Imidware/adc_filter/inc
+         midware/adc_filter/test/adc_filter_bench.c midware/adc_filter/src/adc_filter.c
+         -o adc_filter_bench
+     ./adc_filter_bench
+   Prints ns per input sample of CIC order 1 ~ 3, the fastest of BENCH_RUN_NUM
+   runs. The exit code is not 0 if a filter can not be initialized.
+
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <time.h>
+#include "adc_filter.h"
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Same block and configuration as the target example. */
+#define BENCH_SAMPLE_NUM                (256u)
+#define BENCH_DECIM_SHIFT               (4u)
+#define BENCH_OUT_NUM                   ((BENCH_SAMPLE_NUM >> BENCH_DECIM_SHIFT) + 1u)
+#define BENCH_IIR_ALPHA                 (0x1000u)
+
+/* Blocks of one run, long enough for the resolution of the clock. */
+#define BENCH_BLOCK_NUM                 (20000u)
+#define BENCH_RUN_NUM                   (8u)
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint16_t m_au16In[BENCH_SAMPLE_NUM];
+static uint16_t m_au16Out[BENCH_OUT_NUM];
+static stc_adc_flt_t m_stcFlt;
+/* Sum of the outputs, keeps the calls from being optimized away. */
+static volatile uint32_t m_u32Sink;
+
+/*******************************************************************************
+ * Function implementation - local ('static')
+ ******************************************************************************/
+static double BenchNow(void)
+{
+    struct timespec stcTs;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &stcTs);
+    return ((double)stcTs.tv_sec * 1e9) + (double)stcTs.tv_nsec;
+}
+
+/* ns per input sample of the fastest run, < 0 if the filter can not be initialized. */
+static double BenchRun(uint8_t u8CicOrder)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t u32Sum;
+    double dStart;
+    double dNs;
+    double dMin = -1.0;
+    stc_adc_flt_cfg_t stcCfg;
+
+    (void)ADC_FLT_StructInit(&stcCfg);
+    stcCfg.u8CicOrder   = u8CicOrder;
+    stcCfg.u8DecimShift = BENCH_DECIM_SHIFT;
+    stcCfg.u16IirAlpha  = BENCH_IIR_ALPHA;
+    if (Ok == ADC_FLT_Init(&m_stcFlt, &stcCfg))
+    {
+        for (i = 0ul; i < BENCH_RUN_NUM; i++)
+        {
+            u32Sum = 0ul;
+            dStart = BenchNow();
+            for (j = 0ul; j < BENCH_BLOCK_NUM; j++)
+            {
+                (void)ADC_FLT_Process(&m_stcFlt, m_au16In, 1ul, BENCH_SAMPLE_NUM, m_au16Out);
+                u32Sum += m_au16Out[0u];
+            }
+            dNs = (BenchNow() - dStart) / ((double)BENCH_BLOCK_NUM * (double)BENCH_SAMPLE_NUM);
+            m_u32Sink += u32Sum;
+            if ((dMin < 0.0) || (dNs < dMin))
+            {
+                dMin = dNs;
+            }
+        }
+    }
+
+    return dMin;
+}
+
+/*******************************************************************************
+ * Function implementation - global ('extern')
+ ******************************************************************************/
+int main(void)
+{
+    uint32_t i;
+    uint32_t u32Seed = 1ul;
+    double dNs;
+    int iFails = 0;
+
+    /* 12-bit samples around mid scale with a few LSB of noise, as the target example. */
+    for (i = 0ul; i < BENCH_SAMPLE_NUM; i++)
+    {
+        u32Seed ^= u32Seed << 13u;
+        u32Seed ^= u32Seed >> 17u;
+        u32Seed ^= u32Seed << 5u;
+        m_au16In[i] = (uint16_t)(0x800ul + (u32Seed & 0x7ul));
+    }
+
+    for (i = 1ul; i <= ADC_FLT_CIC_ORDER_MAX; i++)
+    {
+        dNs = BenchRun((uint8_t)i);
+        if (dNs < 0.0)
+        {
+            printf("order %u: init failed\n", (unsigned)i);
+            iFails++;
+        }
+        else
+        {
+            printf("order %u: %.2f ns/sample\n", (unsigned)i, dNs);
+        }
+    }
+
+    return iFails;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,191 @@
+/**
+ *******************************************************************************
+ * @file  adc_range.h
+ * @brief This file contains all the functions prototypes of the ADC and OPA
+ *        auto-ranging midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __ADC_RANGE_H__
+#define __ADC_RANGE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_ADC_RANGE
+ * @{
+ */
+
+#if (MW_ADC_RANGE_ENABLE == DDL_ON)
+
+#if (DDL_ADC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_ADC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_RANGE_Global_Types ADC_RANGE Global Types
+ * @{
+ */
+
+/**
+ * @brief ADC auto-ranging structure definition
+ * @note  The OPA amplifies the signal of u8RawPin(OPA input) to u8AmpPin(OPA output)
+ *        with the gain 1 + Rp/Rn set by the external resistors, see adc_08_opa.
+ *        Both pins are converted in the same scan.
+ */
+typedef struct
+{
+    uint8_t  u8OpaNbr;          /*!< OPA of the amplified path.
+                                     This parameter can be a value of @ref ADC_OPA_Number */
+    uint8_t  u8RawPin;          /*!< ADC pin of the direct path(OPA input).
+                                     This parameter can be a value of @ref ADC_Pin_Number */
+    uint8_t  u8AmpPin;          /*!< ADC pin of the amplified path(OPA output).
+                                     This parameter can be a value of @ref ADC_Pin_Number */
+    uint16_t u16GainQ8;         /*!< OPA gain in Q8, 256 ~ 65535, e.g. 7x is 1792. */
+    uint16_t u16SatVal;         /*!< An amplified sample at or above it is saturated, e.g. the
+                                     count of the OPA output swing minus a margin. */
+
+    /* Internal state, set by ADC_RANGE_Init() */
+    uint32_t u32InvGain;        /*!< 2^(16 + ADC_RANGE_FRAC_BITS) / gain. */
+} stc_adc_range_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_RANGE_Global_Macros ADC_RANGE Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup ADC_RANGE_Unit ADC_RANGE Unit
+ * @brief The result is in counts of the direct path with ADC_RANGE_FRAC_BITS fraction
+ *        bits, a 12 bits sample becomes 16 bits.
+ * @{
+ */
+#define ADC_RANGE_FRAC_BITS             (4u)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_RANGE_Path ADC_RANGE Path
+ * @{
+ */
+#define ADC_RANGE_PATH_AMP              ((uint8_t)0u)   /*!< The amplified sample is used. */
+#define ADC_RANGE_PATH_RAW              ((uint8_t)1u)   /*!< The amplified sample is saturated, the direct one is used. */
+/**
+ * @}
+ */
+
+/* OPA gain in Q8 from the resistors, e.g. ADC_RANGE_GAIN_Q8(30u, 5u) for 7x. */
+#define ADC_RANGE_GAIN_Q8(rp, rn)       ((uint16_t)(256ul + ((256ul * (uint32_t)(rp)) / (uint32_t)(rn))))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_RANGE_Global_Functions
+ * @{
+ */
+en_result_t ADC_RANGE_Init(stc_adc_range_t *pstcRange);
+uint16_t ADC_RANGE_Select(const stc_adc_range_t *pstcRange,
+                          uint16_t u16Raw, uint16_t u16Amp, uint8_t *pu8Path);
+uint16_t ADC_RANGE_Read(const stc_adc_range_t *pstcRange, uint8_t *pu8Path);
+en_result_t ADC_RANGE_AwdConfig(const stc_adc_range_t *pstcRange, uint8_t u8AwdNbr);
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_RANGE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_RANGE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
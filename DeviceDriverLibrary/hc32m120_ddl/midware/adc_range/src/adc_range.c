@@ -0,0 +1,241 @@
+/**
+ *******************************************************************************
+ * @file  adc_range.c
+ * @brief This midware file provides firmware functions to select between the
+ *        direct and the OPA amplified path of an ADC input.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "adc_range.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_ADC_RANGE ADC_RANGE
+ * @brief ADC and OPA Auto-ranging Midware Library
+ * @{
+ */
+
+#if (MW_ADC_RANGE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_RANGE_Local_Macros ADC_RANGE Local Macros
+ * @{
+ */
+
+/* Gain 1.0 in Q8 */
+#define ADC_RANGE_GAIN_ONE              (256u)
+
+#define IS_ADC_RANGE_PIN(x)             ((x) < ADC_CH_COUNT)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_RANGE_Global_Functions ADC_RANGE Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the auto-ranging and enable the OPA.
+ * @note   The pins are set to analog mode and both are added to the sequence by
+ *         the application.
+ * @param  [in] pstcRange               Pointer to a @ref stc_adc_range_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcRange == NULL or gain < 1.0
+ */
+en_result_t ADC_RANGE_Init(stc_adc_range_t *pstcRange)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcRange) && (pstcRange->u16GainQ8 >= ADC_RANGE_GAIN_ONE))
+    {
+        DDL_ASSERT(IS_ADC_RANGE_PIN(pstcRange->u8RawPin));
+        DDL_ASSERT(IS_ADC_RANGE_PIN(pstcRange->u8AmpPin));
+
+        /* The only division, the samples are rescaled by a multiply and a shift. */
+        pstcRange->u32InvGain = ((1ul << (24u + ADC_RANGE_FRAC_BITS)) + ((uint32_t)pstcRange->u16GainQ8 >> 1u)) /
+                                (uint32_t)pstcRange->u16GainQ8;
+        ADC_OpaCmd(pstcRange->u8OpaNbr, Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Select the unsaturated sample with the best resolution.
+ * @note   For buffered samples, e.g. the frames of adc_acq.
+ * @param  [in] pstcRange               Pointer to a @ref stc_adc_range_t structure
+ * @param  [in] u16Raw                  Sample of the direct path.
+ * @param  [in] u16Amp                  Sample of the amplified path of the same scan.
+ * @param  [out] pu8Path                The path used, a value of @ref ADC_RANGE_Path. NULL: not needed.
+ * @retval Input in counts of the direct path with ADC_RANGE_FRAC_BITS fraction bits.
+ */
+uint16_t ADC_RANGE_Select(const stc_adc_range_t *pstcRange,
+                          uint16_t u16Raw, uint16_t u16Amp, uint8_t *pu8Path)
+{
+    uint16_t u16Val;
+    uint8_t u8Path;
+
+    if (u16Amp < pstcRange->u16SatVal)
+    {
+        /* amp * 2^FRAC / gain, u16Amp * u32InvGain stays in 32 bits for gain >= 1. */
+        u16Val = (uint16_t)(((uint32_t)u16Amp * pstcRange->u32InvGain + 0x8000ul) >> 16u);
+        u8Path = ADC_RANGE_PATH_AMP;
+    }
+    else
+    {
+        u16Val = (uint16_t)((uint32_t)u16Raw << ADC_RANGE_FRAC_BITS);
+        u8Path = ADC_RANGE_PATH_RAW;
+    }
+
+    if (NULL != pu8Path)
+    {
+        *pu8Path = u8Path;
+    }
+
+    return u16Val;
+}
+
+/**
+ * @brief  Read both paths from the data registers after a scan and select one.
+ * @param  [in] pstcRange               Pointer to a @ref stc_adc_range_t structure
+ * @param  [out] pu8Path                The path used, a value of @ref ADC_RANGE_Path. NULL: not needed.
+ * @retval Input in counts of the direct path with ADC_RANGE_FRAC_BITS fraction bits.
+ */
+uint16_t ADC_RANGE_Read(const stc_adc_range_t *pstcRange, uint8_t *pu8Path)
+{
+    __IO uint16_t *io16AdcDr = &M0P_ADC->DR0;
+
+    return ADC_RANGE_Select(pstcRange, io16AdcDr[pstcRange->u8RawPin],
+                            io16AdcDr[pstcRange->u8AmpPin], pu8Path);
+}
+
+/**
+ * @brief  Let an AWD flag the saturation of the amplified path.
+ * @note   The AWD flag(and the interrupt when enabled by ADC_AwdIntCmd()) is set by each
+ *         conversion of the amplified path at or above u16SatVal, the application is
+ *         told of the range change without comparing the samples. ADC must be stopped.
+ * @param  [in] pstcRange               Pointer to a @ref stc_adc_range_t structure
+ * @param  [in] u8AwdNbr                AWD to be used.
+ *   @arg  ADC_AWD_0
+ *   @arg  ADC_AWD_1
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcRange == NULL or u16SatVal == 0
+ */
+en_result_t ADC_RANGE_AwdConfig(const stc_adc_range_t *pstcRange, uint8_t u8AwdNbr)
+{
+    stc_awd_cfg_t stcAwdCfg;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcRange) && (0u != pstcRange->u16SatVal))
+    {
+        stcAwdCfg.u8AdcPin = pstcRange->u8AmpPin;
+        stcAwdCfg.u16AwdMd = ADC_AWD_CMP_OUT_RANGE;
+        stcAwdCfg.u16Dr0   = 0u;
+        stcAwdCfg.u16Dr1   = pstcRange->u16SatVal - 1u;
+        enRet = ADC_AwdConfig(u8AwdNbr, &stcAwdCfg);
+        if (Ok == enRet)
+        {
+            ADC_AwdClrFlag((ADC_AWD_0 == u8AwdNbr) ? ADC_FLAG_AWD0 : ADC_FLAG_AWD1);
+            ADC_AwdCmd(u8AwdNbr, Enable);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_RANGE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,208 @@
+/**
+ *******************************************************************************
+ * @file  adc_sched.h
+ * @brief This file contains all the functions prototypes of the ADC conversion
+ *        scheduler midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __ADC_SCHED_H__
+#define __ADC_SCHED_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_ADC_SCHED
+ * @{
+ */
+
+#if (MW_ADC_SCHED_ENABLE == DDL_ON)
+
+#if (DDL_ADC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_ADC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Global_Types ADC_SCHED Global Types
+ * @{
+ */
+
+/**
+ * @brief Result callback, called in the EOCA or EOCB interrupt with the samples
+ *        of the request channels in ascending order of the ADC pin.
+ */
+typedef void (*func_ptr_adc_sched_cb_t)(const uint16_t *pu16Data, uint8_t u8Num);
+
+/**
+ * @brief ADC conversion request structure definition
+ */
+typedef struct stc_adc_sched_req
+{
+    uint16_t u16Channel;                /*!< Channels to be converted.
+                                             This parameter can be values of @ref ADC_Channels */
+    uint16_t u16Period;                 /*!< Urgent request: every u16Period-th sequence B trigger.
+                                             Periodic request: every u16Period ticks of ADC_SCHED_Tick().
+                                             0 is taken as 1. */
+    uint8_t  u8Prio;                    /*!< Priority, 0 is the highest.
+                                             ADC_SCHED_PRIO_URGENT ~ ADC_SCHED_PRIO_URGENT_MAX: converted by sequence B.
+                                             Others: converted by sequence A. */
+    func_ptr_adc_sched_cb_t pfnCallback; /*!< Result callback. */
+
+    /* Internal state, set by ADC_SCHED_AddReq() */
+    struct stc_adc_sched_req *pstcNext; /*!< Next request in order of priority. */
+    stc_adc_read_plan_t stcReadPlan;    /*!< Data registers of the request. */
+    uint8_t  u8State;                   /*!< Idle, pending or in the current scan. */
+    uint16_t u16Countdown;              /*!< Ticks or triggers to the next conversion. */
+} stc_adc_sched_req_t;
+
+/**
+ * @brief ADC conversion scheduler structure definition
+ */
+typedef struct
+{
+    en_event_src_t enUrgentEvent;       /*!< Event that triggers sequence B, e.g. a PWM compare event. */
+    IRQn_Type enEocaIRQn;               /*!< IRQ number of INT_ADC_EOCA. */
+    IRQn_Type enEocbIRQn;               /*!< IRQ number of INT_ADC_EOCB. */
+
+    /* Internal state */
+    stc_adc_sched_req_t *pstcUrgent;    /*!< Urgent requests, sequence B. */
+    stc_adc_sched_req_t *pstcPeriodic;  /*!< Periodic requests, sequence A. */
+    uint16_t u16ChUrgent;               /*!< Channels of sequence B. */
+    uint16_t u16ChScan;                 /*!< Channels of sequence A. */
+    uint8_t  u8Running;                 /*!< The scheduler is started. */
+    uint8_t  u8ScanBusy;                /*!< A scan of sequence A is running. */
+    uint32_t u32Overrun;                /*!< Ticks at which a request was due while a scan of sequence A was running. */
+} stc_adc_sched_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Global_Macros ADC_SCHED Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup ADC_SCHED_Priority ADC_SCHED Priority
+ * @{
+ */
+#define ADC_SCHED_PRIO_URGENT           ((uint8_t)0u)   /*!< Highest priority of sequence B. */
+#define ADC_SCHED_PRIO_URGENT_MAX       ((uint8_t)15u)  /*!< Lowest priority of sequence B. */
+#define ADC_SCHED_PRIO_PERIODIC         ((uint8_t)16u)  /*!< Highest priority of sequence A. */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_SCHED_Global_Functions
+ * @{
+ */
+en_result_t ADC_SCHED_Init(stc_adc_sched_t *pstcSched);
+en_result_t ADC_SCHED_AddReq(stc_adc_sched_t *pstcSched, stc_adc_sched_req_t *pstcReq);
+en_result_t ADC_SCHED_DelReq(stc_adc_sched_t *pstcSched, const stc_adc_sched_req_t *pstcReq);
+en_result_t ADC_SCHED_Start(stc_adc_sched_t *pstcSched);
+en_result_t ADC_SCHED_Stop(stc_adc_sched_t *pstcSched);
+void ADC_SCHED_Tick(stc_adc_sched_t *pstcSched);
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_SCHED_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_SCHED_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
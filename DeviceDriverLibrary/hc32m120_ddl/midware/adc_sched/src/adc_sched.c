@@ -0,0 +1,520 @@
+/**
+ *******************************************************************************
+ * @file  adc_sched.c
+ * @brief This midware file provides firmware functions to schedule prioritized
+ *        ADC conversion requests on sequence A and sequence B.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "adc_sched.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_ADC_SCHED ADC_SCHED
+ * @brief ADC Conversion Scheduler Midware Library
+ * @{
+ */
+
+#if (MW_ADC_SCHED_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Local_Macros ADC_SCHED Local Macros
+ * @{
+ */
+
+/* States of a request */
+#define ADC_SCHED_REQ_IDLE              ((uint8_t)0u)
+#define ADC_SCHED_REQ_PENDING           ((uint8_t)1u)
+#define ADC_SCHED_REQ_IN_SCAN           ((uint8_t)2u)
+
+#define IS_ADC_SCHED_URGENT(prio)       ((prio) <= ADC_SCHED_PRIO_URGENT_MAX)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint16_t AdcSchedListChannel(const stc_adc_sched_req_t *pstcList);
+static void AdcSchedDeliver(stc_adc_sched_req_t *pstcReq);
+static void AdcSchedEocaIrqCallback(void);
+static void AdcSchedEocbIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_adc_sched_t *m_pstcSched = NULL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SCHED_Global_Functions ADC_SCHED Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the scheduler with no request.
+ * @note   1. ADC must be initialized by ADC_Init() in mode ADC_MODE_SA_SB_SINGLE before.
+ *            Sequence B interrupts a scan of sequence A, u16RestrtFrom is set to
+ *            ADC_SA_RESTRT_FROM_INT_CH here, so the interrupted channel is converted
+ *            again and the channels converted before are kept.
+ *         2. The clocks of ADC and AOS and the timer of enUrgentEvent are configured by
+ *            the application.
+ * @param  [in] pstcSched               Pointer to a @ref stc_adc_sched_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcSched == NULL or ADC is not in mode ADC_MODE_SA_SB_SINGLE
+ */
+en_result_t ADC_SCHED_Init(stc_adc_sched_t *pstcSched)
+{
+    stc_adc_trg_cfg_t stcTrgCfg;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcSched) &&
+        (ADC_MODE_SA_SB_SINGLE == (M0P_ADC->CR0 & ADC_MODE_MASK)))
+    {
+        m_pstcSched = pstcSched;
+
+        pstcSched->pstcUrgent   = NULL;
+        pstcSched->pstcPeriodic = NULL;
+        pstcSched->u16ChUrgent  = 0u;
+        pstcSched->u16ChScan    = 0u;
+        pstcSched->u8Running    = 0u;
+        pstcSched->u8ScanBusy   = 0u;
+        pstcSched->u32Overrun   = 0ul;
+
+        ADC_TriggerSrcCmd(ADC_SEQ_A, Disable);
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Disable);
+        ADC_DelAdcChannel(ADC_SEQ_A, ADC_CH_ALL);
+        ADC_DelAdcChannel(ADC_SEQ_B, ADC_CH_ALL);
+        M0P_ADC->CR1 &= (uint16_t)(~ADC_CR1_RSCHSEL);
+
+        /* Sequence A is started by software, sequence B by the urgent event. */
+        ADC_TriggerSrcStructInit(&stcTrgCfg);
+        stcTrgCfg.u16TrgSrc = ADC_TRGSRC_IN_EVT0;
+        stcTrgCfg.enEvent0  = pstcSched->enUrgentEvent;
+        ADC_ConfigTriggerSrc(ADC_SEQ_B, &stcTrgCfg);
+
+        /* Register EOCA and EOCB IRQ handlers && configure NVIC. */
+        stcIrqRegiConf.enIRQn = pstcSched->enEocaIRQn;
+        stcIrqRegiConf.enIntSrc = INT_ADC_EOCA;
+        stcIrqRegiConf.pfnCallback = &AdcSchedEocaIrqCallback;
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+        stcIrqRegiConf.enIRQn = pstcSched->enEocbIRQn;
+        stcIrqRegiConf.enIntSrc = INT_ADC_EOCB;
+        stcIrqRegiConf.pfnCallback = &AdcSchedEocbIrqCallback;
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        /* Sequence B results come first. */
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_02);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+        ADC_ClrEocFlag(ADC_FLAG_EOC_ALL);
+        ADC_AdcIntCmd(ADC_SEQ_A, Enable);
+        ADC_AdcIntCmd(ADC_SEQ_B, Enable);
+
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Add a request, the lists are kept in order of priority.
+ * @note   The request is used by the interrupts, it must be kept valid until it is
+ *         deleted. Requests are added and deleted while the scheduler is stopped.
+ * @param  [in] pstcSched               Pointer to a @ref stc_adc_sched_t structure
+ * @param  [in] pstcReq                 Pointer to a @ref stc_adc_sched_req_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Add success
+ *           - ErrorInvalidParameter: NULL pointer, no channel, or a channel is both in an
+ *                                    urgent and in a periodic request
+ *           - ErrorOperationInProgress: The scheduler is running
+ */
+en_result_t ADC_SCHED_AddReq(stc_adc_sched_t *pstcSched, stc_adc_sched_req_t *pstcReq)
+{
+    uint16_t u16Other;
+    stc_adc_sched_req_t **ppstcPos;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcSched) && (NULL != pstcReq) &&
+        (0u != (pstcReq->u16Channel & ADC_CH_ALL)))
+    {
+        /* A data register is shared by the sequences, a channel stays in one of them. */
+        if (IS_ADC_SCHED_URGENT(pstcReq->u8Prio))
+        {
+            u16Other = AdcSchedListChannel(pstcSched->pstcPeriodic);
+            ppstcPos = &pstcSched->pstcUrgent;
+        }
+        else
+        {
+            u16Other = AdcSchedListChannel(pstcSched->pstcUrgent);
+            ppstcPos = &pstcSched->pstcPeriodic;
+        }
+
+        if (0u != pstcSched->u8Running)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else if (0u == (pstcReq->u16Channel & u16Other))
+        {
+            (void)ADC_ReadPlanInit(&pstcReq->stcReadPlan, pstcReq->u16Channel);
+            if (0u == pstcReq->u16Period)
+            {
+                pstcReq->u16Period = 1u;
+            }
+            pstcReq->u16Countdown = pstcReq->u16Period;
+            pstcReq->u8State = ADC_SCHED_REQ_IDLE;
+
+            /* Behind the requests of the same or higher priority. */
+            while ((NULL != *ppstcPos) && ((*ppstcPos)->u8Prio <= pstcReq->u8Prio))
+            {
+                ppstcPos = &(*ppstcPos)->pstcNext;
+            }
+            pstcReq->pstcNext = *ppstcPos;
+            *ppstcPos = pstcReq;
+            enRet = Ok;
+        }
+        else
+        {
+            /* A channel in both sequences, ErrorInvalidParameter. */
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Delete a request.
+ * @param  [in] pstcSched               Pointer to a @ref stc_adc_sched_t structure
+ * @param  [in] pstcReq                 Pointer to a @ref stc_adc_sched_req_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Delete success
+ *           - ErrorInvalidParameter: NULL pointer or the request is not added
+ *           - ErrorOperationInProgress: The scheduler is running
+ */
+en_result_t ADC_SCHED_DelReq(stc_adc_sched_t *pstcSched, const stc_adc_sched_req_t *pstcReq)
+{
+    stc_adc_sched_req_t **ppstcPos;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcSched) && (NULL != pstcReq))
+    {
+        if (0u != pstcSched->u8Running)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else
+        {
+            ppstcPos = IS_ADC_SCHED_URGENT(pstcReq->u8Prio) ? &pstcSched->pstcUrgent : &pstcSched->pstcPeriodic;
+            while ((NULL != *ppstcPos) && (pstcReq != *ppstcPos))
+            {
+                ppstcPos = &(*ppstcPos)->pstcNext;
+            }
+            if (NULL != *ppstcPos)
+            {
+                *ppstcPos = pstcReq->pstcNext;
+                enRet = Ok;
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the scheduler.
+ * @note   Sequence B converts the channels of all urgent requests at each urgent event,
+ *         its channels are configured once here.
+ * @param  [in] pstcSched               Pointer to a @ref stc_adc_sched_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: pstcSched == NULL
+ */
+en_result_t ADC_SCHED_Start(stc_adc_sched_t *pstcSched)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcSched)
+    {
+        m_pstcSched = pstcSched;
+
+        ADC_DelAdcChannel(ADC_SEQ_B, ADC_CH_ALL);
+        pstcSched->u16ChUrgent = AdcSchedListChannel(pstcSched->pstcUrgent);
+        ADC_AddAdcChannel(ADC_SEQ_B, pstcSched->u16ChUrgent);
+
+        pstcSched->u8ScanBusy = 0u;
+        pstcSched->u8Running  = 1u;
+        if (0u != pstcSched->u16ChUrgent)
+        {
+            ADC_TriggerSrcCmd(ADC_SEQ_B, Enable);
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the scheduler, a running scan of sequence A is completed.
+ * @param  [in] pstcSched               Pointer to a @ref stc_adc_sched_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Stop success
+ *           - ErrorInvalidParameter: pstcSched == NULL
+ */
+en_result_t ADC_SCHED_Stop(stc_adc_sched_t *pstcSched)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcSched)
+    {
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Disable);
+        pstcSched->u8Running = 0u;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Time base of the periodic requests.
+ * @note   1. Call it at a fixed rate, e.g. in a 1ms timer interrupt, with a priority not
+ *            higher than the EOCA interrupt.
+ *         2. The due requests are batched into one scan of sequence A, only the channels
+ *            different from the last scan are reconfigured. A request due while a scan is
+ *            running is converted in the next scan, u32Overrun counts the ticks with
+ *            such a request.
+ * @param  [in] pstcSched               Pointer to a @ref stc_adc_sched_t structure
+ * @retval None
+ */
+void ADC_SCHED_Tick(stc_adc_sched_t *pstcSched)
+{
+    uint16_t u16Ch = 0u;
+    uint8_t u8Due = 0u;
+    stc_adc_sched_req_t *pstcReq;
+
+    if ((NULL != pstcSched) && (0u != pstcSched->u8Running))
+    {
+        for (pstcReq = pstcSched->pstcPeriodic; NULL != pstcReq; pstcReq = pstcReq->pstcNext)
+        {
+            pstcReq->u16Countdown--;
+            if (0u == pstcReq->u16Countdown)
+            {
+                pstcReq->u16Countdown = pstcReq->u16Period;
+                u8Due = 1u;
+                if (ADC_SCHED_REQ_IDLE == pstcReq->u8State)
+                {
+                    pstcReq->u8State = ADC_SCHED_REQ_PENDING;
+                }
+            }
+        }
+
+        if (0u != pstcSched->u8ScanBusy)
+        {
+            if (0u != u8Due)
+            {
+                pstcSched->u32Overrun++;
+            }
+        }
+        else
+        {
+            for (pstcReq = pstcSched->pstcPeriodic; NULL != pstcReq; pstcReq = pstcReq->pstcNext)
+            {
+                if (ADC_SCHED_REQ_PENDING == pstcReq->u8State)
+                {
+                    pstcReq->u8State = ADC_SCHED_REQ_IN_SCAN;
+                    u16Ch |= pstcReq->u16Channel;
+                }
+            }
+
+            if (0u != u16Ch)
+            {
+                if (u16Ch != pstcSched->u16ChScan)
+                {
+                    ADC_DelAdcChannel(ADC_SEQ_A, (uint16_t)(pstcSched->u16ChScan & (uint16_t)(~u16Ch)));
+                    ADC_AddAdcChannel(ADC_SEQ_A, (uint16_t)(u16Ch & (uint16_t)(~pstcSched->u16ChScan)));
+                    pstcSched->u16ChScan = u16Ch;
+                }
+                pstcSched->u8ScanBusy = 1u;
+                ADC_Start();
+            }
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_SCHED_Local_Functions ADC_SCHED Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Channels of all requests of a list.
+ * @param  [in] pstcList                First request of the list.
+ * @retval Channels of the list.
+ */
+static uint16_t AdcSchedListChannel(const stc_adc_sched_req_t *pstcList)
+{
+    uint16_t u16Ch = 0u;
+
+    while (NULL != pstcList)
+    {
+        u16Ch |= pstcList->u16Channel;
+        pstcList = pstcList->pstcNext;
+    }
+
+    return (u16Ch & ADC_CH_ALL);
+}
+
+/**
+ * @brief  Read the data registers of a request and call its callback.
+ * @param  [in] pstcReq                 Pointer to a @ref stc_adc_sched_req_t structure
+ * @retval None
+ */
+static void AdcSchedDeliver(stc_adc_sched_req_t *pstcReq)
+{
+    uint16_t au16Data[ADC_CH_COUNT];
+
+    ADC_ReadPlanExec(&pstcReq->stcReadPlan, au16Data);
+
+    if (NULL != pstcReq->pfnCallback)
+    {
+        pstcReq->pfnCallback(au16Data, pstcReq->stcReadPlan.u8Num);
+    }
+}
+
+/**
+ * @brief  EOCA IRQ callback, deliver the periodic requests of the scan by priority.
+ * @param  None
+ * @retval None
+ */
+static void AdcSchedEocaIrqCallback(void)
+{
+    stc_adc_sched_req_t *pstcReq;
+    stc_adc_sched_t *pstcSched = m_pstcSched;
+
+    ADC_ClrEocFlag(ADC_FLAG_EOCA);
+
+    for (pstcReq = pstcSched->pstcPeriodic; NULL != pstcReq; pstcReq = pstcReq->pstcNext)
+    {
+        if (ADC_SCHED_REQ_IN_SCAN == pstcReq->u8State)
+        {
+            pstcReq->u8State = ADC_SCHED_REQ_IDLE;
+            AdcSchedDeliver(pstcReq);
+        }
+    }
+    pstcSched->u8ScanBusy = 0u;
+}
+
+/**
+ * @brief  EOCB IRQ callback, deliver the due urgent requests by priority.
+ * @param  None
+ * @retval None
+ */
+static void AdcSchedEocbIrqCallback(void)
+{
+    stc_adc_sched_req_t *pstcReq;
+
+    ADC_ClrEocFlag(ADC_FLAG_EOCB);
+
+    for (pstcReq = m_pstcSched->pstcUrgent; NULL != pstcReq; pstcReq = pstcReq->pstcNext)
+    {
+        pstcReq->u16Countdown--;
+        if (0u == pstcReq->u16Countdown)
+        {
+            pstcReq->u16Countdown = pstcReq->u16Period;
+            AdcSchedDeliver(pstcReq);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_SCHED_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,209 @@
+/**
+ *******************************************************************************
+ * @file  adc_sv.h
+ * @brief This file contains all the functions prototypes of the ADC threshold
+ *        supervision midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __ADC_SV_H__
+#define __ADC_SV_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_ADC_SV
+ * @{
+ */
+
+#if (MW_ADC_SV_ENABLE == DDL_ON)
+
+#if (DDL_ADC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_ADC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SV_Global_Types ADC_SV Global Types
+ * @{
+ */
+
+/**
+ * @brief Window of a supervised channel.
+ * @note  The channel is normal while u16Low <= sample <= u16High. It turns back to
+ *        normal from fault only when u16Low + u16Hyst <= sample <= u16High - u16Hyst.
+ *        A bound of 0 (low) or 0xFFFF (high) is not checked and not narrowed, e.g.
+ *        an over-voltage check sets u16Low to 0.
+ */
+typedef struct
+{
+    uint8_t  u8AdcPin;                  /*!< ADC pin to be supervised.
+                                             This parameter can be a value of @ref ADC_Pin_Number */
+    uint16_t u16Low;                    /*!< Low bound of the normal window. */
+    uint16_t u16High;                   /*!< High bound of the normal window. */
+    uint16_t u16Hyst;                   /*!< Hysteresis, in ADC counts. */
+} stc_adc_sv_ch_t;
+
+/**
+ * @brief State callback, called only when the state of a channel changes.
+ * @param u8Index    Index of the channel in the channel table.
+ * @param u8State    New state, a value of @ref ADC_SV_State.
+ */
+typedef void (*func_ptr_adc_sv_cb_t)(uint8_t u8Index, uint8_t u8State);
+
+/**
+ * @brief ADC threshold supervision handle structure definition
+ */
+typedef struct
+{
+    const stc_adc_sv_ch_t *pstcCh;      /*!< Channel table, kept valid while supervising. */
+    uint8_t  u8ChNum;                   /*!< Number of channels in the table, 1 ~ ADC_CH_COUNT. */
+    en_event_src_t enTrigEvent;         /*!< Event that triggers sequence B, e.g. a timer overflow. */
+    IRQn_Type enAwd0IRQn;               /*!< IRQ number of INT_ADC_CMP0, used with 1 or 2 channels. */
+    IRQn_Type enAwd1IRQn;               /*!< IRQ number of INT_ADC_CMP1, used with 2 channels. */
+    IRQn_Type enEocbIRQn;               /*!< IRQ number of INT_ADC_EOCB, used with more than 2 channels. */
+    func_ptr_adc_sv_cb_t pfnStateCb;    /*!< State callback. */
+
+    /* Internal state, set by ADC_SV_Init() */
+    uint8_t au8State[ADC_CH_COUNT];     /*!< State of each channel. */
+    uint8_t au8AwdIdx[2u];              /*!< Channel index currently assigned to AWD0 and AWD1. */
+} stc_adc_sv_handle_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SV_Global_Macros ADC_SV Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup ADC_SV_State ADC_SV State
+ * @{
+ */
+#define ADC_SV_STATE_NORMAL             ((uint8_t)0u)   /*!< Sample inside the window. */
+#define ADC_SV_STATE_FAULT              ((uint8_t)1u)   /*!< Sample outside the window. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_SV_Bound_Unused ADC_SV Unused Bound
+ * @{
+ */
+#define ADC_SV_LOW_NONE                 ((uint16_t)0x0000u)
+#define ADC_SV_HIGH_NONE                ((uint16_t)0xFFFFu)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_SV_Global_Functions
+ * @{
+ */
+en_result_t ADC_SV_Init(stc_adc_sv_handle_t *pstcHandle);
+en_result_t ADC_SV_Start(const stc_adc_sv_handle_t *pstcHandle);
+en_result_t ADC_SV_Stop(const stc_adc_sv_handle_t *pstcHandle);
+uint8_t ADC_SV_GetState(const stc_adc_sv_handle_t *pstcHandle, uint8_t u8Index);
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_SV_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADC_SV_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
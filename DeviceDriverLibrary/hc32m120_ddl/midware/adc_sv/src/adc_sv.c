@@ -0,0 +1,476 @@
+/**
+ *******************************************************************************
+ * @file  adc_sv.c
+ * @brief This midware file provides firmware functions to supervise ADC
+ *        channels with the analog watchdogs.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "adc_sv.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_ADC_SV ADC_SV
+ * @brief ADC Threshold Supervision Midware Library
+ * @{
+ */
+
+#if (MW_ADC_SV_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SV_Local_Macros ADC_SV Local Macros
+ * @{
+ */
+
+/* Up to 2 channels are watched by fixed AWDs, more channels rotate through them. */
+#define ADC_SV_AWD_NUM                  (2u)
+
+#define IS_ADC_SV_PIN(x)                ((x) < ADC_CH_COUNT)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void AdcSvGetRecoverWindow(const stc_adc_sv_ch_t *pstcCh,
+                                  uint16_t *pu16Low, uint16_t *pu16High);
+static void AdcSvLoad(uint8_t u8AwdNbr);
+static void AdcSvCheck(uint8_t u8AwdNbr);
+static void AdcSvAwd0IrqCallback(void);
+static void AdcSvAwd1IrqCallback(void);
+static void AdcSvEocbIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_adc_sv_handle_t *m_pstcSvHandle = NULL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_SV_Global_Functions ADC_SV Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the threshold supervision.
+ * @note   1. ADC must be initialized by ADC_Init() in mode ADC_MODE_SA_SB_SINGLE or
+ *            ADC_MODE_SA_CONTINUOUS_SB_SINGLE before, every trigger event converts all
+ *            the supervised channels in sequence B. The timer of the trigger event and
+ *            the clocks of ADC and AOS are configured by the application.
+ *         2. With 1 or 2 channels, each channel owns an AWD and only the AWD interrupt
+ *            of a state change enters the CPU. With more channels AWD0 and AWD1 are
+ *            moved to the next two channels at each end of sequence B, each channel is
+ *            checked once every (u8ChNum + 1) / 2 scans, the samples are never read.
+ *         3. The AWD compares every conversion of the assigned pin, also the ones of
+ *            sequence A.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_sv_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, or the channel table is invalid,
+ *                                    or a window is narrower than twice the hysteresis
+ */
+en_result_t ADC_SV_Init(stc_adc_sv_handle_t *pstcHandle)
+{
+    uint8_t i;
+    uint16_t u16Low;
+    uint16_t u16High;
+    uint16_t u16Channel = 0u;
+    stc_adc_trg_cfg_t stcTrgCfg;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (NULL != pstcHandle->pstcCh) &&
+        (0u != pstcHandle->u8ChNum) && (pstcHandle->u8ChNum <= ADC_CH_COUNT))
+    {
+        enRet = Ok;
+        for (i = 0u; i < pstcHandle->u8ChNum; i++)
+        {
+            DDL_ASSERT(IS_ADC_SV_PIN(pstcHandle->pstcCh[i].u8AdcPin));
+            AdcSvGetRecoverWindow(&pstcHandle->pstcCh[i], &u16Low, &u16High);
+            if ((u16Low > u16High) ||
+                (pstcHandle->pstcCh[i].u16Low > pstcHandle->pstcCh[i].u16High))
+            {
+                enRet = ErrorInvalidParameter;
+                break;
+            }
+            u16Channel |= (uint16_t)(1ul << pstcHandle->pstcCh[i].u8AdcPin);
+            pstcHandle->au8State[i] = ADC_SV_STATE_NORMAL;
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        m_pstcSvHandle = pstcHandle;
+
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Disable);
+        ADC_AwdConfigCombMode(ADC_AWD_COMB_INVALID);
+
+        /* Sequence B channels and the trigger. */
+        ADC_AddAdcChannel(ADC_SEQ_B, u16Channel);
+        ADC_TriggerSrcStructInit(&stcTrgCfg);
+        stcTrgCfg.u16TrgSrc = ADC_TRGSRC_IN_EVT0;
+        stcTrgCfg.enEvent0  = pstcHandle->enTrigEvent;
+        ADC_ConfigTriggerSrc(ADC_SEQ_B, &stcTrgCfg);
+
+        /* AWD0 watches channel 0, AWD1 watches channel 1. */
+        for (i = 0u; i < ADC_SV_AWD_NUM; i++)
+        {
+            pstcHandle->au8AwdIdx[i] = i % pstcHandle->u8ChNum;
+        }
+        ADC_AwdClrFlag(ADC_FLAG_AWD_ALL);
+        AdcSvLoad(ADC_AWD_0);
+        ADC_AwdCmd(ADC_AWD_0, Enable);
+        if (pstcHandle->u8ChNum > 1u)
+        {
+            AdcSvLoad(ADC_AWD_1);
+            ADC_AwdCmd(ADC_AWD_1, Enable);
+        }
+        else
+        {
+            ADC_AwdCmd(ADC_AWD_1, Disable);
+        }
+
+        if (pstcHandle->u8ChNum > ADC_SV_AWD_NUM)
+        {
+            /* The flags are checked at the end of each scan, before rotating. */
+            ADC_AwdIntCmd(ADC_AWD_0, Disable);
+            ADC_AwdIntCmd(ADC_AWD_1, Disable);
+
+            stcIrqRegiConf.enIRQn = pstcHandle->enEocbIRQn;
+            stcIrqRegiConf.enIntSrc = INT_ADC_EOCB;
+            stcIrqRegiConf.pfnCallback = &AdcSvEocbIrqCallback;
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+            ADC_ClrEocFlag(ADC_FLAG_EOCB);
+            ADC_AdcIntCmd(ADC_SEQ_B, Enable);
+        }
+        else
+        {
+            ADC_AdcIntCmd(ADC_SEQ_B, Disable);
+
+            stcIrqRegiConf.enIRQn = pstcHandle->enAwd0IRQn;
+            stcIrqRegiConf.enIntSrc = INT_ADC_CMP0;
+            stcIrqRegiConf.pfnCallback = &AdcSvAwd0IrqCallback;
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+            ADC_AwdIntCmd(ADC_AWD_0, Enable);
+
+            if (pstcHandle->u8ChNum > 1u)
+            {
+                stcIrqRegiConf.enIRQn = pstcHandle->enAwd1IRQn;
+                stcIrqRegiConf.enIntSrc = INT_ADC_CMP1;
+                stcIrqRegiConf.pfnCallback = &AdcSvAwd1IrqCallback;
+                INTC_IrqRegistration(&stcIrqRegiConf);
+                NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+                NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+                NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+                ADC_AwdIntCmd(ADC_AWD_1, Enable);
+            }
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the supervision, all channels start in state ADC_SV_STATE_NORMAL.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_sv_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t ADC_SV_Start(const stc_adc_sv_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the supervision, the states of the channels are kept.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_sv_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Stop success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t ADC_SV_Stop(const stc_adc_sv_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        ADC_TriggerSrcCmd(ADC_SEQ_B, Disable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the state of a channel.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_adc_sv_handle_t structure
+ * @param  [in] u8Index                 Index of the channel in the channel table.
+ * @retval A value of @ref ADC_SV_State, ADC_SV_STATE_NORMAL if the parameter is invalid.
+ */
+uint8_t ADC_SV_GetState(const stc_adc_sv_handle_t *pstcHandle, uint8_t u8Index)
+{
+    uint8_t u8State = ADC_SV_STATE_NORMAL;
+
+    if ((NULL != pstcHandle) && (u8Index < pstcHandle->u8ChNum))
+    {
+        u8State = pstcHandle->au8State[u8Index];
+    }
+
+    return u8State;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_SV_Local_Functions ADC_SV Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the window in which a channel in fault turns back to normal.
+ * @param  [in] pstcCh                  Pointer to a @ref stc_adc_sv_ch_t structure
+ * @param  [out] pu16Low                Low bound of the recover window.
+ * @param  [out] pu16High               High bound of the recover window.
+ * @retval None
+ */
+static void AdcSvGetRecoverWindow(const stc_adc_sv_ch_t *pstcCh,
+                                  uint16_t *pu16Low, uint16_t *pu16High)
+{
+    uint32_t u32Low  = pstcCh->u16Low;
+    uint32_t u32High = pstcCh->u16High;
+
+    if (ADC_SV_LOW_NONE != pstcCh->u16Low)
+    {
+        u32Low += pstcCh->u16Hyst;
+        if (u32Low > ADC_SV_HIGH_NONE)
+        {
+            u32Low = ADC_SV_HIGH_NONE;
+        }
+    }
+    if (ADC_SV_HIGH_NONE != pstcCh->u16High)
+    {
+        u32High = (u32High > pstcCh->u16Hyst) ? (u32High - pstcCh->u16Hyst) : 0ul;
+    }
+
+    *pu16Low  = (uint16_t)u32Low;
+    *pu16High = (uint16_t)u32High;
+}
+
+/**
+ * @brief  Load the channel assigned to an AWD, the comparison follows its state.
+ * @note   A normal channel is compared out of the window, a channel in fault is
+ *         compared in the narrowed window, so the AWD flag is set only by a change.
+ * @param  [in] u8AwdNbr                ADC_AWD_0 or ADC_AWD_1.
+ * @retval None
+ */
+static void AdcSvLoad(uint8_t u8AwdNbr)
+{
+    uint16_t u16Low;
+    uint16_t u16High;
+    uint32_t u32Mode;
+    const stc_adc_sv_handle_t *pstcHandle = m_pstcSvHandle;
+    uint8_t u8Index = pstcHandle->au8AwdIdx[u8AwdNbr];
+    const stc_adc_sv_ch_t *pstcCh = &pstcHandle->pstcCh[u8Index];
+
+    if (ADC_SV_STATE_NORMAL == pstcHandle->au8State[u8Index])
+    {
+        u32Mode = ADC_AWD_CMP_OUT_RANGE;
+        u16Low  = pstcCh->u16Low;
+        u16High = pstcCh->u16High;
+    }
+    else
+    {
+        u32Mode = ADC_AWD_CMP_IN_RANGE;
+        AdcSvGetRecoverWindow(pstcCh, &u16Low, &u16High);
+    }
+
+    if (ADC_AWD_0 == u8AwdNbr)
+    {
+        bM0P_ADC->AWDCR_b.AWD0MD = u32Mode;
+        M0P_ADC->AWD0DR0  = u16Low;
+        M0P_ADC->AWD0DR1  = u16High;
+        M0P_ADC->AWD0CHSR = pstcCh->u8AdcPin;
+    }
+    else
+    {
+        bM0P_ADC->AWDCR_b.AWD1MD = u32Mode;
+        M0P_ADC->AWD1DR0  = u16Low;
+        M0P_ADC->AWD1DR1  = u16High;
+        M0P_ADC->AWD1CHSR = pstcCh->u8AdcPin;
+    }
+}
+
+/**
+ * @brief  Check the flag of an AWD, a set flag is a change of the state of its channel.
+ * @param  [in] u8AwdNbr                ADC_AWD_0 or ADC_AWD_1.
+ * @retval None
+ */
+static void AdcSvCheck(uint8_t u8AwdNbr)
+{
+    uint8_t u8Index;
+    uint8_t u8Flag = (ADC_AWD_0 == u8AwdNbr) ? ADC_FLAG_AWD0 : ADC_FLAG_AWD1;
+    stc_adc_sv_handle_t *pstcHandle = m_pstcSvHandle;
+
+    if (Set == ADC_AwdGetFlag(u8Flag))
+    {
+        u8Index = pstcHandle->au8AwdIdx[u8AwdNbr];
+        pstcHandle->au8State[u8Index] ^= 1u;
+        AdcSvLoad(u8AwdNbr);
+        ADC_AwdClrFlag(u8Flag);
+
+        if (NULL != pstcHandle->pfnStateCb)
+        {
+            pstcHandle->pfnStateCb(u8Index, pstcHandle->au8State[u8Index]);
+        }
+    }
+}
+
+/**
+ * @brief  AWD0 IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void AdcSvAwd0IrqCallback(void)
+{
+    AdcSvCheck(ADC_AWD_0);
+}
+
+/**
+ * @brief  AWD1 IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void AdcSvAwd1IrqCallback(void)
+{
+    AdcSvCheck(ADC_AWD_1);
+}
+
+/**
+ * @brief  EOCB IRQ callback, check both AWDs and move them to the next two channels.
+ * @param  None
+ * @retval None
+ */
+static void AdcSvEocbIrqCallback(void)
+{
+    uint8_t i;
+    uint8_t u8Index;
+    stc_adc_sv_handle_t *pstcHandle = m_pstcSvHandle;
+
+    for (i = 0u; i < ADC_SV_AWD_NUM; i++)
+    {
+        AdcSvCheck(i);
+
+        u8Index = pstcHandle->au8AwdIdx[i] + (uint8_t)ADC_SV_AWD_NUM;
+        if (u8Index >= pstcHandle->u8ChNum)
+        {
+            u8Index -= pstcHandle->u8ChNum;
+        }
+        pstcHandle->au8AwdIdx[i] = u8Index;
+        AdcSvLoad(i);
+    }
+
+    ADC_ClrEocFlag(ADC_FLAG_EOCB);
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_ADC_SV_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
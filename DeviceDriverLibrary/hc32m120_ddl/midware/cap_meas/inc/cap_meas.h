@@ -0,0 +1,265 @@
+/**
+ *******************************************************************************
+ * @file  cap_meas.h
+ * @brief This file contains all the functions prototypes of the capture
+ *        measurement midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __CAP_MEAS_H__
+#define __CAP_MEAS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_CAP_MEAS
+ * @{
+ */
+
+#if (MW_CAP_MEAS_ENABLE == DDL_ON)
+
+#if (DDL_TIMERA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_TIMERB_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERB_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_DMA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_DMA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_GPIO_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_GPIO_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup CAP_MEAS_Global_Types CAP_MEAS Global Types
+ * @{
+ */
+
+/**
+ * @brief Capture measurement handle structure definition
+ * @note  1. The counter of the unit counts up freely with HCLK / 2^u8DivShift, the
+ *           input pin is set to the timer function by the application, and the
+ *           clocks of the timer and of DMA are enabled by the application.
+ *        2. CAP_MEAS_MODE_IRQ: one interrupt per edge, the capture condition is
+ *           switched between the rising and the falling edge, counts are extended
+ *           across the overflows to 32 bits. A pulse shorter than the interrupt
+ *           latency is not measured.
+ *        3. CAP_MEAS_MODE_DMA: both edges are captured, DMA moves the captures to
+ *           two half buffers and there is one interrupt per half buffer. The
+ *           edges alternate, the level of the pin at the start tells which one
+ *           comes first. A period must be shorter than 65536 counts, which the
+ *           auto-ranging keeps, and u16TimeoutOvf must cover a half buffer.
+ *        4. The two channels of TimerA share the counter and the compare event,
+ *           a change of the division by one channel applies to the other one as
+ *           well (use u8DivShiftMin == u8DivShiftMax for both channels), and only
+ *           one of them can be in DMA mode.
+ */
+typedef struct
+{
+    uint8_t  u8Timer;                   /*!< Timer of the capture.
+                                             This parameter can be a value of @ref CAP_MEAS_Timer */
+    uint8_t  u8TmraCh;                  /*!< TimerA channel, TIMERA_CHANNEL_CH1 or TIMERA_CHANNEL_CH2. */
+    M0P_TMRB_TypeDef *TMRBx;            /*!< TimerB unit, M0P_TMRB1 ~ M0P_TMRB4. */
+    uint8_t  u8Port;                    /*!< Port of the input pin, read at the start in DMA mode. */
+    uint8_t  u8Pin;                     /*!< Pin of the input pin. */
+    uint8_t  u8Mode;                    /*!< Capture mode.
+                                             This parameter can be a value of @ref CAP_MEAS_Mode */
+    uint8_t  u8DivShift;                /*!< log2 of the initial clock division, 0 ~ 10. */
+    uint8_t  u8DivShiftMin;             /*!< Auto-ranging range of u8DivShift, min == max fixes the division. */
+    uint8_t  u8DivShiftMax;
+    uint16_t u16TimeoutOvf;             /*!< Overflows without an edge to report 0Hz, 0: never. */
+    IRQn_Type enCmpIRQn;                /*!< IRQ number of the capture interrupt, INT_TMRA_CMP or INT_TMRB_x_CMP. */
+    IRQn_Type enOvfIRQn;                /*!< IRQ number of the overflow interrupt, INT_TMRA_OVF or INT_TMRB_x_OVF. */
+
+    /* DMA mode only */
+    uint8_t  u8DmaCh;                   /*!< DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1. */
+    IRQn_Type enDmaIRQn;                /*!< IRQ number of the DMA transfer complete interrupt. */
+    uint16_t *pu16Buf;                  /*!< Buffer of 2 * u32EdgePerHalf captures. */
+    uint32_t u32EdgePerHalf;            /*!< Captures per half buffer, an even number in 4 ~ CAP_MEAS_EDGE_PER_HALF_MAX. */
+
+    /* Internal state, set by CAP_MEAS_Init() */
+    stc_dma_llp_descriptor_t astcLlpDesc[2u];   /*!< Descriptors of the two half buffers. */
+    __IO uint16_t *pu16CapReg;          /*!< Capture register of the channel. */
+    uint8_t  u8Unit;                    /*!< Unit index, 0 is TimerA, 1 ~ 4 are TimerB1 ~ TimerB4. */
+    uint8_t  u8Run;                     /*!< The measurement is started. */
+    uint8_t  u8Edge;                    /*!< Edge armed in IRQ mode, first edge of a half buffer in DMA mode. */
+    uint8_t  u8Valid;                   /*!< Valid edge timestamps. */
+    uint8_t  u8Half;                    /*!< Half buffer being filled. */
+    uint8_t  u8Discard;                 /*!< Half buffers to be discarded. */
+    uint16_t u16OvfIdle;                /*!< Overflows since the last edge or half buffer. */
+    uint32_t u32Ovf;                    /*!< Overflow count, bits 16 ~ 31 of the timestamp. */
+    uint32_t u32Rise;                   /*!< Timestamp of the last rising edge. */
+    uint32_t u32Fall;                   /*!< Timestamp of the last falling edge. */
+    uint32_t u32BlockOvf;               /*!< u32Ovf at the last half buffer. */
+
+    /* Published result, written by the interrupts under u32Seq */
+    __IO uint32_t u32Seq;               /*!< Odd while the result is being written. */
+    __IO uint32_t u32PubCount;          /*!< Results published. */
+    __IO uint32_t u32PubCycles;         /*!< Periods in the result, 0 for no signal. */
+    __IO uint32_t u32PubPeriod;         /*!< Sum of the periods in counts. */
+    __IO uint32_t u32PubHigh;           /*!< Sum of the high times in counts. */
+    __IO uint8_t  u8PubShift;           /*!< u8DivShift of the counts. */
+} stc_cap_meas_handle_t;
+
+/**
+ * @brief Capture measurement result structure definition
+ */
+typedef struct
+{
+    uint32_t u32Count;                  /*!< Results published since the start, changes with each new result. */
+    uint32_t u32PeriodClk;              /*!< Mean period in HCLK cycles, 0 for no signal. */
+    uint32_t u32FreqMilliHz;            /*!< Frequency in mHz, 0 for no signal, saturates at 0xFFFFFFFF. */
+    uint16_t u16Duty;                   /*!< High time / period in Q15, 32768 is 100%, the pin level for no signal. */
+} stc_cap_meas_result_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CAP_MEAS_Global_Macros CAP_MEAS Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup CAP_MEAS_Timer CAP_MEAS Timer
+ * @{
+ */
+#define CAP_MEAS_TIMER_A                ((uint8_t)0u)   /*!< TimerA channel. */
+#define CAP_MEAS_TIMER_B                ((uint8_t)1u)   /*!< TimerB unit. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CAP_MEAS_Mode CAP_MEAS Mode
+ * @{
+ */
+#define CAP_MEAS_MODE_IRQ               ((uint8_t)0u)   /*!< One interrupt per edge. */
+#define CAP_MEAS_MODE_DMA               ((uint8_t)1u)   /*!< DMA moves the captures, one interrupt per half buffer. */
+/**
+ * @}
+ */
+
+#define CAP_MEAS_DIV_SHIFT_MAX          (10u)
+#define CAP_MEAS_EDGE_PER_HALF_MAX      (1022ul)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup CAP_MEAS_Global_Functions
+ * @{
+ */
+en_result_t CAP_MEAS_Init(stc_cap_meas_handle_t *pstcHandle);
+en_result_t CAP_MEAS_Start(stc_cap_meas_handle_t *pstcHandle);
+en_result_t CAP_MEAS_Stop(stc_cap_meas_handle_t *pstcHandle);
+en_result_t CAP_MEAS_GetResult(const stc_cap_meas_handle_t *pstcHandle,
+                               stc_cap_meas_result_t *pstcResult);
+/**
+ * @}
+ */
+
+#endif /* MW_CAP_MEAS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CAP_MEAS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,1103 @@
+/**
+ *******************************************************************************
+ * @file  cap_meas.c
+ * @brief This midware file provides firmware functions to measure the frequency
+ *        and the duty cycle of a signal by the input capture of TimerA/TimerB.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "cap_meas.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_CAP_MEAS CAP_MEAS
+ * @brief Capture Measurement Midware Library
+ * @{
+ */
+
+#if (MW_CAP_MEAS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CAP_MEAS_Local_Macros CAP_MEAS Local Macros
+ * @{
+ */
+
+/* Unit 0 is TimerA with two channels, units 1 ~ 4 are TimerB1 ~ TimerB4. */
+#define CAP_MEAS_UNIT_NUM               (5u)
+#define CAP_MEAS_UNIT_TMRA              (0u)
+#define CAP_MEAS_SLOT_NUM               (2u)
+
+/* Edge mask, the capture condition and u8Edge. */
+#define CAP_MEAS_EDGE_RISING            ((uint8_t)0x01u)
+#define CAP_MEAS_EDGE_FALLING           ((uint8_t)0x02u)
+#define CAP_MEAS_EDGE_BOTH              (CAP_MEAS_EDGE_RISING | CAP_MEAS_EDGE_FALLING)
+
+/* u8Valid bits. */
+#define CAP_MEAS_VALID_RISE             ((uint8_t)0x01u)
+#define CAP_MEAS_VALID_FALL             ((uint8_t)0x02u)
+
+/* Auto-ranging keeps the period in counts between these values. */
+#define CAP_MEAS_PERIOD_MAX             (0x8000ul)
+#define CAP_MEAS_PERIOD_MIN             (0x0800ul)
+
+#define CAP_MEAS_TMRB(unit)             (m_apstcCapMeasTmrb[(unit) - 1u])
+
+/* LLP field of CHxCTL0 holds bit[11:2] of the descriptor address. */
+#define CAP_MEAS_LLP_FIELD(addr)        (((addr) & 0x00000FFCul) << (DMA_CH0CTL0_LLP_POS - 2ul))
+
+#define IS_CAP_MEAS_DMA_CH(x)                                                  \
+(   ((x) == DMA_CHANNEL_0)                      ||                             \
+    ((x) == DMA_CHANNEL_1))
+
+#define IS_CAP_MEAS_TMRA_CH(x)                                                 \
+(   ((x) == (uint8_t)TIMERA_CHANNEL_CH1)        ||                             \
+    ((x) == (uint8_t)TIMERA_CHANNEL_CH2))
+
+#define IS_CAP_MEAS_MODE(x)                                                    \
+(   ((x) == CAP_MEAS_MODE_IRQ)                  ||                             \
+    ((x) == CAP_MEAS_MODE_DMA))
+
+#define IS_CAP_MEAS_DIV_SHIFT(h)                                               \
+(   ((h)->u8DivShiftMin <= (h)->u8DivShift)     &&                             \
+    ((h)->u8DivShift <= (h)->u8DivShiftMax)     &&                             \
+    ((h)->u8DivShiftMax <= CAP_MEAS_DIV_SHIFT_MAX))
+
+#define IS_CAP_MEAS_DMA_BUF(h)                                                 \
+(   ((h)->u8Mode != CAP_MEAS_MODE_DMA)          ||                             \
+    ((NULL != (h)->pu16Buf)                     &&                             \
+     ((h)->u32EdgePerHalf >= 4ul)               &&                             \
+     ((h)->u32EdgePerHalf <= CAP_MEAS_EDGE_PER_HALF_MAX) &&                    \
+     (0ul == ((h)->u32EdgePerHalf & 1ul))))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint8_t CapMeasGetSlot(const stc_cap_meas_handle_t *pstcHandle);
+static void CapMeasSetCondition(const stc_cap_meas_handle_t *pstcHandle, uint8_t u8EdgeMsk);
+static void CapMeasArmEdge(stc_cap_meas_handle_t *pstcHandle);
+static void CapMeasSetShift(uint8_t u8Unit, uint8_t u8Shift);
+static void CapMeasAutoRange(const stc_cap_meas_handle_t *pstcHandle, uint32_t u32Period);
+static void CapMeasPublish(stc_cap_meas_handle_t *pstcHandle, uint32_t u32Cycles,
+                           uint32_t u32Period, uint32_t u32High);
+static void CapMeasDmaLoad(const stc_cap_meas_handle_t *pstcHandle);
+static void CapMeasEdge(stc_cap_meas_handle_t *pstcHandle);
+static void CapMeasCmpHandler(uint8_t u8Unit);
+static void CapMeasOvfHandler(uint8_t u8Unit);
+static void CapMeasDmaTcHandler(uint8_t u8DmaCh);
+static void CapMeasTmraCmpIrqCallback(void);
+static void CapMeasTmrb1CmpIrqCallback(void);
+static void CapMeasTmrb2CmpIrqCallback(void);
+static void CapMeasTmrb3CmpIrqCallback(void);
+static void CapMeasTmrb4CmpIrqCallback(void);
+static void CapMeasTmraOvfIrqCallback(void);
+static void CapMeasTmrb1OvfIrqCallback(void);
+static void CapMeasTmrb2OvfIrqCallback(void);
+static void CapMeasTmrb3OvfIrqCallback(void);
+static void CapMeasTmrb4OvfIrqCallback(void);
+static void CapMeasDma0TcIrqCallback(void);
+static void CapMeasDma1TcIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_cap_meas_handle_t *m_apstcCapMeasHandle[CAP_MEAS_UNIT_NUM][CAP_MEAS_SLOT_NUM];
+static stc_cap_meas_handle_t *m_apstcCapMeasDma[2u];
+
+static M0P_TMRB_TypeDef *const m_apstcCapMeasTmrb[CAP_MEAS_UNIT_NUM - 1u] =
+{
+    M0P_TMRB1, M0P_TMRB2, M0P_TMRB3, M0P_TMRB4,
+};
+
+static const en_event_src_t m_aenCapMeasEvt[CAP_MEAS_UNIT_NUM] =
+{
+    EVT_TMRA_CMP, EVT_TMRB_1_CMP, EVT_TMRB_2_CMP, EVT_TMRB_3_CMP, EVT_TMRB_4_CMP,
+};
+
+static const en_int_src_t m_aenCapMeasOvfSrc[CAP_MEAS_UNIT_NUM] =
+{
+    INT_TMRA_OVF, INT_TMRB_1_OVF, INT_TMRB_2_OVF, INT_TMRB_3_OVF, INT_TMRB_4_OVF,
+};
+
+static const func_ptr_t m_apfnCapMeasCmpCb[CAP_MEAS_UNIT_NUM] =
+{
+    &CapMeasTmraCmpIrqCallback,  &CapMeasTmrb1CmpIrqCallback, &CapMeasTmrb2CmpIrqCallback,
+    &CapMeasTmrb3CmpIrqCallback, &CapMeasTmrb4CmpIrqCallback,
+};
+
+static const func_ptr_t m_apfnCapMeasOvfCb[CAP_MEAS_UNIT_NUM] =
+{
+    &CapMeasTmraOvfIrqCallback,  &CapMeasTmrb1OvfIrqCallback, &CapMeasTmrb2OvfIrqCallback,
+    &CapMeasTmrb3OvfIrqCallback, &CapMeasTmrb4OvfIrqCallback,
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup CAP_MEAS_Global_Functions CAP_MEAS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the capture measurement of a channel.
+ * @note   1. The counter of the unit is initialized as sawtooth up count with the
+ *            period 0xFFFF. The counter of TimerA is initialized by the first
+ *            channel only, the second channel takes over its division.
+ *         2. In DMA mode the two half buffers are chained by two LLP descriptors in
+ *            the handle, so the handle must be located in SRAM and kept valid while
+ *            the measurement runs.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, the timer, the channel, the
+ *                                    division, the mode or the buffer is invalid, or
+ *                                    both channels of TimerA are in DMA mode
+ */
+en_result_t CAP_MEAS_Init(stc_cap_meas_handle_t *pstcHandle)
+{
+    uint32_t i;
+    uint32_t u32Ctl0;
+    uint8_t u8Slot;
+    const stc_cap_meas_handle_t *pstcOther = NULL;
+    stc_timera_init_t stcTmraInit;
+    stc_timera_ic_init_t stcTmraIcInit;
+    stc_timerb_init_t stcTmrbInit;
+    stc_timerb_ic_init_t stcTmrbIcInit;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && IS_CAP_MEAS_MODE(pstcHandle->u8Mode) &&
+        IS_CAP_MEAS_DIV_SHIFT(pstcHandle) && IS_CAP_MEAS_DMA_BUF(pstcHandle))
+    {
+        if (CAP_MEAS_TIMER_A == pstcHandle->u8Timer)
+        {
+            if (IS_CAP_MEAS_TMRA_CH(pstcHandle->u8TmraCh))
+            {
+                pstcHandle->u8Unit = CAP_MEAS_UNIT_TMRA;
+                pstcOther = m_apstcCapMeasHandle[CAP_MEAS_UNIT_TMRA][pstcHandle->u8TmraCh ^ 1u];
+                /* The compare event of TimerA is shared by the two channels. */
+                if ((NULL == pstcOther) || (CAP_MEAS_MODE_DMA != pstcOther->u8Mode) ||
+                    (CAP_MEAS_MODE_DMA != pstcHandle->u8Mode))
+                {
+                    enRet = Ok;
+                }
+            }
+        }
+        else if (CAP_MEAS_TIMER_B == pstcHandle->u8Timer)
+        {
+            for (i = 0ul; i < (CAP_MEAS_UNIT_NUM - 1ul); i++)
+            {
+                if (pstcHandle->TMRBx == m_apstcCapMeasTmrb[i])
+                {
+                    pstcHandle->u8Unit = (uint8_t)(i + 1ul);
+                    enRet = Ok;
+                }
+            }
+        }
+        else
+        {
+            /* rsvd */
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcHandle->u8Run = 0u;
+        pstcHandle->u32Seq = 0ul;
+        pstcHandle->u32PubCount = 0ul;
+
+        if (CAP_MEAS_UNIT_TMRA == pstcHandle->u8Unit)
+        {
+            pstcHandle->pu16CapReg = (__IO uint16_t *)((uint32_t)(&M0P_TMRA->CMPAR1) +
+                                                       ((uint32_t)pstcHandle->u8TmraCh * 4ul));
+            if (NULL == pstcOther)
+            {
+                (void)TIMERA_StructInit(&stcTmraInit);
+                stcTmraInit.u16ClkDiv = (uint16_t)((uint32_t)pstcHandle->u8DivShift << TMRA_BCSTR_CKDIV_POS);
+                (void)TIMERA_Init(M0P_TMRA, &stcTmraInit);
+            }
+            else
+            {
+                pstcHandle->u8DivShift = pstcOther->u8DivShift;
+            }
+
+            (void)TIMERA_IC_StructInit(&stcTmraIcInit);
+            stcTmraIcInit.u16CaptureCondition = TIMERA_IC_INVALID;
+            (void)TIMERA_IC_Init(M0P_TMRA, pstcHandle->u8TmraCh, &stcTmraIcInit);
+        }
+        else
+        {
+            pstcHandle->pu16CapReg = &pstcHandle->TMRBx->CMPAR;
+
+            (void)TIMERB_StructInit(&stcTmrbInit);
+            stcTmrbInit.u16ClkDiv = (uint16_t)((uint32_t)pstcHandle->u8DivShift << TMRB_BCSTR_CKDIV_POS);
+            (void)TIMERB_Init(pstcHandle->TMRBx, &stcTmrbInit);
+
+            (void)TIMERB_IC_StructInit(&stcTmrbIcInit);
+            stcTmrbIcInit.u16CaptureCondition = TIMERB_IC_INVALID;
+            (void)TIMERB_IC_Init(pstcHandle->TMRBx, &stcTmrbIcInit);
+        }
+
+        /* Register overflow IRQ handler && configure NVIC. */
+        stcIrqRegiConf.enIRQn = pstcHandle->enOvfIRQn;
+        stcIrqRegiConf.enIntSrc = m_aenCapMeasOvfSrc[pstcHandle->u8Unit];
+        stcIrqRegiConf.pfnCallback = m_apfnCapMeasOvfCb[pstcHandle->u8Unit];
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+        if (CAP_MEAS_MODE_IRQ == pstcHandle->u8Mode)
+        {
+            /* Register capture IRQ handler && configure NVIC. */
+            stcIrqRegiConf.enIRQn = pstcHandle->enCmpIRQn;
+            stcIrqRegiConf.enIntSrc = (en_int_src_t)m_aenCapMeasEvt[pstcHandle->u8Unit];
+            stcIrqRegiConf.pfnCallback = m_apfnCapMeasCmpCb[pstcHandle->u8Unit];
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+        }
+        else
+        {
+            DDL_ASSERT(IS_CAP_MEAS_DMA_CH(pstcHandle->u8DmaCh));
+
+            /* Descriptor i fills half buffer i and links to the other one. The DMA source
+               address is the capture register, the destination address keeps increasing. */
+            u32Ctl0 = 1ul | (pstcHandle->u32EdgePerHalf << DMA_CH0CTL0_CNT_POS) |
+                      DMA_LLP_ENABLE | DMA_LLP_WAIT | DMA_DATAWIDTH_16BIT;
+            for (i = 0ul; i < 2ul; i++)
+            {
+                pstcHandle->astcLlpDesc[i].SARx    = (uint32_t)pstcHandle->pu16CapReg;
+                pstcHandle->astcLlpDesc[i].DARx    = (uint32_t)(&pstcHandle->pu16Buf[i * pstcHandle->u32EdgePerHalf]);
+                pstcHandle->astcLlpDesc[i].CHxCTL0 = u32Ctl0 |
+                            CAP_MEAS_LLP_FIELD((uint32_t)(&pstcHandle->astcLlpDesc[i ^ 1ul]));
+                pstcHandle->astcLlpDesc[i].CHxCTL1 = DMA_SRCADDRINC_FIX | DMA_DESADDRINC_INC;
+            }
+
+            /* Enable peripheral clock */
+            CLK_FcgPeriphClockCmd(CLK_FCG_DMA | CLK_FCG_AOS, Enable);
+
+            m_apstcCapMeasDma[pstcHandle->u8DmaCh] = pstcHandle;
+
+            /* Register DMA transfer complete IRQ handler && configure NVIC. */
+            stcIrqRegiConf.enIRQn = pstcHandle->enDmaIRQn;
+            if (DMA_CHANNEL_0 == pstcHandle->u8DmaCh)
+            {
+                stcIrqRegiConf.enIntSrc = INT_DAM_1_TC0;
+                stcIrqRegiConf.pfnCallback = &CapMeasDma0TcIrqCallback;
+            }
+            else
+            {
+                stcIrqRegiConf.enIntSrc = INT_DAM_2_TC0;
+                stcIrqRegiConf.pfnCallback = &CapMeasDma1TcIrqCallback;
+            }
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+        }
+
+        u8Slot = CapMeasGetSlot(pstcHandle);
+        m_apstcCapMeasHandle[pstcHandle->u8Unit][u8Slot] = pstcHandle;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the measurement, the previous result is dropped.
+ * @note   The level of the input pin tells which edge comes first.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or not initialized
+ */
+en_result_t CAP_MEAS_Start(stc_cap_meas_handle_t *pstcHandle)
+{
+    uint8_t u8Unit;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (pstcHandle->u8Unit < CAP_MEAS_UNIT_NUM) &&
+        (pstcHandle == m_apstcCapMeasHandle[pstcHandle->u8Unit][CapMeasGetSlot(pstcHandle)]))
+    {
+        u8Unit = pstcHandle->u8Unit;
+        pstcHandle->u8Run       = 0u;
+        pstcHandle->u8Valid     = 0u;
+        pstcHandle->u8Half      = 0u;
+        pstcHandle->u8Discard   = 0u;
+        pstcHandle->u16OvfIdle  = 0u;
+        pstcHandle->u32Ovf      = 0ul;
+        pstcHandle->u32BlockOvf = 0ul;
+        pstcHandle->u32PubCount = 0ul;
+        pstcHandle->u8Edge = (Pin_Set == GPIO_ReadInputPortPin(pstcHandle->u8Port, pstcHandle->u8Pin)) ?
+                             CAP_MEAS_EDGE_FALLING : CAP_MEAS_EDGE_RISING;
+
+        if (CAP_MEAS_MODE_IRQ == pstcHandle->u8Mode)
+        {
+            CapMeasArmEdge(pstcHandle);
+            if (CAP_MEAS_UNIT_TMRA == u8Unit)
+            {
+                TIMERA_ClearFlag(M0P_TMRA, (TIMERA_CHANNEL_CH1 == pstcHandle->u8TmraCh) ?
+                                           TIMERA_FLAG_CMP1 : TIMERA_FLAG_CMP2);
+                TIMERA_IntCmd(M0P_TMRA, (TIMERA_CHANNEL_CH1 == pstcHandle->u8TmraCh) ?
+                                        TIMERA_INT_CMP1 : TIMERA_INT_CMP2, Enable);
+            }
+            else
+            {
+                TIMERB_ClearFlag(CAP_MEAS_TMRB(u8Unit), TIMERB_FLAG_CMP);
+                TIMERB_IntCmd(CAP_MEAS_TMRB(u8Unit), TIMERB_IT_CMP, Enable);
+            }
+        }
+        else
+        {
+            CapMeasDmaLoad(pstcHandle);
+            DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+            DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Enable);
+            DMA_SetTriggerSrc(pstcHandle->u8DmaCh, m_aenCapMeasEvt[u8Unit]);
+            DMA_ChannelEnable(pstcHandle->u8DmaCh);
+            DMA_Cmd(Enable);
+
+            if (CAP_MEAS_UNIT_TMRA == u8Unit)
+            {
+                TIMERA_EventCmd(M0P_TMRA, (TIMERA_CHANNEL_CH1 == pstcHandle->u8TmraCh) ?
+                                          TIMERA_EVENT_CMP1 : TIMERA_EVENT_CMP2, Enable);
+            }
+            else
+            {
+                TIMERB_EnableCmpMatchEvt(CAP_MEAS_TMRB(u8Unit));
+            }
+            CapMeasSetCondition(pstcHandle, CAP_MEAS_EDGE_BOTH);
+        }
+
+        pstcHandle->u8Run = 1u;
+        if (CAP_MEAS_UNIT_TMRA == u8Unit)
+        {
+            TIMERA_IntCmd(M0P_TMRA, TIMERA_INT_OVF, Enable);
+            TIMERA_Cmd(M0P_TMRA, Enable);
+        }
+        else
+        {
+            TIMERB_IntCmd(CAP_MEAS_TMRB(u8Unit), TIMERB_IT_OVF, Enable);
+            TIMERB_Start(CAP_MEAS_TMRB(u8Unit));
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the measurement, the counter stops when no channel of the unit runs.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Stop success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or not initialized
+ */
+en_result_t CAP_MEAS_Stop(stc_cap_meas_handle_t *pstcHandle)
+{
+    uint8_t u8Unit;
+    const stc_cap_meas_handle_t *pstcOther;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (pstcHandle->u8Unit < CAP_MEAS_UNIT_NUM) &&
+        (pstcHandle == m_apstcCapMeasHandle[pstcHandle->u8Unit][CapMeasGetSlot(pstcHandle)]))
+    {
+        u8Unit = pstcHandle->u8Unit;
+        pstcHandle->u8Run = 0u;
+        CapMeasSetCondition(pstcHandle, 0u);
+
+        if (CAP_MEAS_MODE_DMA == pstcHandle->u8Mode)
+        {
+            DMA_ChannelDisable(pstcHandle->u8DmaCh);
+            DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Disable);
+            DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+        }
+
+        if (CAP_MEAS_UNIT_TMRA == u8Unit)
+        {
+            if (CAP_MEAS_MODE_IRQ == pstcHandle->u8Mode)
+            {
+                TIMERA_IntCmd(M0P_TMRA, (TIMERA_CHANNEL_CH1 == pstcHandle->u8TmraCh) ?
+                                        TIMERA_INT_CMP1 : TIMERA_INT_CMP2, Disable);
+            }
+            else
+            {
+                TIMERA_EventCmd(M0P_TMRA, (TIMERA_CHANNEL_CH1 == pstcHandle->u8TmraCh) ?
+                                          TIMERA_EVENT_CMP1 : TIMERA_EVENT_CMP2, Disable);
+            }
+
+            pstcOther = m_apstcCapMeasHandle[CAP_MEAS_UNIT_TMRA][pstcHandle->u8TmraCh ^ 1u];
+            if ((NULL == pstcOther) || (0u == pstcOther->u8Run))
+            {
+                TIMERA_IntCmd(M0P_TMRA, TIMERA_INT_OVF, Disable);
+                TIMERA_Cmd(M0P_TMRA, Disable);
+            }
+        }
+        else
+        {
+            TIMERB_IntCmd(CAP_MEAS_TMRB(u8Unit), TIMERB_IT_CMP | TIMERB_IT_OVF, Disable);
+            TIMERB_DisableCmpMatchEvt(CAP_MEAS_TMRB(u8Unit));
+            TIMERB_Stop(CAP_MEAS_TMRB(u8Unit));
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the latest result, lock-free against the interrupts of the measurement.
+ * @note   The result is published by the interrupts with a sequence count and copied
+ *         again if an interrupt published a new one meanwhile. Call it from the main
+ *         loop or from an interrupt of a lower priority than DDL_IRQ_PRIORITY_03.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @param  [out] pstcResult             Pointer to a @ref stc_cap_meas_result_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: A result is got, u32PeriodClk == 0 for no signal
+ *           - ErrorNotReady: No result since the start
+ *           - ErrorInvalidParameter: pstcHandle == NULL or pstcResult == NULL
+ */
+en_result_t CAP_MEAS_GetResult(const stc_cap_meas_handle_t *pstcHandle,
+                               stc_cap_meas_result_t *pstcResult)
+{
+    uint32_t u32Seq;
+    uint32_t u32Count;
+    uint32_t u32Cycles;
+    uint32_t u32Period;
+    uint32_t u32High;
+    uint8_t u8Shift;
+    uint64_t u64Clk;
+    uint64_t u64Tmp;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (NULL != pstcResult))
+    {
+        do
+        {
+            u32Seq    = pstcHandle->u32Seq;
+            u32Count  = pstcHandle->u32PubCount;
+            u32Cycles = pstcHandle->u32PubCycles;
+            u32Period = pstcHandle->u32PubPeriod;
+            u32High   = pstcHandle->u32PubHigh;
+            u8Shift   = pstcHandle->u8PubShift;
+        } while ((0ul != (u32Seq & 1ul)) || (u32Seq != pstcHandle->u32Seq));
+
+        if (0ul == u32Count)
+        {
+            enRet = ErrorNotReady;
+        }
+        else
+        {
+            pstcResult->u32Count = u32Count;
+            if ((0ul == u32Cycles) || (0ul == u32Period))
+            {
+                pstcResult->u32PeriodClk   = 0ul;
+                pstcResult->u32FreqMilliHz = 0ul;
+                pstcResult->u16Duty = (Pin_Set == GPIO_ReadInputPortPin(pstcHandle->u8Port, pstcHandle->u8Pin)) ?
+                                      0x8000u : 0u;
+            }
+            else
+            {
+                /* Sum of the periods in HCLK cycles. */
+                u64Clk = (uint64_t)u32Period << u8Shift;
+
+                u64Tmp = (u64Clk + (u32Cycles >> 1u)) / u32Cycles;
+                pstcResult->u32PeriodClk = (u64Tmp > 0xFFFFFFFFull) ? 0xFFFFFFFFul : (uint32_t)u64Tmp;
+
+                u64Tmp = (((uint64_t)SystemCoreClock * 1000ull * u32Cycles) + (u64Clk >> 1u)) / u64Clk;
+                pstcResult->u32FreqMilliHz = (u64Tmp > 0xFFFFFFFFull) ? 0xFFFFFFFFul : (uint32_t)u64Tmp;
+
+                u64Tmp = ((uint64_t)u32High << 15u) / u32Period;
+                pstcResult->u16Duty = (u64Tmp > 0x8000ull) ? 0x8000u : (uint16_t)u64Tmp;
+            }
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CAP_MEAS_Local_Functions CAP_MEAS Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the slot of the handle in its unit.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval The TimerA channel, 0 for TimerB.
+ */
+static uint8_t CapMeasGetSlot(const stc_cap_meas_handle_t *pstcHandle)
+{
+    return (CAP_MEAS_UNIT_TMRA == pstcHandle->u8Unit) ? (pstcHandle->u8TmraCh & 1u) : 0u;
+}
+
+/**
+ * @brief  Set the capture condition of the channel.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @param  [in] u8EdgeMsk               CAP_MEAS_EDGE_RISING and/or CAP_MEAS_EDGE_FALLING, 0 disables the capture.
+ * @retval None
+ */
+static void CapMeasSetCondition(const stc_cap_meas_handle_t *pstcHandle, uint8_t u8EdgeMsk)
+{
+    uint16_t u16Cond = 0u;
+
+    if (CAP_MEAS_UNIT_TMRA == pstcHandle->u8Unit)
+    {
+        if (0u != (u8EdgeMsk & CAP_MEAS_EDGE_RISING))
+        {
+            u16Cond |= TIMERA_IC_PWM_RISING;
+        }
+        if (0u != (u8EdgeMsk & CAP_MEAS_EDGE_FALLING))
+        {
+            u16Cond |= TIMERA_IC_PWM_FALLING;
+        }
+        TIMERA_IC_SetCaptureCondition(M0P_TMRA, pstcHandle->u8TmraCh, u16Cond);
+    }
+    else
+    {
+        if (0u != (u8EdgeMsk & CAP_MEAS_EDGE_RISING))
+        {
+            u16Cond |= TIMERB_IC_RISING;
+        }
+        if (0u != (u8EdgeMsk & CAP_MEAS_EDGE_FALLING))
+        {
+            u16Cond |= TIMERB_IC_FALLING;
+        }
+        TIMERB_IC_SetCaptureCondition(pstcHandle->TMRBx, u16Cond);
+    }
+}
+
+/**
+ * @brief  Arm the capture for the edge in u8Edge, in IRQ mode.
+ * @note   If the pin already shows the armed edge, the edge came before the capture
+ *         was armed: the timestamps are dropped and the other edge is armed.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval None
+ */
+static void CapMeasArmEdge(stc_cap_meas_handle_t *pstcHandle)
+{
+    en_pin_state_t enLevel;
+
+    CapMeasSetCondition(pstcHandle, pstcHandle->u8Edge);
+    enLevel = GPIO_ReadInputPortPin(pstcHandle->u8Port, pstcHandle->u8Pin);
+    if (((CAP_MEAS_EDGE_RISING == pstcHandle->u8Edge) && (Pin_Set == enLevel)) ||
+        ((CAP_MEAS_EDGE_FALLING == pstcHandle->u8Edge) && (Pin_Reset == enLevel)))
+    {
+        pstcHandle->u8Valid = 0u;
+        pstcHandle->u8Edge ^= CAP_MEAS_EDGE_BOTH;
+        CapMeasSetCondition(pstcHandle, pstcHandle->u8Edge);
+    }
+}
+
+/**
+ * @brief  Set the clock division of a unit, the pending timestamps of its channels
+ *         are dropped.
+ * @param  [in] u8Unit                  Unit index.
+ * @param  [in] u8Shift                 log2 of the division.
+ * @retval None
+ */
+static void CapMeasSetShift(uint8_t u8Unit, uint8_t u8Shift)
+{
+    uint32_t i;
+    stc_cap_meas_handle_t *pstcHandle;
+
+    if (CAP_MEAS_UNIT_TMRA == u8Unit)
+    {
+        TIMERA_SetClkDiv(M0P_TMRA, (uint16_t)((uint32_t)u8Shift << TMRA_BCSTR_CKDIV_POS));
+    }
+    else
+    {
+        TIMERB_SetClkDiv(CAP_MEAS_TMRB(u8Unit), (uint16_t)((uint32_t)u8Shift << TMRB_BCSTR_CKDIV_POS));
+    }
+
+    for (i = 0ul; i < CAP_MEAS_SLOT_NUM; i++)
+    {
+        pstcHandle = m_apstcCapMeasHandle[u8Unit][i];
+        if (NULL != pstcHandle)
+        {
+            pstcHandle->u8DivShift = u8Shift;
+            pstcHandle->u8Valid = 0u;
+            /* The half buffer being filled holds counts of both divisions. */
+            pstcHandle->u8Discard = 1u;
+        }
+    }
+}
+
+/**
+ * @brief  Step the division to keep the period between CAP_MEAS_PERIOD_MIN and
+ *         CAP_MEAS_PERIOD_MAX counts.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @param  [in] u32Period               Period in counts.
+ * @retval None
+ */
+static void CapMeasAutoRange(const stc_cap_meas_handle_t *pstcHandle, uint32_t u32Period)
+{
+    if ((u32Period > CAP_MEAS_PERIOD_MAX) && (pstcHandle->u8DivShift < pstcHandle->u8DivShiftMax))
+    {
+        CapMeasSetShift(pstcHandle->u8Unit, pstcHandle->u8DivShift + 1u);
+    }
+    else if ((u32Period < CAP_MEAS_PERIOD_MIN) && (pstcHandle->u8DivShift > pstcHandle->u8DivShiftMin))
+    {
+        CapMeasSetShift(pstcHandle->u8Unit, pstcHandle->u8DivShift - 1u);
+    }
+    else
+    {
+        /* rsvd */
+    }
+}
+
+/**
+ * @brief  Publish a result for CAP_MEAS_GetResult().
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @param  [in] u32Cycles               Periods in the result, 0 for no signal.
+ * @param  [in] u32Period               Sum of the periods in counts.
+ * @param  [in] u32High                 Sum of the high times in counts.
+ * @retval None
+ */
+static void CapMeasPublish(stc_cap_meas_handle_t *pstcHandle, uint32_t u32Cycles,
+                           uint32_t u32Period, uint32_t u32High)
+{
+    pstcHandle->u32Seq++;
+    pstcHandle->u32PubCycles = u32Cycles;
+    pstcHandle->u32PubPeriod = u32Period;
+    pstcHandle->u32PubHigh   = u32High;
+    pstcHandle->u8PubShift   = pstcHandle->u8DivShift;
+    pstcHandle->u32PubCount++;
+    pstcHandle->u32Seq++;
+}
+
+/**
+ * @brief  Load the descriptor of the first half buffer into the DMA channel.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval None
+ */
+static void CapMeasDmaLoad(const stc_cap_meas_handle_t *pstcHandle)
+{
+    stc_dma_ch_cfg_t stcDmaCfg;
+
+    DMA_ChannelDisable(pstcHandle->u8DmaCh);
+
+    stcDmaCfg.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+    stcDmaCfg.u32BlockSize   = 1ul;
+    stcDmaCfg.u32TransferCnt = pstcHandle->u32EdgePerHalf;
+    stcDmaCfg.u32SrcAddr     = pstcHandle->astcLlpDesc[0u].SARx;
+    stcDmaCfg.u32DesAddr     = pstcHandle->astcLlpDesc[0u].DARx;
+    stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_FIX;
+    stcDmaCfg.u32DesInc      = DMA_DESADDRINC_INC;
+    DMA_ChannelCfg(pstcHandle->u8DmaCh, &stcDmaCfg);
+    DMA_LlpInit(pstcHandle->u8DmaCh, DMA_LLP_WAIT, (uint32_t)(&pstcHandle->astcLlpDesc[1u]));
+}
+
+/**
+ * @brief  An edge is captured in IRQ mode.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_cap_meas_handle_t structure
+ * @retval None
+ */
+static void CapMeasEdge(stc_cap_meas_handle_t *pstcHandle)
+{
+    uint16_t u16Cap;
+    uint32_t u32Ts;
+    uint32_t u32Period;
+    uint8_t u8Pair;
+    en_flag_status_t enOvf;
+
+    u16Cap = *pstcHandle->pu16CapReg;
+    enOvf = (CAP_MEAS_UNIT_TMRA == pstcHandle->u8Unit) ?
+            TIMERA_GetFlag(M0P_TMRA, TIMERA_FLAG_OVF) :
+            TIMERB_GetFlag(pstcHandle->TMRBx, TIMERB_FLAG_OVF);
+    /* A pending overflow with a small capture is older than the capture. */
+    if ((Set == enOvf) && (u16Cap < 0x8000u))
+    {
+        CapMeasOvfHandler(pstcHandle->u8Unit);
+    }
+    u32Ts = (pstcHandle->u32Ovf << 16u) | u16Cap;
+    pstcHandle->u16OvfIdle = 0u;
+
+    if (CAP_MEAS_EDGE_RISING == pstcHandle->u8Edge)
+    {
+        u32Period = u32Ts - pstcHandle->u32Rise;
+        u8Pair = ((CAP_MEAS_VALID_RISE | CAP_MEAS_VALID_FALL) == pstcHandle->u8Valid) ? 1u : 0u;
+        if (0u != u8Pair)
+        {
+            CapMeasPublish(pstcHandle, 1ul, u32Period, pstcHandle->u32Fall - pstcHandle->u32Rise);
+        }
+        pstcHandle->u32Rise = u32Ts;
+        pstcHandle->u8Valid = CAP_MEAS_VALID_RISE;
+        if (0u != u8Pair)
+        {
+            /* A change of the division drops this rising edge as well. */
+            CapMeasAutoRange(pstcHandle, u32Period);
+        }
+    }
+    else if (0u != (pstcHandle->u8Valid & CAP_MEAS_VALID_RISE))
+    {
+        pstcHandle->u32Fall = u32Ts;
+        pstcHandle->u8Valid |= CAP_MEAS_VALID_FALL;
+    }
+    else
+    {
+        /* rsvd */
+    }
+
+    pstcHandle->u8Edge ^= CAP_MEAS_EDGE_BOTH;
+    CapMeasArmEdge(pstcHandle);
+}
+
+/**
+ * @brief  Capture IRQ handler of a unit.
+ * @param  [in] u8Unit                  Unit index.
+ * @retval None
+ */
+static void CapMeasCmpHandler(uint8_t u8Unit)
+{
+    uint32_t i;
+    uint16_t u16Flag;
+    stc_cap_meas_handle_t *pstcHandle;
+
+    for (i = 0ul; i < CAP_MEAS_SLOT_NUM; i++)
+    {
+        pstcHandle = m_apstcCapMeasHandle[u8Unit][i];
+        if ((NULL != pstcHandle) && (0u != pstcHandle->u8Run) &&
+            (CAP_MEAS_MODE_IRQ == pstcHandle->u8Mode))
+        {
+            if (CAP_MEAS_UNIT_TMRA == u8Unit)
+            {
+                u16Flag = (0ul == i) ? TIMERA_FLAG_CMP1 : TIMERA_FLAG_CMP2;
+                if (Set == TIMERA_GetFlag(M0P_TMRA, u16Flag))
+                {
+                    TIMERA_ClearFlag(M0P_TMRA, u16Flag);
+                    CapMeasEdge(pstcHandle);
+                }
+            }
+            else if (Set == TIMERB_GetFlag(pstcHandle->TMRBx, TIMERB_FLAG_CMP))
+            {
+                TIMERB_ClearFlag(pstcHandle->TMRBx, TIMERB_FLAG_CMP);
+                CapMeasEdge(pstcHandle);
+            }
+            else
+            {
+                /* rsvd */
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Overflow IRQ handler of a unit, extends the timestamps and counts the timeout.
+ * @param  [in] u8Unit                  Unit index.
+ * @retval None
+ */
+static void CapMeasOvfHandler(uint8_t u8Unit)
+{
+    uint32_t i;
+    stc_cap_meas_handle_t *pstcHandle;
+
+    if (CAP_MEAS_UNIT_TMRA == u8Unit)
+    {
+        TIMERA_ClearFlag(M0P_TMRA, TIMERA_FLAG_OVF);
+    }
+    else
+    {
+        TIMERB_ClearFlag(CAP_MEAS_TMRB(u8Unit), TIMERB_FLAG_OVF);
+    }
+
+    for (i = 0ul; i < CAP_MEAS_SLOT_NUM; i++)
+    {
+        pstcHandle = m_apstcCapMeasHandle[u8Unit][i];
+        if ((NULL != pstcHandle) && (0u != pstcHandle->u8Run))
+        {
+            pstcHandle->u32Ovf++;
+            if (0u != pstcHandle->u16TimeoutOvf)
+            {
+                pstcHandle->u16OvfIdle++;
+                if (pstcHandle->u16OvfIdle >= pstcHandle->u16TimeoutOvf)
+                {
+                    pstcHandle->u16OvfIdle = 0u;
+                    pstcHandle->u8Valid = 0u;
+                    pstcHandle->u8Discard = 1u;
+                    CapMeasPublish(pstcHandle, 0ul, 0ul, 0ul);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief  DMA transfer complete IRQ handler, a half buffer of captures is filled.
+ * @note   The edges alternate and a half buffer holds an even number of them, so
+ *         every half buffer starts with the edge in u8Edge. The periods and the high
+ *         times are the differences of the captures modulo 65536, a half buffer
+ *         which took more overflows than its differences tell is dropped as aliased.
+ * @param  [in] u8DmaCh                 DMA channel.
+ * @retval None
+ */
+static void CapMeasDmaTcHandler(uint8_t u8DmaCh)
+{
+    uint32_t k;
+    uint32_t u32Offset;
+    uint32_t u32Diff;
+    uint32_t u32All = 0ul;
+    uint32_t u32Period = 0ul;
+    uint32_t u32High = 0ul;
+    uint32_t u32Cycles;
+    uint32_t u32BlockOvf;
+    const uint16_t *pu16Data;
+    stc_cap_meas_handle_t *pstcHandle = m_apstcCapMeasDma[u8DmaCh];
+
+    DMA_ClearCplFlag(u8DmaCh, DMA_FLAG_TC);
+
+    pu16Data = &pstcHandle->pu16Buf[(uint32_t)pstcHandle->u8Half * pstcHandle->u32EdgePerHalf];
+    pstcHandle->u8Half ^= 1u;
+    u32BlockOvf = pstcHandle->u32Ovf - pstcHandle->u32BlockOvf;
+    pstcHandle->u32BlockOvf = pstcHandle->u32Ovf;
+    pstcHandle->u16OvfIdle = 0u;
+
+    if (0u != pstcHandle->u8Discard)
+    {
+        pstcHandle->u8Discard--;
+    }
+    else
+    {
+        /* Complete periods from the first to the last rising edge. */
+        u32Offset = (CAP_MEAS_EDGE_RISING == pstcHandle->u8Edge) ? 0ul : 1ul;
+        u32Cycles = (pstcHandle->u32EdgePerHalf >> 1u) - 1ul;
+        for (k = 0ul; k < (pstcHandle->u32EdgePerHalf - 1ul); k++)
+        {
+            u32Diff = (uint16_t)(pu16Data[k + 1ul] - pu16Data[k]);
+            u32All += u32Diff;
+            if ((k >= u32Offset) && (k < (u32Offset + (u32Cycles << 1u))))
+            {
+                u32Period += u32Diff;
+                if (0ul == ((k - u32Offset) & 1ul))
+                {
+                    u32High += u32Diff;
+                }
+            }
+        }
+
+        /* One overflow more may fall between the half buffers and one at each end. */
+        if (u32BlockOvf > ((u32All >> 16u) + 2ul))
+        {
+            if (pstcHandle->u8DivShift < pstcHandle->u8DivShiftMax)
+            {
+                CapMeasSetShift(pstcHandle->u8Unit, pstcHandle->u8DivShift + 1u);
+            }
+        }
+        else
+        {
+            CapMeasPublish(pstcHandle, u32Cycles, u32Period, u32High);
+            CapMeasAutoRange(pstcHandle, u32Period / u32Cycles);
+        }
+    }
+}
+
+/**
+ * @brief  TimerA capture IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmraCmpIrqCallback(void)
+{
+    CapMeasCmpHandler(0u);
+}
+
+/**
+ * @brief  TimerB unit 1 capture IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb1CmpIrqCallback(void)
+{
+    CapMeasCmpHandler(1u);
+}
+
+/**
+ * @brief  TimerB unit 2 capture IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb2CmpIrqCallback(void)
+{
+    CapMeasCmpHandler(2u);
+}
+
+/**
+ * @brief  TimerB unit 3 capture IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb3CmpIrqCallback(void)
+{
+    CapMeasCmpHandler(3u);
+}
+
+/**
+ * @brief  TimerB unit 4 capture IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb4CmpIrqCallback(void)
+{
+    CapMeasCmpHandler(4u);
+}
+
+/**
+ * @brief  TimerA overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmraOvfIrqCallback(void)
+{
+    CapMeasOvfHandler(0u);
+}
+
+/**
+ * @brief  TimerB unit 1 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb1OvfIrqCallback(void)
+{
+    CapMeasOvfHandler(1u);
+}
+
+/**
+ * @brief  TimerB unit 2 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb2OvfIrqCallback(void)
+{
+    CapMeasOvfHandler(2u);
+}
+
+/**
+ * @brief  TimerB unit 3 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb3OvfIrqCallback(void)
+{
+    CapMeasOvfHandler(3u);
+}
+
+/**
+ * @brief  TimerB unit 4 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasTmrb4OvfIrqCallback(void)
+{
+    CapMeasOvfHandler(4u);
+}
+
+/**
+ * @brief  DMA channel 0 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasDma0TcIrqCallback(void)
+{
+    CapMeasDmaTcHandler(DMA_CHANNEL_0);
+}
+
+/**
+ * @brief  DMA channel 1 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void CapMeasDma1TcIrqCallback(void)
+{
+    CapMeasDmaTcHandler(DMA_CHANNEL_1);
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_CAP_MEAS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
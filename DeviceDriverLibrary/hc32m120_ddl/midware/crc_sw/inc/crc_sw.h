@@ -0,0 +1,205 @@
+/**
+ *******************************************************************************
+ * @file  crc_sw.h
+ * @brief This file contains all the functions prototypes of the software CRC
+ *        midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Heqb            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __CRC_SW_H__
+#define __CRC_SW_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#if defined (CRC_SW_HOST)
+#include <stdint.h>
+#include <stddef.h>
+#else
+#include "hc32_ddl.h"
+#endif /* CRC_SW_HOST */
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_CRC_SW
+ * @{
+ */
+
+#if defined (CRC_SW_HOST) || (MW_CRC_SW_ENABLE == DDL_ON)
+
+#if !defined (CRC_SW_HOST) && (DDL_CRC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CRC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+#if defined (CRC_SW_HOST)
+/**
+ * @defgroup CRC_SW_Global_Types CRC_SW Global Types
+ * @{
+ */
+
+/**
+ * @brief Flag status of the host build, same values as hc32_common.h
+ */
+typedef enum
+{
+    Reset = 0u,
+    Set   = 1u,
+} en_flag_status_t;
+
+/**
+ * @}
+ */
+#endif /* CRC_SW_HOST */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CRC_SW_Global_Macros CRC_SW Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup CRC_SW_Table_Type CRC_SW Table Type
+ * @brief Lookup table of the software CRC, define CRC_SW_TABLE_TYPE in ddl_config.h
+ *        (or on the command line of the host build) to override the default.
+ * @{
+ */
+#define CRC_SW_TABLE_NIBBLE         (0u)    /*!< 16 entries, 64 bytes flash for CRC32, 2 lookups per byte. */
+#define CRC_SW_TABLE_BYTE           (1u)    /*!< 256 entries, 1K bytes flash for CRC32, 1 lookup per byte. */
+#define CRC_SW_TABLE_SLICE4         (2u)    /*!< 4 * 256 entries, 4K bytes for CRC32, 4 bytes per step. */
+
+#ifndef CRC_SW_TABLE_TYPE
+#if defined (CRC_SW_HOST)
+#define CRC_SW_TABLE_TYPE           (CRC_SW_TABLE_SLICE4)
+#else
+#define CRC_SW_TABLE_TYPE           (CRC_SW_TABLE_NIBBLE)
+#endif /* CRC_SW_HOST */
+#endif /* CRC_SW_TABLE_TYPE */
+/**
+ * @}
+ */
+
+#if defined (CRC_SW_HOST)
+/**
+ * @defgroup CRC_SW_Host_Protocol CRC_SW Host Protocol
+ * @brief Same values as @ref CRC_Protocol_Control_Bit and @ref CRC_Bit_Width of the CRC driver.
+ * @{
+ */
+#define CRC_CRC16                   (0x0ul)
+#define CRC_CRC32                   (0x1ul)
+
+#define CRC_BW_8                    (8u)
+#define CRC_BW_16                   (16u)
+#define CRC_BW_32                   (32u)
+/**
+ * @}
+ */
+#endif /* CRC_SW_HOST */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup CRC_SW_Global_Functions
+ * @{
+ */
+uint32_t CRC_SW_Calculate(uint32_t u32CrcProtocol,
+                          const void *pvData,
+                          uint32_t u32InitVal,
+                          uint32_t u32Length,
+                          uint8_t u8BitWidth);
+en_flag_status_t CRC_SW_Check(uint32_t u32CrcProtocol,
+                              uint32_t u32CheckSum,
+                              const void *pvData,
+                              uint32_t u32InitVal,
+                              uint32_t u32Length,
+                              uint8_t u8BitWidth);
+/**
+ * @}
+ */
+
+#endif /* CRC_SW_HOST || MW_CRC_SW_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC_SW_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,759 @@
+/**
+ *******************************************************************************
+ * @file  crc_sw.c
+ * @brief This midware file provides the table driven software CRC16/CRC32
+ *        which gives the same checksum as the CRC unit.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Heqb            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "crc_sw.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_CRC_SW CRC_SW
+ * @brief Software CRC Midware Library
+ * @{
+ */
+
+#if defined (CRC_SW_HOST) || (MW_CRC_SW_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup CRC_SW_Local_Macros CRC_SW Local Macros
+ * @{
+ */
+
+/**
+ * @defgroup CRC_SW_Table_Step CRC_SW Table Step
+ * @brief Shift one byte(already XORed into the low byte of crc) out of the reflected
+ *        CRC register. The CRC16 register is kept zero extended in 32 bits.
+ * @{
+ */
+#if (CRC_SW_TABLE_TYPE == CRC_SW_TABLE_NIBBLE)
+#define CRC_SW_BYTE_STEP(crc, tbl)                                             \
+do {                                                                           \
+    (crc) = ((crc) >> 4u) ^ (uint32_t)(tbl)[(crc) & 0x0Ful];                   \
+    (crc) = ((crc) >> 4u) ^ (uint32_t)(tbl)[(crc) & 0x0Ful];                   \
+} while (0)
+#define CRC16_SW_TABLE              (m_au16Crc16Table)
+#define CRC32_SW_TABLE              (m_au32Crc32Table)
+#elif (CRC_SW_TABLE_TYPE == CRC_SW_TABLE_BYTE)
+#define CRC_SW_BYTE_STEP(crc, tbl)                                             \
+do {                                                                           \
+    (crc) = ((crc) >> 8u) ^ (uint32_t)(tbl)[(crc) & 0xFFul];                   \
+} while (0)
+#define CRC16_SW_TABLE              (m_au16Crc16Table)
+#define CRC32_SW_TABLE              (m_au32Crc32Table)
+#elif (CRC_SW_TABLE_TYPE == CRC_SW_TABLE_SLICE4)
+#define CRC_SW_BYTE_STEP(crc, tbl)                                             \
+do {                                                                           \
+    (crc) = ((crc) >> 8u) ^ (uint32_t)(tbl)[(crc) & 0xFFul];                   \
+} while (0)
+/* Table[k] is the CRC of one byte followed by k zero bytes. */
+#define CRC_SW_WORD_STEP(crc, tbl)                                             \
+do {                                                                           \
+    (crc) = (uint32_t)(tbl)[3u][(crc) & 0xFFul]           ^                    \
+            (uint32_t)(tbl)[2u][((crc) >> 8u) & 0xFFul]   ^                    \
+            (uint32_t)(tbl)[1u][((crc) >> 16u) & 0xFFul]  ^                    \
+            (uint32_t)(tbl)[0u][(crc) >> 24u];                                 \
+} while (0)
+#define CRC16_SW_TABLE              (m_au16Crc16Table[0u])
+#define CRC32_SW_TABLE              (m_au32Crc32Table[0u])
+#else
+#error "CRC_SW_TABLE_TYPE must be a value of @ref CRC_SW_Table_Type"
+#endif
+/**
+ * @}
+ */
+
+#define IS_CRC_SW_BIT_WIDTH(x)                                                 \
+(   ((x) == CRC_BW_8)                           ||                             \
+    ((x) == CRC_BW_16)                          ||                             \
+    ((x) == CRC_BW_32))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t CRC_SW_Process(uint32_t u32CrcProtocol,
+                               uint32_t u32Crc,
+                               const void *pvData,
+                               uint32_t u32Length,
+                               uint8_t u8BitWidth);
+static uint32_t CRC_SW_Unit(uint32_t u32CrcProtocol,
+                            uint32_t u32Crc,
+                            uint32_t u32Data,
+                            uint32_t u32Bytes);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Tables of the reflected polynomials 0x8408(CRC16) and 0xEDB88320(CRC32). */
+#if (CRC_SW_TABLE_TYPE == CRC_SW_TABLE_NIBBLE)
+static const uint16_t m_au16Crc16Table[16] =
+{
+    0x0000u, 0x1081u, 0x2102u, 0x3183u, 0x4204u, 0x5285u, 0x6306u, 0x7387u,
+    0x8408u, 0x9489u, 0xA50Au, 0xB58Bu, 0xC60Cu, 0xD68Du, 0xE70Eu, 0xF78Fu
+};
+
+static const uint32_t m_au32Crc32Table[16] =
+{
+    0x00000000ul, 0x1DB71064ul, 0x3B6E20C8ul, 0x26D930ACul, 0x76DC4190ul, 0x6B6B51F4ul, 0x4DB26158ul, 0x5005713Cul,
+    0xEDB88320ul, 0xF00F9344ul, 0xD6D6A3E8ul, 0xCB61B38Cul, 0x9B64C2B0ul, 0x86D3D2D4ul, 0xA00AE278ul, 0xBDBDF21Cul
+};
+#elif (CRC_SW_TABLE_TYPE == CRC_SW_TABLE_BYTE)
+static const uint16_t m_au16Crc16Table[256] =
+{
+    0x0000u, 0x1189u, 0x2312u, 0x329Bu, 0x4624u, 0x57ADu, 0x6536u, 0x74BFu,
+    0x8C48u, 0x9DC1u, 0xAF5Au, 0xBED3u, 0xCA6Cu, 0xDBE5u, 0xE97Eu, 0xF8F7u,
+    0x1081u, 0x0108u, 0x3393u, 0x221Au, 0x56A5u, 0x472Cu, 0x75B7u, 0x643Eu,
+    0x9CC9u, 0x8D40u, 0xBFDBu, 0xAE52u, 0xDAEDu, 0xCB64u, 0xF9FFu, 0xE876u,
+    0x2102u, 0x308Bu, 0x0210u, 0x1399u, 0x6726u, 0x76AFu, 0x4434u, 0x55BDu,
+    0xAD4Au, 0xBCC3u, 0x8E58u, 0x9FD1u, 0xEB6Eu, 0xFAE7u, 0xC87Cu, 0xD9F5u,
+    0x3183u, 0x200Au, 0x1291u, 0x0318u, 0x77A7u, 0x662Eu, 0x54B5u, 0x453Cu,
+    0xBDCBu, 0xAC42u, 0x9ED9u, 0x8F50u, 0xFBEFu, 0xEA66u, 0xD8FDu, 0xC974u,
+    0x4204u, 0x538Du, 0x6116u, 0x709Fu, 0x0420u, 0x15A9u, 0x2732u, 0x36BBu,
+    0xCE4Cu, 0xDFC5u, 0xED5Eu, 0xFCD7u, 0x8868u, 0x99E1u, 0xAB7Au, 0xBAF3u,
+    0x5285u, 0x430Cu, 0x7197u, 0x601Eu, 0x14A1u, 0x0528u, 0x37B3u, 0x263Au,
+    0xDECDu, 0xCF44u, 0xFDDFu, 0xEC56u, 0x98E9u, 0x8960u, 0xBBFBu, 0xAA72u,
+    0x6306u, 0x728Fu, 0x4014u, 0x519Du, 0x2522u, 0x34ABu, 0x0630u, 0x17B9u,
+    0xEF4Eu, 0xFEC7u, 0xCC5Cu, 0xDDD5u, 0xA96Au, 0xB8E3u, 0x8A78u, 0x9BF1u,
+    0x7387u, 0x620Eu, 0x5095u, 0x411Cu, 0x35A3u, 0x242Au, 0x16B1u, 0x0738u,
+    0xFFCFu, 0xEE46u, 0xDCDDu, 0xCD54u, 0xB9EBu, 0xA862u, 0x9AF9u, 0x8B70u,
+    0x8408u, 0x9581u, 0xA71Au, 0xB693u, 0xC22Cu, 0xD3A5u, 0xE13Eu, 0xF0B7u,
+    0x0840u, 0x19C9u, 0x2B52u, 0x3ADBu, 0x4E64u, 0x5FEDu, 0x6D76u, 0x7CFFu,
+    0x9489u, 0x8500u, 0xB79Bu, 0xA612u, 0xD2ADu, 0xC324u, 0xF1BFu, 0xE036u,
+    0x18C1u, 0x0948u, 0x3BD3u, 0x2A5Au, 0x5EE5u, 0x4F6Cu, 0x7DF7u, 0x6C7Eu,
+    0xA50Au, 0xB483u, 0x8618u, 0x9791u, 0xE32Eu, 0xF2A7u, 0xC03Cu, 0xD1B5u,
+    0x2942u, 0x38CBu, 0x0A50u, 0x1BD9u, 0x6F66u, 0x7EEFu, 0x4C74u, 0x5DFDu,
+    0xB58Bu, 0xA402u, 0x9699u, 0x8710u, 0xF3AFu, 0xE226u, 0xD0BDu, 0xC134u,
+    0x39C3u, 0x284Au, 0x1AD1u, 0x0B58u, 0x7FE7u, 0x6E6Eu, 0x5CF5u, 0x4D7Cu,
+    0xC60Cu, 0xD785u, 0xE51Eu, 0xF497u, 0x8028u, 0x91A1u, 0xA33Au, 0xB2B3u,
+    0x4A44u, 0x5BCDu, 0x6956u, 0x78DFu, 0x0C60u, 0x1DE9u, 0x2F72u, 0x3EFBu,
+    0xD68Du, 0xC704u, 0xF59Fu, 0xE416u, 0x90A9u, 0x8120u, 0xB3BBu, 0xA232u,
+    0x5AC5u, 0x4B4Cu, 0x79D7u, 0x685Eu, 0x1CE1u, 0x0D68u, 0x3FF3u, 0x2E7Au,
+    0xE70Eu, 0xF687u, 0xC41Cu, 0xD595u, 0xA12Au, 0xB0A3u, 0x8238u, 0x93B1u,
+    0x6B46u, 0x7ACFu, 0x4854u, 0x59DDu, 0x2D62u, 0x3CEBu, 0x0E70u, 0x1FF9u,
+    0xF78Fu, 0xE606u, 0xD49Du, 0xC514u, 0xB1ABu, 0xA022u, 0x92B9u, 0x8330u,
+    0x7BC7u, 0x6A4Eu, 0x58D5u, 0x495Cu, 0x3DE3u, 0x2C6Au, 0x1EF1u, 0x0F78u
+};
+
+static const uint32_t m_au32Crc32Table[256] =
+{
+    0x00000000ul, 0x77073096ul, 0xEE0E612Cul, 0x990951BAul, 0x076DC419ul, 0x706AF48Ful, 0xE963A535ul, 0x9E6495A3ul,
+    0x0EDB8832ul, 0x79DCB8A4ul, 0xE0D5E91Eul, 0x97D2D988ul, 0x09B64C2Bul, 0x7EB17CBDul, 0xE7B82D07ul, 0x90BF1D91ul,
+    0x1DB71064ul, 0x6AB020F2ul, 0xF3B97148ul, 0x84BE41DEul, 0x1ADAD47Dul, 0x6DDDE4EBul, 0xF4D4B551ul, 0x83D385C7ul,
+    0x136C9856ul, 0x646BA8C0ul, 0xFD62F97Aul, 0x8A65C9ECul, 0x14015C4Ful, 0x63066CD9ul, 0xFA0F3D63ul, 0x8D080DF5ul,
+    0x3B6E20C8ul, 0x4C69105Eul, 0xD56041E4ul, 0xA2677172ul, 0x3C03E4D1ul, 0x4B04D447ul, 0xD20D85FDul, 0xA50AB56Bul,
+    0x35B5A8FAul, 0x42B2986Cul, 0xDBBBC9D6ul, 0xACBCF940ul, 0x32D86CE3ul, 0x45DF5C75ul, 0xDCD60DCFul, 0xABD13D59ul,
+    0x26D930ACul, 0x51DE003Aul, 0xC8D75180ul, 0xBFD06116ul, 0x21B4F4B5ul, 0x56B3C423ul, 0xCFBA9599ul, 0xB8BDA50Ful,
+    0x2802B89Eul, 0x5F058808ul, 0xC60CD9B2ul, 0xB10BE924ul, 0x2F6F7C87ul, 0x58684C11ul, 0xC1611DABul, 0xB6662D3Dul,
+    0x76DC4190ul, 0x01DB7106ul, 0x98D220BCul, 0xEFD5102Aul, 0x71B18589ul, 0x06B6B51Ful, 0x9FBFE4A5ul, 0xE8B8D433ul,
+    0x7807C9A2ul, 0x0F00F934ul, 0x9609A88Eul, 0xE10E9818ul, 0x7F6A0DBBul, 0x086D3D2Dul, 0x91646C97ul, 0xE6635C01ul,
+    0x6B6B51F4ul, 0x1C6C6162ul, 0x856530D8ul, 0xF262004Eul, 0x6C0695EDul, 0x1B01A57Bul, 0x8208F4C1ul, 0xF50FC457ul,
+    0x65B0D9C6ul, 0x12B7E950ul, 0x8BBEB8EAul, 0xFCB9887Cul, 0x62DD1DDFul, 0x15DA2D49ul, 0x8CD37CF3ul, 0xFBD44C65ul,
+    0x4DB26158ul, 0x3AB551CEul, 0xA3BC0074ul, 0xD4BB30E2ul, 0x4ADFA541ul, 0x3DD895D7ul, 0xA4D1C46Dul, 0xD3D6F4FBul,
+    0x4369E96Aul, 0x346ED9FCul, 0xAD678846ul, 0xDA60B8D0ul, 0x44042D73ul, 0x33031DE5ul, 0xAA0A4C5Ful, 0xDD0D7CC9ul,
+    0x5005713Cul, 0x270241AAul, 0xBE0B1010ul, 0xC90C2086ul, 0x5768B525ul, 0x206F85B3ul, 0xB966D409ul, 0xCE61E49Ful,
+    0x5EDEF90Eul, 0x29D9C998ul, 0xB0D09822ul, 0xC7D7A8B4ul, 0x59B33D17ul, 0x2EB40D81ul, 0xB7BD5C3Bul, 0xC0BA6CADul,
+    0xEDB88320ul, 0x9ABFB3B6ul, 0x03B6E20Cul, 0x74B1D29Aul, 0xEAD54739ul, 0x9DD277AFul, 0x04DB2615ul, 0x73DC1683ul,
+    0xE3630B12ul, 0x94643B84ul, 0x0D6D6A3Eul, 0x7A6A5AA8ul, 0xE40ECF0Bul, 0x9309FF9Dul, 0x0A00AE27ul, 0x7D079EB1ul,
+    0xF00F9344ul, 0x8708A3D2ul, 0x1E01F268ul, 0x6906C2FEul, 0xF762575Dul, 0x806567CBul, 0x196C3671ul, 0x6E6B06E7ul,
+    0xFED41B76ul, 0x89D32BE0ul, 0x10DA7A5Aul, 0x67DD4ACCul, 0xF9B9DF6Ful, 0x8EBEEFF9ul, 0x17B7BE43ul, 0x60B08ED5ul,
+    0xD6D6A3E8ul, 0xA1D1937Eul, 0x38D8C2C4ul, 0x4FDFF252ul, 0xD1BB67F1ul, 0xA6BC5767ul, 0x3FB506DDul, 0x48B2364Bul,
+    0xD80D2BDAul, 0xAF0A1B4Cul, 0x36034AF6ul, 0x41047A60ul, 0xDF60EFC3ul, 0xA867DF55ul, 0x316E8EEFul, 0x4669BE79ul,
+    0xCB61B38Cul, 0xBC66831Aul, 0x256FD2A0ul, 0x5268E236ul, 0xCC0C7795ul, 0xBB0B4703ul, 0x220216B9ul, 0x5505262Ful,
+    0xC5BA3BBEul, 0xB2BD0B28ul, 0x2BB45A92ul, 0x5CB36A04ul, 0xC2D7FFA7ul, 0xB5D0CF31ul, 0x2CD99E8Bul, 0x5BDEAE1Dul,
+    0x9B64C2B0ul, 0xEC63F226ul, 0x756AA39Cul, 0x026D930Aul, 0x9C0906A9ul, 0xEB0E363Ful, 0x72076785ul, 0x05005713ul,
+    0x95BF4A82ul, 0xE2B87A14ul, 0x7BB12BAEul, 0x0CB61B38ul, 0x92D28E9Bul, 0xE5D5BE0Dul, 0x7CDCEFB7ul, 0x0BDBDF21ul,
+    0x86D3D2D4ul, 0xF1D4E242ul, 0x68DDB3F8ul, 0x1FDA836Eul, 0x81BE16CDul, 0xF6B9265Bul, 0x6FB077E1ul, 0x18B74777ul,
+    0x88085AE6ul, 0xFF0F6A70ul, 0x66063BCAul, 0x11010B5Cul, 0x8F659EFFul, 0xF862AE69ul, 0x616BFFD3ul, 0x166CCF45ul,
+    0xA00AE278ul, 0xD70DD2EEul, 0x4E048354ul, 0x3903B3C2ul, 0xA7672661ul, 0xD06016F7ul, 0x4969474Dul, 0x3E6E77DBul,
+    0xAED16A4Aul, 0xD9D65ADCul, 0x40DF0B66ul, 0x37D83BF0ul, 0xA9BCAE53ul, 0xDEBB9EC5ul, 0x47B2CF7Ful, 0x30B5FFE9ul,
+    0xBDBDF21Cul, 0xCABAC28Aul, 0x53B39330ul, 0x24B4A3A6ul, 0xBAD03605ul, 0xCDD70693ul, 0x54DE5729ul, 0x23D967BFul,
+    0xB3667A2Eul, 0xC4614AB8ul, 0x5D681B02ul, 0x2A6F2B94ul, 0xB40BBE37ul, 0xC30C8EA1ul, 0x5A05DF1Bul, 0x2D02EF8Dul
+};
+#else
+static const uint16_t m_au16Crc16Table[4][256] =
+{
+    {
+        0x0000u, 0x1189u, 0x2312u, 0x329Bu, 0x4624u, 0x57ADu, 0x6536u, 0x74BFu,
+        0x8C48u, 0x9DC1u, 0xAF5Au, 0xBED3u, 0xCA6Cu, 0xDBE5u, 0xE97Eu, 0xF8F7u,
+        0x1081u, 0x0108u, 0x3393u, 0x221Au, 0x56A5u, 0x472Cu, 0x75B7u, 0x643Eu,
+        0x9CC9u, 0x8D40u, 0xBFDBu, 0xAE52u, 0xDAEDu, 0xCB64u, 0xF9FFu, 0xE876u,
+        0x2102u, 0x308Bu, 0x0210u, 0x1399u, 0x6726u, 0x76AFu, 0x4434u, 0x55BDu,
+        0xAD4Au, 0xBCC3u, 0x8E58u, 0x9FD1u, 0xEB6Eu, 0xFAE7u, 0xC87Cu, 0xD9F5u,
+        0x3183u, 0x200Au, 0x1291u, 0x0318u, 0x77A7u, 0x662Eu, 0x54B5u, 0x453Cu,
+        0xBDCBu, 0xAC42u, 0x9ED9u, 0x8F50u, 0xFBEFu, 0xEA66u, 0xD8FDu, 0xC974u,
+        0x4204u, 0x538Du, 0x6116u, 0x709Fu, 0x0420u, 0x15A9u, 0x2732u, 0x36BBu,
+        0xCE4Cu, 0xDFC5u, 0xED5Eu, 0xFCD7u, 0x8868u, 0x99E1u, 0xAB7Au, 0xBAF3u,
+        0x5285u, 0x430Cu, 0x7197u, 0x601Eu, 0x14A1u, 0x0528u, 0x37B3u, 0x263Au,
+        0xDECDu, 0xCF44u, 0xFDDFu, 0xEC56u, 0x98E9u, 0x8960u, 0xBBFBu, 0xAA72u,
+        0x6306u, 0x728Fu, 0x4014u, 0x519Du, 0x2522u, 0x34ABu, 0x0630u, 0x17B9u,
+        0xEF4Eu, 0xFEC7u, 0xCC5Cu, 0xDDD5u, 0xA96Au, 0xB8E3u, 0x8A78u, 0x9BF1u,
+        0x7387u, 0x620Eu, 0x5095u, 0x411Cu, 0x35A3u, 0x242Au, 0x16B1u, 0x0738u,
+        0xFFCFu, 0xEE46u, 0xDCDDu, 0xCD54u, 0xB9EBu, 0xA862u, 0x9AF9u, 0x8B70u,
+        0x8408u, 0x9581u, 0xA71Au, 0xB693u, 0xC22Cu, 0xD3A5u, 0xE13Eu, 0xF0B7u,
+        0x0840u, 0x19C9u, 0x2B52u, 0x3ADBu, 0x4E64u, 0x5FEDu, 0x6D76u, 0x7CFFu,
+        0x9489u, 0x8500u, 0xB79Bu, 0xA612u, 0xD2ADu, 0xC324u, 0xF1BFu, 0xE036u,
+        0x18C1u, 0x0948u, 0x3BD3u, 0x2A5Au, 0x5EE5u, 0x4F6Cu, 0x7DF7u, 0x6C7Eu,
+        0xA50Au, 0xB483u, 0x8618u, 0x9791u, 0xE32Eu, 0xF2A7u, 0xC03Cu, 0xD1B5u,
+        0x2942u, 0x38CBu, 0x0A50u, 0x1BD9u, 0x6F66u, 0x7EEFu, 0x4C74u, 0x5DFDu,
+        0xB58Bu, 0xA402u, 0x9699u, 0x8710u, 0xF3AFu, 0xE226u, 0xD0BDu, 0xC134u,
+        0x39C3u, 0x284Au, 0x1AD1u, 0x0B58u, 0x7FE7u, 0x6E6Eu, 0x5CF5u, 0x4D7Cu,
+        0xC60Cu, 0xD785u, 0xE51Eu, 0xF497u, 0x8028u, 0x91A1u, 0xA33Au, 0xB2B3u,
+        0x4A44u, 0x5BCDu, 0x6956u, 0x78DFu, 0x0C60u, 0x1DE9u, 0x2F72u, 0x3EFBu,
+        0xD68Du, 0xC704u, 0xF59Fu, 0xE416u, 0x90A9u, 0x8120u, 0xB3BBu, 0xA232u,
+        0x5AC5u, 0x4B4Cu, 0x79D7u, 0x685Eu, 0x1CE1u, 0x0D68u, 0x3FF3u, 0x2E7Au,
+        0xE70Eu, 0xF687u, 0xC41Cu, 0xD595u, 0xA12Au, 0xB0A3u, 0x8238u, 0x93B1u,
+        0x6B46u, 0x7ACFu, 0x4854u, 0x59DDu, 0x2D62u, 0x3CEBu, 0x0E70u, 0x1FF9u,
+        0xF78Fu, 0xE606u, 0xD49Du, 0xC514u, 0xB1ABu, 0xA022u, 0x92B9u, 0x8330u,
+        0x7BC7u, 0x6A4Eu, 0x58D5u, 0x495Cu, 0x3DE3u, 0x2C6Au, 0x1EF1u, 0x0F78u
+    },
+    {
+        0x0000u, 0x19D8u, 0x33B0u, 0x2A68u, 0x6760u, 0x7EB8u, 0x54D0u, 0x4D08u,
+        0xCEC0u, 0xD718u, 0xFD70u, 0xE4A8u, 0xA9A0u, 0xB078u, 0x9A10u, 0x83C8u,
+        0x9591u, 0x8C49u, 0xA621u, 0xBFF9u, 0xF2F1u, 0xEB29u, 0xC141u, 0xD899u,
+        0x5B51u, 0x4289u, 0x68E1u, 0x7139u, 0x3C31u, 0x25E9u, 0x0F81u, 0x1659u,
+        0x2333u, 0x3AEBu, 0x1083u, 0x095Bu, 0x4453u, 0x5D8Bu, 0x77E3u, 0x6E3Bu,
+        0xEDF3u, 0xF42Bu, 0xDE43u, 0xC79Bu, 0x8A93u, 0x934Bu, 0xB923u, 0xA0FBu,
+        0xB6A2u, 0xAF7Au, 0x8512u, 0x9CCAu, 0xD1C2u, 0xC81Au, 0xE272u, 0xFBAAu,
+        0x7862u, 0x61BAu, 0x4BD2u, 0x520Au, 0x1F02u, 0x06DAu, 0x2CB2u, 0x356Au,
+        0x4666u, 0x5FBEu, 0x75D6u, 0x6C0Eu, 0x2106u, 0x38DEu, 0x12B6u, 0x0B6Eu,
+        0x88A6u, 0x917Eu, 0xBB16u, 0xA2CEu, 0xEFC6u, 0xF61Eu, 0xDC76u, 0xC5AEu,
+        0xD3F7u, 0xCA2Fu, 0xE047u, 0xF99Fu, 0xB497u, 0xAD4Fu, 0x8727u, 0x9EFFu,
+        0x1D37u, 0x04EFu, 0x2E87u, 0x375Fu, 0x7A57u, 0x638Fu, 0x49E7u, 0x503Fu,
+        0x6555u, 0x7C8Du, 0x56E5u, 0x4F3Du, 0x0235u, 0x1BEDu, 0x3185u, 0x285Du,
+        0xAB95u, 0xB24Du, 0x9825u, 0x81FDu, 0xCCF5u, 0xD52Du, 0xFF45u, 0xE69Du,
+        0xF0C4u, 0xE91Cu, 0xC374u, 0xDAACu, 0x97A4u, 0x8E7Cu, 0xA414u, 0xBDCCu,
+        0x3E04u, 0x27DCu, 0x0DB4u, 0x146Cu, 0x5964u, 0x40BCu, 0x6AD4u, 0x730Cu,
+        0x8CCCu, 0x9514u, 0xBF7Cu, 0xA6A4u, 0xEBACu, 0xF274u, 0xD81Cu, 0xC1C4u,
+        0x420Cu, 0x5BD4u, 0x71BCu, 0x6864u, 0x256Cu, 0x3CB4u, 0x16DCu, 0x0F04u,
+        0x195Du, 0x0085u, 0x2AEDu, 0x3335u, 0x7E3Du, 0x67E5u, 0x4D8Du, 0x5455u,
+        0xD79Du, 0xCE45u, 0xE42Du, 0xFDF5u, 0xB0FDu, 0xA925u, 0x834Du, 0x9A95u,
+        0xAFFFu, 0xB627u, 0x9C4Fu, 0x8597u, 0xC89Fu, 0xD147u, 0xFB2Fu, 0xE2F7u,
+        0x613Fu, 0x78E7u, 0x528Fu, 0x4B57u, 0x065Fu, 0x1F87u, 0x35EFu, 0x2C37u,
+        0x3A6Eu, 0x23B6u, 0x09DEu, 0x1006u, 0x5D0Eu, 0x44D6u, 0x6EBEu, 0x7766u,
+        0xF4AEu, 0xED76u, 0xC71Eu, 0xDEC6u, 0x93CEu, 0x8A16u, 0xA07Eu, 0xB9A6u,
+        0xCAAAu, 0xD372u, 0xF91Au, 0xE0C2u, 0xADCAu, 0xB412u, 0x9E7Au, 0x87A2u,
+        0x046Au, 0x1DB2u, 0x37DAu, 0x2E02u, 0x630Au, 0x7AD2u, 0x50BAu, 0x4962u,
+        0x5F3Bu, 0x46E3u, 0x6C8Bu, 0x7553u, 0x385Bu, 0x2183u, 0x0BEBu, 0x1233u,
+        0x91FBu, 0x8823u, 0xA24Bu, 0xBB93u, 0xF69Bu, 0xEF43u, 0xC52Bu, 0xDCF3u,
+        0xE999u, 0xF041u, 0xDA29u, 0xC3F1u, 0x8EF9u, 0x9721u, 0xBD49u, 0xA491u,
+        0x2759u, 0x3E81u, 0x14E9u, 0x0D31u, 0x4039u, 0x59E1u, 0x7389u, 0x6A51u,
+        0x7C08u, 0x65D0u, 0x4FB8u, 0x5660u, 0x1B68u, 0x02B0u, 0x28D8u, 0x3100u,
+        0xB2C8u, 0xAB10u, 0x8178u, 0x98A0u, 0xD5A8u, 0xCC70u, 0xE618u, 0xFFC0u
+    },
+    {
+        0x0000u, 0x5ADCu, 0xB5B8u, 0xEF64u, 0x6361u, 0x39BDu, 0xD6D9u, 0x8C05u,
+        0xC6C2u, 0x9C1Eu, 0x737Au, 0x29A6u, 0xA5A3u, 0xFF7Fu, 0x101Bu, 0x4AC7u,
+        0x8595u, 0xDF49u, 0x302Du, 0x6AF1u, 0xE6F4u, 0xBC28u, 0x534Cu, 0x0990u,
+        0x4357u, 0x198Bu, 0xF6EFu, 0xAC33u, 0x2036u, 0x7AEAu, 0x958Eu, 0xCF52u,
+        0x033Bu, 0x59E7u, 0xB683u, 0xEC5Fu, 0x605Au, 0x3A86u, 0xD5E2u, 0x8F3Eu,
+        0xC5F9u, 0x9F25u, 0x7041u, 0x2A9Du, 0xA698u, 0xFC44u, 0x1320u, 0x49FCu,
+        0x86AEu, 0xDC72u, 0x3316u, 0x69CAu, 0xE5CFu, 0xBF13u, 0x5077u, 0x0AABu,
+        0x406Cu, 0x1AB0u, 0xF5D4u, 0xAF08u, 0x230Du, 0x79D1u, 0x96B5u, 0xCC69u,
+        0x0676u, 0x5CAAu, 0xB3CEu, 0xE912u, 0x6517u, 0x3FCBu, 0xD0AFu, 0x8A73u,
+        0xC0B4u, 0x9A68u, 0x750Cu, 0x2FD0u, 0xA3D5u, 0xF909u, 0x166Du, 0x4CB1u,
+        0x83E3u, 0xD93Fu, 0x365Bu, 0x6C87u, 0xE082u, 0xBA5Eu, 0x553Au, 0x0FE6u,
+        0x4521u, 0x1FFDu, 0xF099u, 0xAA45u, 0x2640u, 0x7C9Cu, 0x93F8u, 0xC924u,
+        0x054Du, 0x5F91u, 0xB0F5u, 0xEA29u, 0x662Cu, 0x3CF0u, 0xD394u, 0x8948u,
+        0xC38Fu, 0x9953u, 0x7637u, 0x2CEBu, 0xA0EEu, 0xFA32u, 0x1556u, 0x4F8Au,
+        0x80D8u, 0xDA04u, 0x3560u, 0x6FBCu, 0xE3B9u, 0xB965u, 0x5601u, 0x0CDDu,
+        0x461Au, 0x1CC6u, 0xF3A2u, 0xA97Eu, 0x257Bu, 0x7FA7u, 0x90C3u, 0xCA1Fu,
+        0x0CECu, 0x5630u, 0xB954u, 0xE388u, 0x6F8Du, 0x3551u, 0xDA35u, 0x80E9u,
+        0xCA2Eu, 0x90F2u, 0x7F96u, 0x254Au, 0xA94Fu, 0xF393u, 0x1CF7u, 0x462Bu,
+        0x8979u, 0xD3A5u, 0x3CC1u, 0x661Du, 0xEA18u, 0xB0C4u, 0x5FA0u, 0x057Cu,
+        0x4FBBu, 0x1567u, 0xFA03u, 0xA0DFu, 0x2CDAu, 0x7606u, 0x9962u, 0xC3BEu,
+        0x0FD7u, 0x550Bu, 0xBA6Fu, 0xE0B3u, 0x6CB6u, 0x366Au, 0xD90Eu, 0x83D2u,
+        0xC915u, 0x93C9u, 0x7CADu, 0x2671u, 0xAA74u, 0xF0A8u, 0x1FCCu, 0x4510u,
+        0x8A42u, 0xD09Eu, 0x3FFAu, 0x6526u, 0xE923u, 0xB3FFu, 0x5C9Bu, 0x0647u,
+        0x4C80u, 0x165Cu, 0xF938u, 0xA3E4u, 0x2FE1u, 0x753Du, 0x9A59u, 0xC085u,
+        0x0A9Au, 0x5046u, 0xBF22u, 0xE5FEu, 0x69FBu, 0x3327u, 0xDC43u, 0x869Fu,
+        0xCC58u, 0x9684u, 0x79E0u, 0x233Cu, 0xAF39u, 0xF5E5u, 0x1A81u, 0x405Du,
+        0x8F0Fu, 0xD5D3u, 0x3AB7u, 0x606Bu, 0xEC6Eu, 0xB6B2u, 0x59D6u, 0x030Au,
+        0x49CDu, 0x1311u, 0xFC75u, 0xA6A9u, 0x2AACu, 0x7070u, 0x9F14u, 0xC5C8u,
+        0x09A1u, 0x537Du, 0xBC19u, 0xE6C5u, 0x6AC0u, 0x301Cu, 0xDF78u, 0x85A4u,
+        0xCF63u, 0x95BFu, 0x7ADBu, 0x2007u, 0xAC02u, 0xF6DEu, 0x19BAu, 0x4366u,
+        0x8C34u, 0xD6E8u, 0x398Cu, 0x6350u, 0xEF55u, 0xB589u, 0x5AEDu, 0x0031u,
+        0x4AF6u, 0x102Au, 0xFF4Eu, 0xA592u, 0x2997u, 0x734Bu, 0x9C2Fu, 0xC6F3u
+    },
+    {
+        0x0000u, 0x1CBBu, 0x3976u, 0x25CDu, 0x72ECu, 0x6E57u, 0x4B9Au, 0x5721u,
+        0xE5D8u, 0xF963u, 0xDCAEu, 0xC015u, 0x9734u, 0x8B8Fu, 0xAE42u, 0xB2F9u,
+        0xC3A1u, 0xDF1Au, 0xFAD7u, 0xE66Cu, 0xB14Du, 0xADF6u, 0x883Bu, 0x9480u,
+        0x2679u, 0x3AC2u, 0x1F0Fu, 0x03B4u, 0x5495u, 0x482Eu, 0x6DE3u, 0x7158u,
+        0x8F53u, 0x93E8u, 0xB625u, 0xAA9Eu, 0xFDBFu, 0xE104u, 0xC4C9u, 0xD872u,
+        0x6A8Bu, 0x7630u, 0x53FDu, 0x4F46u, 0x1867u, 0x04DCu, 0x2111u, 0x3DAAu,
+        0x4CF2u, 0x5049u, 0x7584u, 0x693Fu, 0x3E1Eu, 0x22A5u, 0x0768u, 0x1BD3u,
+        0xA92Au, 0xB591u, 0x905Cu, 0x8CE7u, 0xDBC6u, 0xC77Du, 0xE2B0u, 0xFE0Bu,
+        0x16B7u, 0x0A0Cu, 0x2FC1u, 0x337Au, 0x645Bu, 0x78E0u, 0x5D2Du, 0x4196u,
+        0xF36Fu, 0xEFD4u, 0xCA19u, 0xD6A2u, 0x8183u, 0x9D38u, 0xB8F5u, 0xA44Eu,
+        0xD516u, 0xC9ADu, 0xEC60u, 0xF0DBu, 0xA7FAu, 0xBB41u, 0x9E8Cu, 0x8237u,
+        0x30CEu, 0x2C75u, 0x09B8u, 0x1503u, 0x4222u, 0x5E99u, 0x7B54u, 0x67EFu,
+        0x99E4u, 0x855Fu, 0xA092u, 0xBC29u, 0xEB08u, 0xF7B3u, 0xD27Eu, 0xCEC5u,
+        0x7C3Cu, 0x6087u, 0x454Au, 0x59F1u, 0x0ED0u, 0x126Bu, 0x37A6u, 0x2B1Du,
+        0x5A45u, 0x46FEu, 0x6333u, 0x7F88u, 0x28A9u, 0x3412u, 0x11DFu, 0x0D64u,
+        0xBF9Du, 0xA326u, 0x86EBu, 0x9A50u, 0xCD71u, 0xD1CAu, 0xF407u, 0xE8BCu,
+        0x2D6Eu, 0x31D5u, 0x1418u, 0x08A3u, 0x5F82u, 0x4339u, 0x66F4u, 0x7A4Fu,
+        0xC8B6u, 0xD40Du, 0xF1C0u, 0xED7Bu, 0xBA5Au, 0xA6E1u, 0x832Cu, 0x9F97u,
+        0xEECFu, 0xF274u, 0xD7B9u, 0xCB02u, 0x9C23u, 0x8098u, 0xA555u, 0xB9EEu,
+        0x0B17u, 0x17ACu, 0x3261u, 0x2EDAu, 0x79FBu, 0x6540u, 0x408Du, 0x5C36u,
+        0xA23Du, 0xBE86u, 0x9B4Bu, 0x87F0u, 0xD0D1u, 0xCC6Au, 0xE9A7u, 0xF51Cu,
+        0x47E5u, 0x5B5Eu, 0x7E93u, 0x6228u, 0x3509u, 0x29B2u, 0x0C7Fu, 0x10C4u,
+        0x619Cu, 0x7D27u, 0x58EAu, 0x4451u, 0x1370u, 0x0FCBu, 0x2A06u, 0x36BDu,
+        0x8444u, 0x98FFu, 0xBD32u, 0xA189u, 0xF6A8u, 0xEA13u, 0xCFDEu, 0xD365u,
+        0x3BD9u, 0x2762u, 0x02AFu, 0x1E14u, 0x4935u, 0x558Eu, 0x7043u, 0x6CF8u,
+        0xDE01u, 0xC2BAu, 0xE777u, 0xFBCCu, 0xACEDu, 0xB056u, 0x959Bu, 0x8920u,
+        0xF878u, 0xE4C3u, 0xC10Eu, 0xDDB5u, 0x8A94u, 0x962Fu, 0xB3E2u, 0xAF59u,
+        0x1DA0u, 0x011Bu, 0x24D6u, 0x386Du, 0x6F4Cu, 0x73F7u, 0x563Au, 0x4A81u,
+        0xB48Au, 0xA831u, 0x8DFCu, 0x9147u, 0xC666u, 0xDADDu, 0xFF10u, 0xE3ABu,
+        0x5152u, 0x4DE9u, 0x6824u, 0x749Fu, 0x23BEu, 0x3F05u, 0x1AC8u, 0x0673u,
+        0x772Bu, 0x6B90u, 0x4E5Du, 0x52E6u, 0x05C7u, 0x197Cu, 0x3CB1u, 0x200Au,
+        0x92F3u, 0x8E48u, 0xAB85u, 0xB73Eu, 0xE01Fu, 0xFCA4u, 0xD969u, 0xC5D2u
+    }
+};
+
+static const uint32_t m_au32Crc32Table[4][256] =
+{
+    {
+        0x00000000ul, 0x77073096ul, 0xEE0E612Cul, 0x990951BAul, 0x076DC419ul, 0x706AF48Ful, 0xE963A535ul, 0x9E6495A3ul,
+        0x0EDB8832ul, 0x79DCB8A4ul, 0xE0D5E91Eul, 0x97D2D988ul, 0x09B64C2Bul, 0x7EB17CBDul, 0xE7B82D07ul, 0x90BF1D91ul,
+        0x1DB71064ul, 0x6AB020F2ul, 0xF3B97148ul, 0x84BE41DEul, 0x1ADAD47Dul, 0x6DDDE4EBul, 0xF4D4B551ul, 0x83D385C7ul,
+        0x136C9856ul, 0x646BA8C0ul, 0xFD62F97Aul, 0x8A65C9ECul, 0x14015C4Ful, 0x63066CD9ul, 0xFA0F3D63ul, 0x8D080DF5ul,
+        0x3B6E20C8ul, 0x4C69105Eul, 0xD56041E4ul, 0xA2677172ul, 0x3C03E4D1ul, 0x4B04D447ul, 0xD20D85FDul, 0xA50AB56Bul,
+        0x35B5A8FAul, 0x42B2986Cul, 0xDBBBC9D6ul, 0xACBCF940ul, 0x32D86CE3ul, 0x45DF5C75ul, 0xDCD60DCFul, 0xABD13D59ul,
+        0x26D930ACul, 0x51DE003Aul, 0xC8D75180ul, 0xBFD06116ul, 0x21B4F4B5ul, 0x56B3C423ul, 0xCFBA9599ul, 0xB8BDA50Ful,
+        0x2802B89Eul, 0x5F058808ul, 0xC60CD9B2ul, 0xB10BE924ul, 0x2F6F7C87ul, 0x58684C11ul, 0xC1611DABul, 0xB6662D3Dul,
+        0x76DC4190ul, 0x01DB7106ul, 0x98D220BCul, 0xEFD5102Aul, 0x71B18589ul, 0x06B6B51Ful, 0x9FBFE4A5ul, 0xE8B8D433ul,
+        0x7807C9A2ul, 0x0F00F934ul, 0x9609A88Eul, 0xE10E9818ul, 0x7F6A0DBBul, 0x086D3D2Dul, 0x91646C97ul, 0xE6635C01ul,
+        0x6B6B51F4ul, 0x1C6C6162ul, 0x856530D8ul, 0xF262004Eul, 0x6C0695EDul, 0x1B01A57Bul, 0x8208F4C1ul, 0xF50FC457ul,
+        0x65B0D9C6ul, 0x12B7E950ul, 0x8BBEB8EAul, 0xFCB9887Cul, 0x62DD1DDFul, 0x15DA2D49ul, 0x8CD37CF3ul, 0xFBD44C65ul,
+        0x4DB26158ul, 0x3AB551CEul, 0xA3BC0074ul, 0xD4BB30E2ul, 0x4ADFA541ul, 0x3DD895D7ul, 0xA4D1C46Dul, 0xD3D6F4FBul,
+        0x4369E96Aul, 0x346ED9FCul, 0xAD678846ul, 0xDA60B8D0ul, 0x44042D73ul, 0x33031DE5ul, 0xAA0A4C5Ful, 0xDD0D7CC9ul,
+        0x5005713Cul, 0x270241AAul, 0xBE0B1010ul, 0xC90C2086ul, 0x5768B525ul, 0x206F85B3ul, 0xB966D409ul, 0xCE61E49Ful,
+        0x5EDEF90Eul, 0x29D9C998ul, 0xB0D09822ul, 0xC7D7A8B4ul, 0x59B33D17ul, 0x2EB40D81ul, 0xB7BD5C3Bul, 0xC0BA6CADul,
+        0xEDB88320ul, 0x9ABFB3B6ul, 0x03B6E20Cul, 0x74B1D29Aul, 0xEAD54739ul, 0x9DD277AFul, 0x04DB2615ul, 0x73DC1683ul,
+        0xE3630B12ul, 0x94643B84ul, 0x0D6D6A3Eul, 0x7A6A5AA8ul, 0xE40ECF0Bul, 0x9309FF9Dul, 0x0A00AE27ul, 0x7D079EB1ul,
+        0xF00F9344ul, 0x8708A3D2ul, 0x1E01F268ul, 0x6906C2FEul, 0xF762575Dul, 0x806567CBul, 0x196C3671ul, 0x6E6B06E7ul,
+        0xFED41B76ul, 0x89D32BE0ul, 0x10DA7A5Aul, 0x67DD4ACCul, 0xF9B9DF6Ful, 0x8EBEEFF9ul, 0x17B7BE43ul, 0x60B08ED5ul,
+        0xD6D6A3E8ul, 0xA1D1937Eul, 0x38D8C2C4ul, 0x4FDFF252ul, 0xD1BB67F1ul, 0xA6BC5767ul, 0x3FB506DDul, 0x48B2364Bul,
+        0xD80D2BDAul, 0xAF0A1B4Cul, 0x36034AF6ul, 0x41047A60ul, 0xDF60EFC3ul, 0xA867DF55ul, 0x316E8EEFul, 0x4669BE79ul,
+        0xCB61B38Cul, 0xBC66831Aul, 0x256FD2A0ul, 0x5268E236ul, 0xCC0C7795ul, 0xBB0B4703ul, 0x220216B9ul, 0x5505262Ful,
+        0xC5BA3BBEul, 0xB2BD0B28ul, 0x2BB45A92ul, 0x5CB36A04ul, 0xC2D7FFA7ul, 0xB5D0CF31ul, 0x2CD99E8Bul, 0x5BDEAE1Dul,
+        0x9B64C2B0ul, 0xEC63F226ul, 0x756AA39Cul, 0x026D930Aul, 0x9C0906A9ul, 0xEB0E363Ful, 0x72076785ul, 0x05005713ul,
+        0x95BF4A82ul, 0xE2B87A14ul, 0x7BB12BAEul, 0x0CB61B38ul, 0x92D28E9Bul, 0xE5D5BE0Dul, 0x7CDCEFB7ul, 0x0BDBDF21ul,
+        0x86D3D2D4ul, 0xF1D4E242ul, 0x68DDB3F8ul, 0x1FDA836Eul, 0x81BE16CDul, 0xF6B9265Bul, 0x6FB077E1ul, 0x18B74777ul,
+        0x88085AE6ul, 0xFF0F6A70ul, 0x66063BCAul, 0x11010B5Cul, 0x8F659EFFul, 0xF862AE69ul, 0x616BFFD3ul, 0x166CCF45ul,
+        0xA00AE278ul, 0xD70DD2EEul, 0x4E048354ul, 0x3903B3C2ul, 0xA7672661ul, 0xD06016F7ul, 0x4969474Dul, 0x3E6E77DBul,
+        0xAED16A4Aul, 0xD9D65ADCul, 0x40DF0B66ul, 0x37D83BF0ul, 0xA9BCAE53ul, 0xDEBB9EC5ul, 0x47B2CF7Ful, 0x30B5FFE9ul,
+        0xBDBDF21Cul, 0xCABAC28Aul, 0x53B39330ul, 0x24B4A3A6ul, 0xBAD03605ul, 0xCDD70693ul, 0x54DE5729ul, 0x23D967BFul,
+        0xB3667A2Eul, 0xC4614AB8ul, 0x5D681B02ul, 0x2A6F2B94ul, 0xB40BBE37ul, 0xC30C8EA1ul, 0x5A05DF1Bul, 0x2D02EF8Dul
+    },
+    {
+        0x00000000ul, 0x191B3141ul, 0x32366282ul, 0x2B2D53C3ul, 0x646CC504ul, 0x7D77F445ul, 0x565AA786ul, 0x4F4196C7ul,
+        0xC8D98A08ul, 0xD1C2BB49ul, 0xFAEFE88Aul, 0xE3F4D9CBul, 0xACB54F0Cul, 0xB5AE7E4Dul, 0x9E832D8Eul, 0x87981CCFul,
+        0x4AC21251ul, 0x53D92310ul, 0x78F470D3ul, 0x61EF4192ul, 0x2EAED755ul, 0x37B5E614ul, 0x1C98B5D7ul, 0x05838496ul,
+        0x821B9859ul, 0x9B00A918ul, 0xB02DFADBul, 0xA936CB9Aul, 0xE6775D5Dul, 0xFF6C6C1Cul, 0xD4413FDFul, 0xCD5A0E9Eul,
+        0x958424A2ul, 0x8C9F15E3ul, 0xA7B24620ul, 0xBEA97761ul, 0xF1E8E1A6ul, 0xE8F3D0E7ul, 0xC3DE8324ul, 0xDAC5B265ul,
+        0x5D5DAEAAul, 0x44469FEBul, 0x6F6BCC28ul, 0x7670FD69ul, 0x39316BAEul, 0x202A5AEFul, 0x0B07092Cul, 0x121C386Dul,
+        0xDF4636F3ul, 0xC65D07B2ul, 0xED705471ul, 0xF46B6530ul, 0xBB2AF3F7ul, 0xA231C2B6ul, 0x891C9175ul, 0x9007A034ul,
+        0x179FBCFBul, 0x0E848DBAul, 0x25A9DE79ul, 0x3CB2EF38ul, 0x73F379FFul, 0x6AE848BEul, 0x41C51B7Dul, 0x58DE2A3Cul,
+        0xF0794F05ul, 0xE9627E44ul, 0xC24F2D87ul, 0xDB541CC6ul, 0x94158A01ul, 0x8D0EBB40ul, 0xA623E883ul, 0xBF38D9C2ul,
+        0x38A0C50Dul, 0x21BBF44Cul, 0x0A96A78Ful, 0x138D96CEul, 0x5CCC0009ul, 0x45D73148ul, 0x6EFA628Bul, 0x77E153CAul,
+        0xBABB5D54ul, 0xA3A06C15ul, 0x888D3FD6ul, 0x91960E97ul, 0xDED79850ul, 0xC7CCA911ul, 0xECE1FAD2ul, 0xF5FACB93ul,
+        0x7262D75Cul, 0x6B79E61Dul, 0x4054B5DEul, 0x594F849Ful, 0x160E1258ul, 0x0F152319ul, 0x243870DAul, 0x3D23419Bul,
+        0x65FD6BA7ul, 0x7CE65AE6ul, 0x57CB0925ul, 0x4ED03864ul, 0x0191AEA3ul, 0x188A9FE2ul, 0x33A7CC21ul, 0x2ABCFD60ul,
+        0xAD24E1AFul, 0xB43FD0EEul, 0x9F12832Dul, 0x8609B26Cul, 0xC94824ABul, 0xD05315EAul, 0xFB7E4629ul, 0xE2657768ul,
+        0x2F3F79F6ul, 0x362448B7ul, 0x1D091B74ul, 0x04122A35ul, 0x4B53BCF2ul, 0x52488DB3ul, 0x7965DE70ul, 0x607EEF31ul,
+        0xE7E6F3FEul, 0xFEFDC2BFul, 0xD5D0917Cul, 0xCCCBA03Dul, 0x838A36FAul, 0x9A9107BBul, 0xB1BC5478ul, 0xA8A76539ul,
+        0x3B83984Bul, 0x2298A90Aul, 0x09B5FAC9ul, 0x10AECB88ul, 0x5FEF5D4Ful, 0x46F46C0Eul, 0x6DD93FCDul, 0x74C20E8Cul,
+        0xF35A1243ul, 0xEA412302ul, 0xC16C70C1ul, 0xD8774180ul, 0x9736D747ul, 0x8E2DE606ul, 0xA500B5C5ul, 0xBC1B8484ul,
+        0x71418A1Aul, 0x685ABB5Bul, 0x4377E898ul, 0x5A6CD9D9ul, 0x152D4F1Eul, 0x0C367E5Ful, 0x271B2D9Cul, 0x3E001CDDul,
+        0xB9980012ul, 0xA0833153ul, 0x8BAE6290ul, 0x92B553D1ul, 0xDDF4C516ul, 0xC4EFF457ul, 0xEFC2A794ul, 0xF6D996D5ul,
+        0xAE07BCE9ul, 0xB71C8DA8ul, 0x9C31DE6Bul, 0x852AEF2Aul, 0xCA6B79EDul, 0xD37048ACul, 0xF85D1B6Ful, 0xE1462A2Eul,
+        0x66DE36E1ul, 0x7FC507A0ul, 0x54E85463ul, 0x4DF36522ul, 0x02B2F3E5ul, 0x1BA9C2A4ul, 0x30849167ul, 0x299FA026ul,
+        0xE4C5AEB8ul, 0xFDDE9FF9ul, 0xD6F3CC3Aul, 0xCFE8FD7Bul, 0x80A96BBCul, 0x99B25AFDul, 0xB29F093Eul, 0xAB84387Ful,
+        0x2C1C24B0ul, 0x350715F1ul, 0x1E2A4632ul, 0x07317773ul, 0x4870E1B4ul, 0x516BD0F5ul, 0x7A468336ul, 0x635DB277ul,
+        0xCBFAD74Eul, 0xD2E1E60Ful, 0xF9CCB5CCul, 0xE0D7848Dul, 0xAF96124Aul, 0xB68D230Bul, 0x9DA070C8ul, 0x84BB4189ul,
+        0x03235D46ul, 0x1A386C07ul, 0x31153FC4ul, 0x280E0E85ul, 0x674F9842ul, 0x7E54A903ul, 0x5579FAC0ul, 0x4C62CB81ul,
+        0x8138C51Ful, 0x9823F45Eul, 0xB30EA79Dul, 0xAA1596DCul, 0xE554001Bul, 0xFC4F315Aul, 0xD7626299ul, 0xCE7953D8ul,
+        0x49E14F17ul, 0x50FA7E56ul, 0x7BD72D95ul, 0x62CC1CD4ul, 0x2D8D8A13ul, 0x3496BB52ul, 0x1FBBE891ul, 0x06A0D9D0ul,
+        0x5E7EF3ECul, 0x4765C2ADul, 0x6C48916Eul, 0x7553A02Ful, 0x3A1236E8ul, 0x230907A9ul, 0x0824546Aul, 0x113F652Bul,
+        0x96A779E4ul, 0x8FBC48A5ul, 0xA4911B66ul, 0xBD8A2A27ul, 0xF2CBBCE0ul, 0xEBD08DA1ul, 0xC0FDDE62ul, 0xD9E6EF23ul,
+        0x14BCE1BDul, 0x0DA7D0FCul, 0x268A833Ful, 0x3F91B27Eul, 0x70D024B9ul, 0x69CB15F8ul, 0x42E6463Bul, 0x5BFD777Aul,
+        0xDC656BB5ul, 0xC57E5AF4ul, 0xEE530937ul, 0xF7483876ul, 0xB809AEB1ul, 0xA1129FF0ul, 0x8A3FCC33ul, 0x9324FD72ul
+    },
+    {
+        0x00000000ul, 0x01C26A37ul, 0x0384D46Eul, 0x0246BE59ul, 0x0709A8DCul, 0x06CBC2EBul, 0x048D7CB2ul, 0x054F1685ul,
+        0x0E1351B8ul, 0x0FD13B8Ful, 0x0D9785D6ul, 0x0C55EFE1ul, 0x091AF964ul, 0x08D89353ul, 0x0A9E2D0Aul, 0x0B5C473Dul,
+        0x1C26A370ul, 0x1DE4C947ul, 0x1FA2771Eul, 0x1E601D29ul, 0x1B2F0BACul, 0x1AED619Bul, 0x18ABDFC2ul, 0x1969B5F5ul,
+        0x1235F2C8ul, 0x13F798FFul, 0x11B126A6ul, 0x10734C91ul, 0x153C5A14ul, 0x14FE3023ul, 0x16B88E7Aul, 0x177AE44Dul,
+        0x384D46E0ul, 0x398F2CD7ul, 0x3BC9928Eul, 0x3A0BF8B9ul, 0x3F44EE3Cul, 0x3E86840Bul, 0x3CC03A52ul, 0x3D025065ul,
+        0x365E1758ul, 0x379C7D6Ful, 0x35DAC336ul, 0x3418A901ul, 0x3157BF84ul, 0x3095D5B3ul, 0x32D36BEAul, 0x331101DDul,
+        0x246BE590ul, 0x25A98FA7ul, 0x27EF31FEul, 0x262D5BC9ul, 0x23624D4Cul, 0x22A0277Bul, 0x20E69922ul, 0x2124F315ul,
+        0x2A78B428ul, 0x2BBADE1Ful, 0x29FC6046ul, 0x283E0A71ul, 0x2D711CF4ul, 0x2CB376C3ul, 0x2EF5C89Aul, 0x2F37A2ADul,
+        0x709A8DC0ul, 0x7158E7F7ul, 0x731E59AEul, 0x72DC3399ul, 0x7793251Cul, 0x76514F2Bul, 0x7417F172ul, 0x75D59B45ul,
+        0x7E89DC78ul, 0x7F4BB64Ful, 0x7D0D0816ul, 0x7CCF6221ul, 0x798074A4ul, 0x78421E93ul, 0x7A04A0CAul, 0x7BC6CAFDul,
+        0x6CBC2EB0ul, 0x6D7E4487ul, 0x6F38FADEul, 0x6EFA90E9ul, 0x6BB5866Cul, 0x6A77EC5Bul, 0x68315202ul, 0x69F33835ul,
+        0x62AF7F08ul, 0x636D153Ful, 0x612BAB66ul, 0x60E9C151ul, 0x65A6D7D4ul, 0x6464BDE3ul, 0x662203BAul, 0x67E0698Dul,
+        0x48D7CB20ul, 0x4915A117ul, 0x4B531F4Eul, 0x4A917579ul, 0x4FDE63FCul, 0x4E1C09CBul, 0x4C5AB792ul, 0x4D98DDA5ul,
+        0x46C49A98ul, 0x4706F0AFul, 0x45404EF6ul, 0x448224C1ul, 0x41CD3244ul, 0x400F5873ul, 0x4249E62Aul, 0x438B8C1Dul,
+        0x54F16850ul, 0x55330267ul, 0x5775BC3Eul, 0x56B7D609ul, 0x53F8C08Cul, 0x523AAABBul, 0x507C14E2ul, 0x51BE7ED5ul,
+        0x5AE239E8ul, 0x5B2053DFul, 0x5966ED86ul, 0x58A487B1ul, 0x5DEB9134ul, 0x5C29FB03ul, 0x5E6F455Aul, 0x5FAD2F6Dul,
+        0xE1351B80ul, 0xE0F771B7ul, 0xE2B1CFEEul, 0xE373A5D9ul, 0xE63CB35Cul, 0xE7FED96Bul, 0xE5B86732ul, 0xE47A0D05ul,
+        0xEF264A38ul, 0xEEE4200Ful, 0xECA29E56ul, 0xED60F461ul, 0xE82FE2E4ul, 0xE9ED88D3ul, 0xEBAB368Aul, 0xEA695CBDul,
+        0xFD13B8F0ul, 0xFCD1D2C7ul, 0xFE976C9Eul, 0xFF5506A9ul, 0xFA1A102Cul, 0xFBD87A1Bul, 0xF99EC442ul, 0xF85CAE75ul,
+        0xF300E948ul, 0xF2C2837Ful, 0xF0843D26ul, 0xF1465711ul, 0xF4094194ul, 0xF5CB2BA3ul, 0xF78D95FAul, 0xF64FFFCDul,
+        0xD9785D60ul, 0xD8BA3757ul, 0xDAFC890Eul, 0xDB3EE339ul, 0xDE71F5BCul, 0xDFB39F8Bul, 0xDDF521D2ul, 0xDC374BE5ul,
+        0xD76B0CD8ul, 0xD6A966EFul, 0xD4EFD8B6ul, 0xD52DB281ul, 0xD062A404ul, 0xD1A0CE33ul, 0xD3E6706Aul, 0xD2241A5Dul,
+        0xC55EFE10ul, 0xC49C9427ul, 0xC6DA2A7Eul, 0xC7184049ul, 0xC25756CCul, 0xC3953CFBul, 0xC1D382A2ul, 0xC011E895ul,
+        0xCB4DAFA8ul, 0xCA8FC59Ful, 0xC8C97BC6ul, 0xC90B11F1ul, 0xCC440774ul, 0xCD866D43ul, 0xCFC0D31Aul, 0xCE02B92Dul,
+        0x91AF9640ul, 0x906DFC77ul, 0x922B422Eul, 0x93E92819ul, 0x96A63E9Cul, 0x976454ABul, 0x9522EAF2ul, 0x94E080C5ul,
+        0x9FBCC7F8ul, 0x9E7EADCFul, 0x9C381396ul, 0x9DFA79A1ul, 0x98B56F24ul, 0x99770513ul, 0x9B31BB4Aul, 0x9AF3D17Dul,
+        0x8D893530ul, 0x8C4B5F07ul, 0x8E0DE15Eul, 0x8FCF8B69ul, 0x8A809DECul, 0x8B42F7DBul, 0x89044982ul, 0x88C623B5ul,
+        0x839A6488ul, 0x82580EBFul, 0x801EB0E6ul, 0x81DCDAD1ul, 0x8493CC54ul, 0x8551A663ul, 0x8717183Aul, 0x86D5720Dul,
+        0xA9E2D0A0ul, 0xA820BA97ul, 0xAA6604CEul, 0xABA46EF9ul, 0xAEEB787Cul, 0xAF29124Bul, 0xAD6FAC12ul, 0xACADC625ul,
+        0xA7F18118ul, 0xA633EB2Ful, 0xA4755576ul, 0xA5B73F41ul, 0xA0F829C4ul, 0xA13A43F3ul, 0xA37CFDAAul, 0xA2BE979Dul,
+        0xB5C473D0ul, 0xB40619E7ul, 0xB640A7BEul, 0xB782CD89ul, 0xB2CDDB0Cul, 0xB30FB13Bul, 0xB1490F62ul, 0xB08B6555ul,
+        0xBBD72268ul, 0xBA15485Ful, 0xB853F606ul, 0xB9919C31ul, 0xBCDE8AB4ul, 0xBD1CE083ul, 0xBF5A5EDAul, 0xBE9834EDul
+    },
+    {
+        0x00000000ul, 0xB8BC6765ul, 0xAA09C88Bul, 0x12B5AFEEul, 0x8F629757ul, 0x37DEF032ul, 0x256B5FDCul, 0x9DD738B9ul,
+        0xC5B428EFul, 0x7D084F8Aul, 0x6FBDE064ul, 0xD7018701ul, 0x4AD6BFB8ul, 0xF26AD8DDul, 0xE0DF7733ul, 0x58631056ul,
+        0x5019579Ful, 0xE8A530FAul, 0xFA109F14ul, 0x42ACF871ul, 0xDF7BC0C8ul, 0x67C7A7ADul, 0x75720843ul, 0xCDCE6F26ul,
+        0x95AD7F70ul, 0x2D111815ul, 0x3FA4B7FBul, 0x8718D09Eul, 0x1ACFE827ul, 0xA2738F42ul, 0xB0C620ACul, 0x087A47C9ul,
+        0xA032AF3Eul, 0x188EC85Bul, 0x0A3B67B5ul, 0xB28700D0ul, 0x2F503869ul, 0x97EC5F0Cul, 0x8559F0E2ul, 0x3DE59787ul,
+        0x658687D1ul, 0xDD3AE0B4ul, 0xCF8F4F5Aul, 0x7733283Ful, 0xEAE41086ul, 0x525877E3ul, 0x40EDD80Dul, 0xF851BF68ul,
+        0xF02BF8A1ul, 0x48979FC4ul, 0x5A22302Aul, 0xE29E574Ful, 0x7F496FF6ul, 0xC7F50893ul, 0xD540A77Dul, 0x6DFCC018ul,
+        0x359FD04Eul, 0x8D23B72Bul, 0x9F9618C5ul, 0x272A7FA0ul, 0xBAFD4719ul, 0x0241207Cul, 0x10F48F92ul, 0xA848E8F7ul,
+        0x9B14583Dul, 0x23A83F58ul, 0x311D90B6ul, 0x89A1F7D3ul, 0x1476CF6Aul, 0xACCAA80Ful, 0xBE7F07E1ul, 0x06C36084ul,
+        0x5EA070D2ul, 0xE61C17B7ul, 0xF4A9B859ul, 0x4C15DF3Cul, 0xD1C2E785ul, 0x697E80E0ul, 0x7BCB2F0Eul, 0xC377486Bul,
+        0xCB0D0FA2ul, 0x73B168C7ul, 0x6104C729ul, 0xD9B8A04Cul, 0x446F98F5ul, 0xFCD3FF90ul, 0xEE66507Eul, 0x56DA371Bul,
+        0x0EB9274Dul, 0xB6054028ul, 0xA4B0EFC6ul, 0x1C0C88A3ul, 0x81DBB01Aul, 0x3967D77Ful, 0x2BD27891ul, 0x936E1FF4ul,
+        0x3B26F703ul, 0x839A9066ul, 0x912F3F88ul, 0x299358EDul, 0xB4446054ul, 0x0CF80731ul, 0x1E4DA8DFul, 0xA6F1CFBAul,
+        0xFE92DFECul, 0x462EB889ul, 0x549B1767ul, 0xEC277002ul, 0x71F048BBul, 0xC94C2FDEul, 0xDBF98030ul, 0x6345E755ul,
+        0x6B3FA09Cul, 0xD383C7F9ul, 0xC1366817ul, 0x798A0F72ul, 0xE45D37CBul, 0x5CE150AEul, 0x4E54FF40ul, 0xF6E89825ul,
+        0xAE8B8873ul, 0x1637EF16ul, 0x048240F8ul, 0xBC3E279Dul, 0x21E91F24ul, 0x99557841ul, 0x8BE0D7AFul, 0x335CB0CAul,
+        0xED59B63Bul, 0x55E5D15Eul, 0x47507EB0ul, 0xFFEC19D5ul, 0x623B216Cul, 0xDA874609ul, 0xC832E9E7ul, 0x708E8E82ul,
+        0x28ED9ED4ul, 0x9051F9B1ul, 0x82E4565Ful, 0x3A58313Aul, 0xA78F0983ul, 0x1F336EE6ul, 0x0D86C108ul, 0xB53AA66Dul,
+        0xBD40E1A4ul, 0x05FC86C1ul, 0x1749292Ful, 0xAFF54E4Aul, 0x322276F3ul, 0x8A9E1196ul, 0x982BBE78ul, 0x2097D91Dul,
+        0x78F4C94Bul, 0xC048AE2Eul, 0xD2FD01C0ul, 0x6A4166A5ul, 0xF7965E1Cul, 0x4F2A3979ul, 0x5D9F9697ul, 0xE523F1F2ul,
+        0x4D6B1905ul, 0xF5D77E60ul, 0xE762D18Eul, 0x5FDEB6EBul, 0xC2098E52ul, 0x7AB5E937ul, 0x680046D9ul, 0xD0BC21BCul,
+        0x88DF31EAul, 0x3063568Ful, 0x22D6F961ul, 0x9A6A9E04ul, 0x07BDA6BDul, 0xBF01C1D8ul, 0xADB46E36ul, 0x15080953ul,
+        0x1D724E9Aul, 0xA5CE29FFul, 0xB77B8611ul, 0x0FC7E174ul, 0x9210D9CDul, 0x2AACBEA8ul, 0x38191146ul, 0x80A57623ul,
+        0xD8C66675ul, 0x607A0110ul, 0x72CFAEFEul, 0xCA73C99Bul, 0x57A4F122ul, 0xEF189647ul, 0xFDAD39A9ul, 0x45115ECCul,
+        0x764DEE06ul, 0xCEF18963ul, 0xDC44268Dul, 0x64F841E8ul, 0xF92F7951ul, 0x41931E34ul, 0x5326B1DAul, 0xEB9AD6BFul,
+        0xB3F9C6E9ul, 0x0B45A18Cul, 0x19F00E62ul, 0xA14C6907ul, 0x3C9B51BEul, 0x842736DBul, 0x96929935ul, 0x2E2EFE50ul,
+        0x2654B999ul, 0x9EE8DEFCul, 0x8C5D7112ul, 0x34E11677ul, 0xA9362ECEul, 0x118A49ABul, 0x033FE645ul, 0xBB838120ul,
+        0xE3E09176ul, 0x5B5CF613ul, 0x49E959FDul, 0xF1553E98ul, 0x6C820621ul, 0xD43E6144ul, 0xC68BCEAAul, 0x7E37A9CFul,
+        0xD67F4138ul, 0x6EC3265Dul, 0x7C7689B3ul, 0xC4CAEED6ul, 0x591DD66Ful, 0xE1A1B10Aul, 0xF3141EE4ul, 0x4BA87981ul,
+        0x13CB69D7ul, 0xAB770EB2ul, 0xB9C2A15Cul, 0x017EC639ul, 0x9CA9FE80ul, 0x241599E5ul, 0x36A0360Bul, 0x8E1C516Eul,
+        0x866616A7ul, 0x3EDA71C2ul, 0x2C6FDE2Cul, 0x94D3B949ul, 0x090481F0ul, 0xB1B8E695ul, 0xA30D497Bul, 0x1BB12E1Eul,
+        0x43D23E48ul, 0xFB6E592Dul, 0xE9DBF6C3ul, 0x516791A6ul, 0xCCB0A91Ful, 0x740CCE7Aul, 0x66B96194ul, 0xDE0506F1ul
+    }
+};
+#endif
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup CRC_SW_Global_Functions CRC_SW Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Software CRC calculation, the checksum is the same as CRC_Calculate().
+ * @note   Half words and words are fed from the least significant byte, as the CRC
+ *         unit does, so the result does not depend on the byte order of the host.
+ * @param  [in]   u32CrcProtocol        CRC protocol control bit.
+ *   @arg  CRC_CRC16:                   CRC16(X.25, reflected polynomial 0x8408).
+ *   @arg  CRC_CRC32:                   CRC32(IEEE 802.3, reflected polynomial 0xEDB88320).
+ * @param  [in]   pvData                Pointer to the buffer containing the data to be computed.
+ * @param  [in]   u32InitVal            Initialize the CRC calculation.
+ * @param  [in]   u32Length             The length(countted in bytes or half word or word, depending on
+ *                                      the bit width) of the data to be computed.
+ * @param  [in]   u8BitWidth            Bit width of the data.
+ *   @arg  CRC_BW_8:                    The pointer pvData points to a byte array.
+ *   @arg  CRC_BW_16:                   The pointer pvData points to a half word array.
+ *   @arg  CRC_BW_32:                   The pointer pvData points to a word array.
+ * @retval CRC checksum, 0 if any parameter is invalid.
+ */
+uint32_t CRC_SW_Calculate(uint32_t u32CrcProtocol,
+                          const void *pvData,
+                          uint32_t u32InitVal,
+                          uint32_t u32Length,
+                          uint8_t u8BitWidth)
+{
+    uint32_t u32CheckSum = 0ul;
+
+    if ((pvData != NULL) && (u32Length != 0ul) && IS_CRC_SW_BIT_WIDTH(u8BitWidth))
+    {
+        u32CheckSum = CRC_SW_Process(u32CrcProtocol, u32InitVal, pvData, u32Length, u8BitWidth);
+    }
+
+    return u32CheckSum;
+}
+
+/**
+ * @brief  Software CRC check, the result is the same as CRC_Check().
+ * @param  [in]  u32CrcProtocol     CRC protocol control bit.
+ *   @arg  CRC_CRC16:               CRC16(X.25, reflected polynomial 0x8408).
+ *   @arg  CRC_CRC32:               CRC32(IEEE 802.3, reflected polynomial 0xEDB88320).
+ * @param  [in]  u32CheckSum        The checksum of the data pointed by pointer pvData.
+ * @param  [in]  pvData             Pointer to the buffer containing the data to be checked.
+ * @param  [in]  u32InitVal         Initialize the CRC calculation.
+ * @param  [in]  u32Length          The length(countted in bytes or half word or word, depending on
+ *                                  the bit width) of the data to be computed.
+ * @param  [in]  u8BitWidth         Bit width of the data.
+ *   @arg  CRC_BW_8:                The pointer pvData points to a byte array.
+ *   @arg  CRC_BW_16:               The pointer pvData points to a half word array.
+ *   @arg  CRC_BW_32:               The pointer pvData points to a word array.
+ * @retval A en_flag_status_t value.
+ *   @arg  Set:                     CRC checks successfully.
+ *   @arg  Reset:                   CRC checks unsuccessfully.
+ */
+en_flag_status_t CRC_SW_Check(uint32_t u32CrcProtocol,
+                              uint32_t u32CheckSum,
+                              const void *pvData,
+                              uint32_t u32InitVal,
+                              uint32_t u32Length,
+                              uint8_t u8BitWidth)
+{
+    uint32_t u32Crc;
+    en_flag_status_t enFlag = Reset;
+
+    if ((pvData != NULL) && (u32Length != 0ul) && IS_CRC_SW_BIT_WIDTH(u8BitWidth))
+    {
+        /* Feeding the checksum after the data leaves the fixed residue in the CRC unit
+           only if the checksum matches, comparing the checksums is equivalent. */
+        u32Crc = CRC_SW_Process(u32CrcProtocol, u32InitVal, pvData, u32Length, u8BitWidth);
+        if (u32CrcProtocol != CRC_CRC32)
+        {
+            u32CheckSum &= 0xFFFFul;
+        }
+
+        if (u32Crc == u32CheckSum)
+        {
+            enFlag = Set;
+        }
+    }
+
+    return enFlag;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup CRC_SW_Local_Functions CRC_SW Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Run the CRC over the buffer.
+ * @param  [in]  u32CrcProtocol     CRC protocol control bit.
+ * @param  [in]  u32Crc             Initial value of the CRC register.
+ * @param  [in]  pvData             Pointer to the buffer containing the data.
+ * @param  [in]  u32Length          The length of the data in unit of the bit width.
+ * @param  [in]  u8BitWidth         Bit width of the data.
+ * @retval CRC checksum(the inverted CRC register).
+ */
+static uint32_t CRC_SW_Process(uint32_t u32CrcProtocol,
+                               uint32_t u32Crc,
+                               const void *pvData,
+                               uint32_t u32Length,
+                               uint8_t u8BitWidth)
+{
+    uint32_t u32Data;
+    const uint8_t *pu8Data;
+    const uint16_t *pu16Data;
+    const uint32_t *pu32Data;
+
+    if (u32CrcProtocol != CRC_CRC32)
+    {
+        u32Crc &= 0xFFFFul;
+    }
+
+    if (u8BitWidth == CRC_BW_8)
+    {
+        pu8Data = (const uint8_t *)pvData;
+        /* Bytes are gathered to words in memory order, no alignment is required. */
+        while (u32Length >= 4ul)
+        {
+            u32Data = (uint32_t)pu8Data[0u]         |
+                      ((uint32_t)pu8Data[1u] << 8u)  |
+                      ((uint32_t)pu8Data[2u] << 16u) |
+                      ((uint32_t)pu8Data[3u] << 24u);
+            u32Crc = CRC_SW_Unit(u32CrcProtocol, u32Crc, u32Data, 4ul);
+            pu8Data   += 4u;
+            u32Length -= 4ul;
+        }
+        while (u32Length != 0ul)
+        {
+            u32Crc = CRC_SW_Unit(u32CrcProtocol, u32Crc, (uint32_t)*pu8Data, 1ul);
+            pu8Data++;
+            u32Length--;
+        }
+    }
+    else if (u8BitWidth == CRC_BW_16)
+    {
+        pu16Data = (const uint16_t *)pvData;
+        while (u32Length != 0ul)
+        {
+            u32Crc = CRC_SW_Unit(u32CrcProtocol, u32Crc, (uint32_t)*pu16Data, 2ul);
+            pu16Data++;
+            u32Length--;
+        }
+    }
+    else
+    {
+        pu32Data = (const uint32_t *)pvData;
+        while (u32Length != 0ul)
+        {
+            u32Crc = CRC_SW_Unit(u32CrcProtocol, u32Crc, *pu32Data, 4ul);
+            pu32Data++;
+            u32Length--;
+        }
+    }
+
+    u32Crc = ~u32Crc;
+    if (u32CrcProtocol != CRC_CRC32)
+    {
+        u32Crc &= 0xFFFFul;
+    }
+
+    return u32Crc;
+}
+
+/**
+ * @brief  Feed one unit to the CRC register, starting from the least significant byte.
+ * @param  [in]  u32CrcProtocol     CRC protocol control bit.
+ * @param  [in]  u32Crc             Current CRC register.
+ * @param  [in]  u32Data            The unit.
+ * @param  [in]  u32Bytes           Size of the unit in bytes, 1, 2 or 4.
+ * @retval The new CRC register.
+ */
+static uint32_t CRC_SW_Unit(uint32_t u32CrcProtocol,
+                            uint32_t u32Crc,
+                            uint32_t u32Data,
+                            uint32_t u32Bytes)
+{
+#if (CRC_SW_TABLE_TYPE == CRC_SW_TABLE_SLICE4)
+    if (u32Bytes == 4ul)
+    {
+        u32Crc ^= u32Data;
+        if (u32CrcProtocol == CRC_CRC32)
+        {
+            CRC_SW_WORD_STEP(u32Crc, m_au32Crc32Table);
+        }
+        else
+        {
+            CRC_SW_WORD_STEP(u32Crc, m_au16Crc16Table);
+        }
+        u32Bytes = 0ul;
+    }
+#endif
+
+    while (u32Bytes != 0ul)
+    {
+        u32Crc ^= (u32Data & 0xFFul);
+        if (u32CrcProtocol == CRC_CRC32)
+        {
+            CRC_SW_BYTE_STEP(u32Crc, CRC32_SW_TABLE);
+        }
+        else
+        {
+            CRC_SW_BYTE_STEP(u32Crc, CRC16_SW_TABLE);
+        }
+        u32Data >>= 8u;
+        u32Bytes--;
+    }
+
+    return u32Crc;
+}
+
+/**
+ * @}
+ */
+
+#endif /* CRC_SW_HOST || MW_CRC_SW_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
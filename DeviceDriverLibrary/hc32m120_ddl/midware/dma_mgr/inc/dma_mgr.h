@@ -0,0 +1,247 @@
+/**
+ *******************************************************************************
+ * @file  dma_mgr.h
+ * @brief This file contains all the functions prototypes of the DMA channel
+ *        manager midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __DMA_MGR_H__
+#define __DMA_MGR_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_DMA_MGR
+ * @{
+ */
+
+#if (MW_DMA_MGR_ENABLE == DDL_ON)
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_DMA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_DMA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DMA_MGR_Global_Types DMA_MGR Global Types
+ * @{
+ */
+
+/**
+ * @brief Transfer complete callback, called in the DMA transfer complete interrupt.
+ */
+typedef void (*func_ptr_dma_mgr_cpl_cb_t)(uint8_t u8Ch, void *pvArg);
+
+/**
+ * @brief Error callback, called in the DMA error interrupt.
+ * @note  u32Flag is DMA_FLAG_REQERR and/or DMA_FLAG_TRERR.
+ */
+typedef void (*func_ptr_dma_mgr_err_cb_t)(uint8_t u8Ch, uint32_t u32Flag, void *pvArg);
+
+/**
+ * @brief Time source of the busy time, e.g. the counter of a free running timer.
+ */
+typedef uint32_t (*func_ptr_dma_mgr_time_t)(void);
+
+/**
+ * @brief DMA manager configuration structure definition
+ */
+typedef struct
+{
+    uint8_t  u8ChMask;                  /*!< Channels managed, the others stay with their drivers.
+                                             This parameter can be values of @ref DMA_MGR_Channel_Mask */
+    IRQn_Type enTc0IRQn;                /*!< IRQ number of INT_DAM_1_TC0, Int008_IRQn or Int009_IRQn. */
+    IRQn_Type enTc1IRQn;                /*!< IRQ number of INT_DAM_2_TC0, Int010_IRQn or Int011_IRQn. */
+    IRQn_Type enErrIRQn;                /*!< IRQ number of INT_DMA_ERR, Int012_IRQn or Int013_IRQn. */
+    func_ptr_dma_mgr_time_t pfnGetTime; /*!< Time source of the busy time, can be NULL. */
+} stc_dma_mgr_cfg_t;
+
+/**
+ * @brief DMA transfer request structure definition
+ * @note  The request and the descriptors are read when the request starts and must
+ *        be kept until it completes. The transfer completes at the transfer complete
+ *        interrupt after which the hardware has disabled the channel, i.e. the end
+ *        of the descriptor chain.
+ */
+typedef struct stc_dma_mgr_req
+{
+    uint8_t  u8Prio;                    /*!< Priority, 0 is the highest.
+                                             This parameter can be a value of @ref DMA_MGR_Priority */
+    stc_dma_ch_cfg_t stcChCfg;          /*!< First transfer. */
+    en_event_src_t enTrigSrc;           /*!< Event which requests the transfers. */
+    const stc_dma_llp_descriptor_t *pstcLlp;    /*!< Descriptor loaded after the first transfer, NULL: none. */
+    uint32_t u32LlpRun;                 /*!< Start of the descriptor, DMA_LLP_RUN or DMA_LLP_WAIT. */
+    func_ptr_dma_mgr_cpl_cb_t pfnCplCb; /*!< Transfer complete callback, can be NULL. */
+    func_ptr_dma_mgr_err_cb_t pfnErrCb; /*!< Error callback, can be NULL. */
+    void *pvArg;                        /*!< Argument of the callbacks. */
+
+    /* Internal state, set by DMA_MGR_Submit() */
+    struct stc_dma_mgr_req *pstcNext;   /*!< Next pending request in order of priority. */
+    __IO uint8_t u8State;               /*!< Idle, pending or running. */
+} stc_dma_mgr_req_t;
+
+/**
+ * @brief DMA channel statistics structure definition
+ */
+typedef struct
+{
+    uint32_t u32BusyTime;               /*!< Time owned or running a request, in unit of the time source. */
+    uint32_t u32ReqCnt;                 /*!< Requests completed. */
+    uint32_t u32ErrCnt;                 /*!< Errors while the channel is acquired or runs a request. */
+} stc_dma_mgr_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DMA_MGR_Global_Macros DMA_MGR Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup DMA_MGR_Channel_Mask DMA_MGR Channel Mask
+ * @{
+ */
+#define DMA_MGR_CH0                     ((uint8_t)0x01u)    /*!< DMA channel 0. */
+#define DMA_MGR_CH1                     ((uint8_t)0x02u)    /*!< DMA channel 1. */
+#define DMA_MGR_CH_ALL                  ((uint8_t)0x03u)    /*!< DMA channel 0 and 1. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DMA_MGR_Priority DMA_MGR Priority
+ * @brief    Pending requests start in order of priority, first come first served at
+ *           the same priority. A priority value below DMA_MGR_PRIO_NORMAL takes
+ *           channel 0 when both are free, which wins the bus arbitration, the
+ *           others take channel 1.
+ * @{
+ */
+#define DMA_MGR_PRIO_HIGH               ((uint8_t)0u)       /*!< Highest priority. */
+#define DMA_MGR_PRIO_NORMAL             ((uint8_t)128u)     /*!< Normal priority. */
+#define DMA_MGR_PRIO_LOW                ((uint8_t)255u)     /*!< Lowest priority. */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DMA_MGR_Global_Functions
+ * @{
+ */
+en_result_t DMA_MGR_Init(const stc_dma_mgr_cfg_t *pstcCfg);
+en_result_t DMA_MGR_Acquire(uint8_t u8Prio, uint8_t *pu8Ch);
+en_result_t DMA_MGR_Release(uint8_t u8Ch);
+en_result_t DMA_MGR_SetCallback(uint8_t u8Ch, func_ptr_dma_mgr_cpl_cb_t pfnCplCb,
+                                func_ptr_dma_mgr_err_cb_t pfnErrCb, void *pvArg);
+en_result_t DMA_MGR_Submit(stc_dma_mgr_req_t *pstcReq);
+en_result_t DMA_MGR_Cancel(stc_dma_mgr_req_t *pstcReq);
+en_flag_status_t DMA_MGR_IsBusy(const stc_dma_mgr_req_t *pstcReq);
+en_result_t DMA_MGR_GetStat(uint8_t u8Ch, stc_dma_mgr_stat_t *pstcStat);
+void DMA_MGR_ClearStat(void);
+/**
+ * @}
+ */
+
+#endif /* MW_DMA_MGR_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __DMA_MGR_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,857 @@
+/**
+ *******************************************************************************
+ * @file  dma_mgr.c
+ * @brief This midware file provides firmware functions to share the DMA
+ *        channels: channel ownership, callbacks of the shared DMA interrupts,
+ *        a queue of transfer requests and the busy time of the channels.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "dma_mgr.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_DMA_MGR DMA_MGR
+ * @brief DMA Channel Manager Midware Library
+ * @{
+ */
+
+#if (MW_DMA_MGR_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DMA_MGR_Local_Types DMA_MGR Local Types
+ * @{
+ */
+
+/**
+ * @brief DMA channel state structure definition
+ */
+typedef struct
+{
+    uint8_t  u8Owner;                   /*!< Free, acquired or running a request. */
+    stc_dma_mgr_req_t *pstcReq;         /*!< The running request. */
+    func_ptr_dma_mgr_cpl_cb_t pfnCplCb; /*!< Transfer complete callback. */
+    func_ptr_dma_mgr_err_cb_t pfnErrCb; /*!< Error callback. */
+    void *pvArg;                        /*!< Argument of the callbacks. */
+    uint32_t u32StartTime;              /*!< Time the channel became busy. */
+    stc_dma_mgr_stat_t stcStat;         /*!< Statistics. */
+} stc_dma_mgr_ch_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DMA_MGR_Local_Macros DMA_MGR Local Macros
+ * @{
+ */
+#define DMA_MGR_CH_NUM                  (2u)
+#define DMA_MGR_CH_NONE                 (0xFFu)
+
+/* Owner of a channel. */
+#define DMA_MGR_CH_FREE                 (0u)
+#define DMA_MGR_CH_ACQUIRED             (1u)
+#define DMA_MGR_CH_REQ                  (2u)
+
+/* State of a request. */
+#define DMA_MGR_REQ_IDLE                (0u)
+#define DMA_MGR_REQ_PENDING             (1u)
+#define DMA_MGR_REQ_RUNNING             (2u)
+
+/* The hardware clears the channel enable bit at the end of the transfer. */
+#define DMA_MGR_CH_ENABLED(ch)          (0ul != READ_REG32_BIT(M0P_DMA->CHEN, (1ul << (ch))))
+
+#define DMA_MGR_IS_MANAGED(ch)          (0u != (m_u8DmaMgrChMask & (uint8_t)(1u << (ch))))
+
+#define IS_DMA_MGR_CH_MASK(x)                                                  \
+(   (0u != (x))                                 &&                             \
+    (0u == ((x) & (uint8_t)(~DMA_MGR_CH_ALL))))
+
+#define IS_DMA_MGR_CH(x)                                                       \
+(   ((x) == DMA_CHANNEL_0)                      ||                             \
+    ((x) == DMA_CHANNEL_1))
+
+#define IS_DMA_MGR_LLP_RUN(x)                                                  \
+(   ((x) == DMA_LLP_RUN)                        ||                             \
+    ((x) == DMA_LLP_WAIT))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t DmaMgrGetTime(void);
+static uint8_t DmaMgrFindCh(uint8_t u8Prio);
+static void DmaMgrIrqCmd(uint8_t u8Ch, en_functional_state_t enNewState);
+static void DmaMgrStart(uint8_t u8Ch, stc_dma_mgr_req_t *pstcReq);
+static void DmaMgrFree(uint8_t u8Ch);
+static void DmaMgrSchedule(void);
+static void DmaMgrTcHandler(uint8_t u8Ch);
+static void DmaMgrTc0IrqCallback(void);
+static void DmaMgrTc1IrqCallback(void);
+static void DmaMgrErrIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DMA_MGR_Local_Variables DMA_MGR Local Variables
+ * @{
+ */
+static stc_dma_mgr_ch_t m_astcDmaMgrCh[DMA_MGR_CH_NUM];
+static stc_dma_mgr_req_t *m_pstcDmaMgrPend = NULL;
+static func_ptr_dma_mgr_time_t m_pfnDmaMgrGetTime = NULL;
+static uint8_t m_u8DmaMgrChMask = 0u;
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DMA_MGR_Global_Functions DMA_MGR Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the DMA manager, enable the DMA and register the transfer
+ *         complete interrupts of the managed channels and the error interrupt.
+ * @note   The drivers which keep a channel of their own register its transfer
+ *         complete interrupt themselves, the error interrupt belongs to the manager.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_dma_mgr_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: pstcCfg == NULL, the channel mask is invalid or
+ *                                    an IRQ number does not match its interrupt, the
+ *                                    IRQs registered before are disabled again
+ *           - ErrorNotReady: a managed channel is busy
+ */
+en_result_t DMA_MGR_Init(const stc_dma_mgr_cfg_t *pstcCfg)
+{
+    uint8_t i;
+    uint8_t u8IrqMask = 0u;
+    stc_irq_regi_config_t astcIrqRegiConf[3u];
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCfg) && IS_DMA_MGR_CH_MASK(pstcCfg->u8ChMask))
+    {
+        enRet = Ok;
+        for (i = 0u; i < DMA_MGR_CH_NUM; i++)
+        {
+            if (DMA_MGR_CH_FREE != m_astcDmaMgrCh[i].u8Owner)
+            {
+                enRet = ErrorNotReady;
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        CLK_FcgPeriphClockCmd(CLK_FCG_DMA | CLK_FCG_AOS, Enable);
+
+        astcIrqRegiConf[0u].enIRQn = pstcCfg->enErrIRQn;
+        astcIrqRegiConf[0u].enIntSrc = INT_DMA_ERR;
+        astcIrqRegiConf[0u].pfnCallback = &DmaMgrErrIrqCallback;
+        astcIrqRegiConf[1u].enIRQn = pstcCfg->enTc0IRQn;
+        astcIrqRegiConf[1u].enIntSrc = INT_DAM_1_TC0;
+        astcIrqRegiConf[1u].pfnCallback = &DmaMgrTc0IrqCallback;
+        astcIrqRegiConf[2u].enIRQn = pstcCfg->enTc1IRQn;
+        astcIrqRegiConf[2u].enIntSrc = INT_DAM_2_TC0;
+        astcIrqRegiConf[2u].pfnCallback = &DmaMgrTc1IrqCallback;
+
+        /* Register the error IRQ handler and the transfer complete IRQ handlers of the managed channels. */
+        for (i = 0u; (i < 3u) && (Ok == enRet); i++)
+        {
+            if ((0u == i) || (0u != (pstcCfg->u8ChMask & (uint8_t)(1u << (i - 1u)))))
+            {
+                if (Ok == INTC_IrqRegistration(&astcIrqRegiConf[i]))
+                {
+                    NVIC_ClearPendingIRQ(astcIrqRegiConf[i].enIRQn);
+                    NVIC_SetPriority(astcIrqRegiConf[i].enIRQn, DDL_IRQ_PRIORITY_03);
+                    NVIC_EnableIRQ(astcIrqRegiConf[i].enIRQn);
+                    u8IrqMask |= (uint8_t)(1u << i);
+                }
+                else
+                {
+                    enRet = ErrorInvalidParameter;
+                }
+            }
+        }
+
+        /* Take back the IRQs registered before the failure. */
+        if (Ok != enRet)
+        {
+            for (i = 0u; i < 3u; i++)
+            {
+                if (0u != (u8IrqMask & (uint8_t)(1u << i)))
+                {
+                    NVIC_DisableIRQ(astcIrqRegiConf[i].enIRQn);
+                    (void)INTC_IrqResign(astcIrqRegiConf[i].enIRQn);
+                }
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        m_u8DmaMgrChMask = pstcCfg->u8ChMask;
+        m_pfnDmaMgrGetTime = pstcCfg->pfnGetTime;
+        m_pstcDmaMgrPend = NULL;
+        DMA_MGR_ClearStat();
+        DMA_Cmd(Enable);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Acquire a free DMA channel for exclusive use until DMA_MGR_Release().
+ * @note   The owner configures and enables the channel itself and gets its
+ *         interrupts through DMA_MGR_SetCallback(). It is busy for the busy time
+ *         from here to DMA_MGR_Release().
+ * @param  [in] u8Prio                  Priority hint.
+ *                                      This parameter can be a value of @ref DMA_MGR_Priority
+ * @param  [out] pu8Ch                  DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Acquired
+ *           - ErrorInvalidParameter: pu8Ch == NULL
+ *           - ErrorNotReady: no managed channel is free
+ */
+en_result_t DMA_MGR_Acquire(uint8_t u8Prio, uint8_t *pu8Ch)
+{
+    uint8_t u8Ch;
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pu8Ch)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        u8Ch = DmaMgrFindCh(u8Prio);
+        if (DMA_MGR_CH_NONE != u8Ch)
+        {
+            m_astcDmaMgrCh[u8Ch].u8Owner = DMA_MGR_CH_ACQUIRED;
+            m_astcDmaMgrCh[u8Ch].u32StartTime = DmaMgrGetTime();
+            DmaMgrIrqCmd(u8Ch, Enable);
+            *pu8Ch = u8Ch;
+            enRet = Ok;
+        }
+        else
+        {
+            enRet = ErrorNotReady;
+        }
+
+        __set_PRIMASK(u32Primask);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Release an acquired DMA channel, it is disabled and given to the next
+ *         pending request.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Released
+ *           - ErrorInvalidParameter: the channel is not acquired
+ */
+en_result_t DMA_MGR_Release(uint8_t u8Ch)
+{
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (IS_DMA_MGR_CH(u8Ch))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (DMA_MGR_CH_ACQUIRED == m_astcDmaMgrCh[u8Ch].u8Owner)
+        {
+            DMA_ChannelDisable(u8Ch);
+            DmaMgrFree(u8Ch);
+            enRet = Ok;
+        }
+
+        __set_PRIMASK(u32Primask);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the callbacks of an acquired DMA channel.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  [in] pfnCplCb                Transfer complete callback, called at every
+ *                                      transfer complete interrupt, can be NULL.
+ * @param  [in] pfnErrCb                Error callback, can be NULL.
+ * @param  [in] pvArg                   Argument of the callbacks.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Set
+ *           - ErrorInvalidParameter: the channel is not acquired
+ */
+en_result_t DMA_MGR_SetCallback(uint8_t u8Ch, func_ptr_dma_mgr_cpl_cb_t pfnCplCb,
+                                func_ptr_dma_mgr_err_cb_t pfnErrCb, void *pvArg)
+{
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (IS_DMA_MGR_CH(u8Ch))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (DMA_MGR_CH_ACQUIRED == m_astcDmaMgrCh[u8Ch].u8Owner)
+        {
+            m_astcDmaMgrCh[u8Ch].pfnCplCb = pfnCplCb;
+            m_astcDmaMgrCh[u8Ch].pfnErrCb = pfnErrCb;
+            m_astcDmaMgrCh[u8Ch].pvArg = pvArg;
+            enRet = Ok;
+        }
+
+        __set_PRIMASK(u32Primask);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Submit a transfer request. It starts on a free channel at once, or is
+ *         queued in order of priority and starts as soon as a channel is free.
+ * @note   It can be called in the callbacks, e.g. to repeat the request.
+ * @param  [in] pstcReq                 Pointer to a @ref stc_dma_mgr_req_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Started or queued
+ *           - ErrorInvalidParameter: pstcReq == NULL or u32LlpRun is invalid
+ *           - ErrorOperationInProgress: the request is pending or running
+ *           - ErrorNotReady: the manager is not initialized
+ */
+en_result_t DMA_MGR_Submit(stc_dma_mgr_req_t *pstcReq)
+{
+    uint32_t u32Primask;
+    stc_dma_mgr_req_t **ppstcPos;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcReq) && ((NULL == pstcReq->pstcLlp) || IS_DMA_MGR_LLP_RUN(pstcReq->u32LlpRun)))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (DMA_MGR_REQ_IDLE != pstcReq->u8State)
+        {
+            enRet = ErrorOperationInProgress;
+        }
+        else if (0u == m_u8DmaMgrChMask)
+        {
+            enRet = ErrorNotReady;
+        }
+        else
+        {
+            /* Behind the requests of the same or higher priority. */
+            ppstcPos = &m_pstcDmaMgrPend;
+            while ((NULL != *ppstcPos) && ((*ppstcPos)->u8Prio <= pstcReq->u8Prio))
+            {
+                ppstcPos = &(*ppstcPos)->pstcNext;
+            }
+            pstcReq->pstcNext = *ppstcPos;
+            *ppstcPos = pstcReq;
+            pstcReq->u8State = DMA_MGR_REQ_PENDING;
+
+            DmaMgrSchedule();
+            enRet = Ok;
+        }
+
+        __set_PRIMASK(u32Primask);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Cancel a transfer request. A pending request is removed from the queue,
+ *         a running request is stopped and its channel given to the next pending
+ *         request. The callbacks are not called.
+ * @param  [in] pstcReq                 Pointer to a @ref stc_dma_mgr_req_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Cancelled
+ *           - ErrorInvalidParameter: pstcReq == NULL or the request is idle
+ */
+en_result_t DMA_MGR_Cancel(stc_dma_mgr_req_t *pstcReq)
+{
+    uint8_t i;
+    uint32_t u32Primask;
+    stc_dma_mgr_req_t **ppstcPos;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcReq)
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        if (DMA_MGR_REQ_PENDING == pstcReq->u8State)
+        {
+            ppstcPos = &m_pstcDmaMgrPend;
+            while ((NULL != *ppstcPos) && (pstcReq != *ppstcPos))
+            {
+                ppstcPos = &(*ppstcPos)->pstcNext;
+            }
+            if (NULL != *ppstcPos)
+            {
+                *ppstcPos = pstcReq->pstcNext;
+            }
+            pstcReq->u8State = DMA_MGR_REQ_IDLE;
+            enRet = Ok;
+        }
+        else if (DMA_MGR_REQ_RUNNING == pstcReq->u8State)
+        {
+            for (i = 0u; i < DMA_MGR_CH_NUM; i++)
+            {
+                if ((DMA_MGR_CH_REQ == m_astcDmaMgrCh[i].u8Owner) && (pstcReq == m_astcDmaMgrCh[i].pstcReq))
+                {
+                    DMA_ChannelDisable(i);
+                    pstcReq->u8State = DMA_MGR_REQ_IDLE;
+                    DmaMgrFree(i);
+                    enRet = Ok;
+                }
+            }
+        }
+        else
+        {
+            /* rsvd */
+        }
+
+        __set_PRIMASK(u32Primask);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the status of a transfer request.
+ * @param  [in] pstcReq                 Pointer to a @ref stc_dma_mgr_req_t structure
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: the request is pending or running
+ *           - Reset: the request is idle, or pstcReq == NULL
+ */
+en_flag_status_t DMA_MGR_IsBusy(const stc_dma_mgr_req_t *pstcReq)
+{
+    en_flag_status_t enStatus = Reset;
+
+    if ((NULL != pstcReq) && (DMA_MGR_REQ_IDLE != pstcReq->u8State))
+    {
+        enStatus = Set;
+    }
+
+    return enStatus;
+}
+
+/**
+ * @brief  Get the statistics of a DMA channel since DMA_MGR_ClearStat().
+ * @note   The busy time includes the current busy period of the channel, it wraps
+ *         around with the time source.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  [out] pstcStat               Pointer to a @ref stc_dma_mgr_stat_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Got
+ *           - ErrorInvalidParameter: the channel is invalid or pstcStat == NULL
+ */
+en_result_t DMA_MGR_GetStat(uint8_t u8Ch, stc_dma_mgr_stat_t *pstcStat)
+{
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (IS_DMA_MGR_CH(u8Ch) && (NULL != pstcStat))
+    {
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+
+        *pstcStat = m_astcDmaMgrCh[u8Ch].stcStat;
+        if (DMA_MGR_CH_FREE != m_astcDmaMgrCh[u8Ch].u8Owner)
+        {
+            pstcStat->u32BusyTime += DmaMgrGetTime() - m_astcDmaMgrCh[u8Ch].u32StartTime;
+        }
+
+        __set_PRIMASK(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Clear the statistics of both DMA channels, the utilization of a channel
+ *         is the busy time divided by the time since this call.
+ * @param  None
+ * @retval None
+ */
+void DMA_MGR_ClearStat(void)
+{
+    uint8_t i;
+    uint32_t u32Now;
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    u32Now = DmaMgrGetTime();
+    for (i = 0u; i < DMA_MGR_CH_NUM; i++)
+    {
+        m_astcDmaMgrCh[i].stcStat.u32BusyTime = 0ul;
+        m_astcDmaMgrCh[i].stcStat.u32ReqCnt = 0ul;
+        m_astcDmaMgrCh[i].stcStat.u32ErrCnt = 0ul;
+        m_astcDmaMgrCh[i].u32StartTime = u32Now;
+    }
+
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DMA_MGR_Local_Functions DMA_MGR Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Read the time source.
+ * @param  None
+ * @retval The time, 0 without a time source.
+ */
+static uint32_t DmaMgrGetTime(void)
+{
+    return (NULL != m_pfnDmaMgrGetTime) ? m_pfnDmaMgrGetTime() : 0ul;
+}
+
+/**
+ * @brief  Find a free managed channel, channel 0 first for a priority value below
+ *         DMA_MGR_PRIO_NORMAL, channel 1 first for the others.
+ * @param  [in] u8Prio                  Priority.
+ * @retval DMA_CHANNEL_0, DMA_CHANNEL_1 or DMA_MGR_CH_NONE.
+ */
+static uint8_t DmaMgrFindCh(uint8_t u8Prio)
+{
+    uint8_t u8Ch;
+
+    u8Ch = (u8Prio < DMA_MGR_PRIO_NORMAL) ? DMA_CHANNEL_0 : DMA_CHANNEL_1;
+    if (!(DMA_MGR_IS_MANAGED(u8Ch) && (DMA_MGR_CH_FREE == m_astcDmaMgrCh[u8Ch].u8Owner)))
+    {
+        u8Ch ^= 1u;
+        if (!(DMA_MGR_IS_MANAGED(u8Ch) && (DMA_MGR_CH_FREE == m_astcDmaMgrCh[u8Ch].u8Owner)))
+        {
+            u8Ch = DMA_MGR_CH_NONE;
+        }
+    }
+
+    return u8Ch;
+}
+
+/**
+ * @brief  Clear the flags and enable or disable the transfer complete and the error
+ *         interrupts of a channel.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  [in] enNewState              Enable or Disable.
+ * @retval None
+ */
+static void DmaMgrIrqCmd(uint8_t u8Ch, en_functional_state_t enNewState)
+{
+    DMA_ClearCplFlag(u8Ch, DMA_FLAG_TC);
+    DMA_ClearCplFlag(u8Ch, DMA_FLAG_BTC);
+    DMA_ClearErrFlag(u8Ch, DMA_FLAG_REQERR);
+    DMA_ClearErrFlag(u8Ch, DMA_FLAG_TRERR);
+    DMA_CplIrqCmd(u8Ch, DMA_IRQ_TC, enNewState);
+    DMA_ErrIrqCmd(u8Ch, DMA_IRQ_REQERR, enNewState);
+    DMA_ErrIrqCmd(u8Ch, DMA_IRQ_TRERR, enNewState);
+}
+
+/**
+ * @brief  Configure a free channel with a request and enable it.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  [in] pstcReq                 The request.
+ * @retval None
+ */
+static void DmaMgrStart(uint8_t u8Ch, stc_dma_mgr_req_t *pstcReq)
+{
+    stc_dma_mgr_ch_t *pstcCh = &m_astcDmaMgrCh[u8Ch];
+
+    pstcCh->u8Owner = DMA_MGR_CH_REQ;
+    pstcCh->pstcReq = pstcReq;
+    pstcCh->pfnCplCb = pstcReq->pfnCplCb;
+    pstcCh->pfnErrCb = pstcReq->pfnErrCb;
+    pstcCh->pvArg = pstcReq->pvArg;
+    pstcCh->u32StartTime = DmaMgrGetTime();
+    pstcReq->u8State = DMA_MGR_REQ_RUNNING;
+
+    DMA_ChannelCfg(u8Ch, &pstcReq->stcChCfg);
+    if (NULL != pstcReq->pstcLlp)
+    {
+        DMA_LlpInit(u8Ch, pstcReq->u32LlpRun, (uint32_t)pstcReq->pstcLlp);
+    }
+    else
+    {
+        DMA_LlpCmd(u8Ch, Disable);
+    }
+    DMA_SetTriggerSrc(u8Ch, pstcReq->enTrigSrc);
+    DmaMgrIrqCmd(u8Ch, Enable);
+    DMA_ChannelEnable(u8Ch);
+}
+
+/**
+ * @brief  Free a channel, add its busy time and start the next pending request.
+ * @note   Called with the interrupts disabled.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @retval None
+ */
+static void DmaMgrFree(uint8_t u8Ch)
+{
+    stc_dma_mgr_ch_t *pstcCh = &m_astcDmaMgrCh[u8Ch];
+
+    DmaMgrIrqCmd(u8Ch, Disable);
+    pstcCh->stcStat.u32BusyTime += DmaMgrGetTime() - pstcCh->u32StartTime;
+    pstcCh->u8Owner = DMA_MGR_CH_FREE;
+    pstcCh->pstcReq = NULL;
+    pstcCh->pfnCplCb = NULL;
+    pstcCh->pfnErrCb = NULL;
+    pstcCh->pvArg = NULL;
+
+    DmaMgrSchedule();
+}
+
+/**
+ * @brief  Start the pending requests on the free channels in order of priority.
+ * @note   Called with the interrupts disabled.
+ * @param  None
+ * @retval None
+ */
+static void DmaMgrSchedule(void)
+{
+    uint8_t u8Ch = 0u;
+    stc_dma_mgr_req_t *pstcReq;
+
+    while ((NULL != m_pstcDmaMgrPend) && (DMA_MGR_CH_NONE != u8Ch))
+    {
+        u8Ch = DmaMgrFindCh(m_pstcDmaMgrPend->u8Prio);
+        if (DMA_MGR_CH_NONE != u8Ch)
+        {
+            pstcReq = m_pstcDmaMgrPend;
+            m_pstcDmaMgrPend = pstcReq->pstcNext;
+            pstcReq->pstcNext = NULL;
+            DmaMgrStart(u8Ch, pstcReq);
+        }
+    }
+}
+
+/**
+ * @brief  Transfer complete handler of a channel. An acquired channel gets its
+ *         callback at every transfer complete, a request completes when the
+ *         hardware has disabled the channel at the end of the chain.
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @retval None
+ */
+static void DmaMgrTcHandler(uint8_t u8Ch)
+{
+    uint32_t u32Primask;
+    void *pvArg;
+    func_ptr_dma_mgr_cpl_cb_t pfnCplCb = NULL;
+    stc_dma_mgr_ch_t *pstcCh = &m_astcDmaMgrCh[u8Ch];
+
+    DMA_ClearCplFlag(u8Ch, DMA_FLAG_TC);
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    pvArg = pstcCh->pvArg;
+    if (DMA_MGR_CH_ACQUIRED == pstcCh->u8Owner)
+    {
+        pfnCplCb = pstcCh->pfnCplCb;
+    }
+    else if ((DMA_MGR_CH_REQ == pstcCh->u8Owner) && (!DMA_MGR_CH_ENABLED(u8Ch)))
+    {
+        pfnCplCb = pstcCh->pfnCplCb;
+        pstcCh->pstcReq->u8State = DMA_MGR_REQ_IDLE;
+        pstcCh->stcStat.u32ReqCnt++;
+        DmaMgrFree(u8Ch);
+    }
+    else
+    {
+        /* rsvd */
+    }
+
+    __set_PRIMASK(u32Primask);
+
+    /* The next request has been started, the callback may submit again. */
+    if (NULL != pfnCplCb)
+    {
+        pfnCplCb(u8Ch, pvArg);
+    }
+}
+
+/**
+ * @brief  DMA channel 0 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void DmaMgrTc0IrqCallback(void)
+{
+    DmaMgrTcHandler(DMA_CHANNEL_0);
+}
+
+/**
+ * @brief  DMA channel 1 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void DmaMgrTc1IrqCallback(void)
+{
+    DmaMgrTcHandler(DMA_CHANNEL_1);
+}
+
+/**
+ * @brief  DMA error IRQ callback. A request with an error is stopped and its
+ *         channel given to the next pending request, an acquired channel stays
+ *         with its owner.
+ * @param  None
+ * @retval None
+ */
+static void DmaMgrErrIrqCallback(void)
+{
+    uint8_t i;
+    uint32_t u32Flag;
+    uint32_t u32Primask;
+    void *pvArg;
+    func_ptr_dma_mgr_err_cb_t pfnErrCb;
+    stc_dma_mgr_ch_t *pstcCh;
+
+    for (i = 0u; i < DMA_MGR_CH_NUM; i++)
+    {
+        u32Flag = 0ul;
+        if (DMA_MGR_IS_MANAGED(i))
+        {
+            if (Set == DMA_GetErrFlag(i, DMA_FLAG_REQERR))
+            {
+                DMA_ClearErrFlag(i, DMA_FLAG_REQERR);
+                u32Flag |= DMA_FLAG_REQERR;
+            }
+            if (Set == DMA_GetErrFlag(i, DMA_FLAG_TRERR))
+            {
+                DMA_ClearErrFlag(i, DMA_FLAG_TRERR);
+                u32Flag |= DMA_FLAG_TRERR;
+            }
+        }
+
+        if (0ul != u32Flag)
+        {
+            pstcCh = &m_astcDmaMgrCh[i];
+
+            u32Primask = __get_PRIMASK();
+            __disable_irq();
+
+            pfnErrCb = NULL;
+            pvArg = NULL;
+            /* The error of a free channel is cleared only, it has no owner to count for. */
+            if (DMA_MGR_CH_FREE != pstcCh->u8Owner)
+            {
+                pfnErrCb = pstcCh->pfnErrCb;
+                pvArg = pstcCh->pvArg;
+                pstcCh->stcStat.u32ErrCnt++;
+            }
+            if (DMA_MGR_CH_REQ == pstcCh->u8Owner)
+            {
+                DMA_ChannelDisable(i);
+                pstcCh->pstcReq->u8State = DMA_MGR_REQ_IDLE;
+                DmaMgrFree(i);
+            }
+
+            __set_PRIMASK(u32Primask);
+
+            if (NULL != pfnErrCb)
+            {
+                pfnErrCb(i, u32Flag, pvArg);
+            }
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_DMA_MGR_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
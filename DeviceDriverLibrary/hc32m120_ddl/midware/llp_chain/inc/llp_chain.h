@@ -0,0 +1,198 @@
+/**
+ *******************************************************************************
+ * @file  llp_chain.h
+ * @brief This file contains all the functions prototypes of the DMA LLP
+ *        descriptor chain builder midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __LLP_CHAIN_H__
+#define __LLP_CHAIN_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_LLP_CHAIN
+ * @{
+ */
+
+#if (MW_LLP_CHAIN_ENABLE == DDL_ON)
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_DMA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_DMA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup LLP_CHAIN_Global_Types LLP_CHAIN Global Types
+ * @{
+ */
+
+/**
+ * @brief Transfer structure definition
+ */
+typedef struct
+{
+    uint32_t u32SrcAddr;                /*!< Source address. */
+    uint32_t u32DesAddr;                /*!< Destination address. */
+    uint32_t u32Len;                    /*!< Data to transfer, in unit of the data width. */
+    uint32_t u32DataWidth;              /*!< Data width.
+                                             This parameter can be a value of @ref DMA_DataWidth */
+    uint32_t u32SrcInc;                 /*!< Source address mode.
+                                             This parameter can be a value of @ref DMA_SrcAddr_Incremented_Mode */
+    uint32_t u32DesInc;                 /*!< Destination address mode.
+                                             This parameter can be a value of @ref DMA_DesAddr_Incremented_Mode */
+    uint32_t u32BlockSize;              /*!< Data per request, 1 ~ LLP_CHAIN_BLKSIZE_MAX, u32Len must be a
+                                             multiple of it. 0: the largest blocks, for memory to memory. */
+} stc_llp_chain_xfer_t;
+
+/**
+ * @brief Descriptor chain structure definition
+ * @note  1. The descriptors are written one after another into the pool, which must
+ *           be in the RAM, each linked to the next. The pool is read by DMA while
+ *           the chain runs.
+ *        2. The first error is kept in enStatus and every later call returns it, so
+ *           a chain can be built by a series of calls and checked once at the end.
+ */
+typedef struct
+{
+    stc_dma_llp_descriptor_t *pstcPool; /*!< Descriptor pool. */
+    uint16_t u16PoolSize;               /*!< Descriptors in the pool. */
+    uint16_t u16Num;                    /*!< Descriptors used. */
+    uint32_t u32LlpRun;                 /*!< Start of a linked descriptor, DMA_LLP_RUN or DMA_LLP_WAIT. */
+    en_result_t enStatus;               /*!< Ok, or the first error. */
+} stc_llp_chain_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup LLP_CHAIN_Global_Macros LLP_CHAIN Global Macros
+ * @{
+ */
+#define LLP_CHAIN_BLKSIZE_MAX           (255ul)     /*!< Data per request of a descriptor, BLKSIZE. */
+#define LLP_CHAIN_CNT_MAX               (1023ul)    /*!< Requests of a descriptor, CNT. */
+
+#define LLP_CHAIN_XFER_MAX              (LLP_CHAIN_BLKSIZE_MAX * LLP_CHAIN_CNT_MAX) /*!< Data of a descriptor. */
+
+/* Descriptors needed by a transfer of len data in blocks of blk, 0: the largest blocks. */
+#define LLP_CHAIN_DESC_NUM(len, blk)                                           \
+(   (0ul == (blk)) ?                                                           \
+    (((len) / LLP_CHAIN_XFER_MAX) +                                            \
+     ((0ul != ((len) % LLP_CHAIN_XFER_MAX)) ? 1ul : 0ul) +                     \
+     (((((len) % LLP_CHAIN_XFER_MAX) > LLP_CHAIN_BLKSIZE_MAX) &&               \
+       (0ul != ((len) % LLP_CHAIN_BLKSIZE_MAX))) ? 1ul : 0ul)) :               \
+    ((((len) / (blk)) + LLP_CHAIN_CNT_MAX - 1ul) / LLP_CHAIN_CNT_MAX))
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup LLP_CHAIN_Global_Functions
+ * @{
+ */
+en_result_t LLP_CHAIN_Init(stc_llp_chain_t *pstcChain, stc_dma_llp_descriptor_t *pstcPool,
+                           uint16_t u16PoolSize, uint32_t u32LlpRun);
+en_result_t LLP_CHAIN_Add(stc_llp_chain_t *pstcChain, const stc_llp_chain_xfer_t *pstcXfer);
+en_result_t LLP_CHAIN_Loop(stc_llp_chain_t *pstcChain);
+en_result_t LLP_CHAIN_GetChCfg(const stc_llp_chain_t *pstcChain, stc_dma_ch_cfg_t *pstcChCfg,
+                               const stc_dma_llp_descriptor_t **ppstcLlp);
+en_result_t LLP_CHAIN_Load(const stc_llp_chain_t *pstcChain, uint8_t u8Ch, en_event_src_t enTrigSrc);
+/**
+ * @}
+ */
+
+#endif /* MW_LLP_CHAIN_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LLP_CHAIN_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
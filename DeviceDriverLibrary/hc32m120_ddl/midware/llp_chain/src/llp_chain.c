@@ -0,0 +1,449 @@
+/**
+ *******************************************************************************
+ * @file  llp_chain.c
+ * @brief This midware file provides firmware functions to build DMA LLP
+ *        descriptor chains, transfers longer than the count and the block
+ *        size of a descriptor are split into linked descriptors.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "llp_chain.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_LLP_CHAIN LLP_CHAIN
+ * @brief DMA LLP Descriptor Chain Builder Midware Library
+ * @{
+ */
+
+#if (MW_LLP_CHAIN_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup LLP_CHAIN_Local_Macros LLP_CHAIN Local Macros
+ * @{
+ */
+#define LLP_CHAIN_LLP_FIELD(addr)       (((addr) & 0x00000FFCul) << (DMA_CH0CTL0_LLP_POS - 2ul))
+#define LLP_CHAIN_LLP_MASK              (DMA_LLP_ENABLE | DMA_CH0CTL0_LLPRUN | DMA_CH0CTL0_LLP)
+
+/* Bytes of a data. */
+#define LLP_CHAIN_WIDTH_BYTES(w)        (1ul << ((w) >> DMA_CH0CTL0_HSIZE_POS))
+
+#define IS_LLP_CHAIN_LLP_RUN(x)                                                \
+(   ((x) == DMA_LLP_RUN)                        ||                             \
+    ((x) == DMA_LLP_WAIT))
+
+#define IS_LLP_CHAIN_DATA_WIDTH(x)                                             \
+(   ((x) == DMA_DATAWIDTH_8BIT)                 ||                             \
+    ((x) == DMA_DATAWIDTH_16BIT)                ||                             \
+    ((x) == DMA_DATAWIDTH_32BIT))
+
+#define IS_LLP_CHAIN_SRC_INC(x)                                                \
+(   ((x) == DMA_SRCADDRINC_FIX)                 ||                             \
+    ((x) == DMA_SRCADDRINC_INC)                 ||                             \
+    ((x) == DMA_SRCADDRINC_DEC))
+
+#define IS_LLP_CHAIN_DES_INC(x)                                                \
+(   ((x) == DMA_DESADDRINC_FIX)                 ||                             \
+    ((x) == DMA_DESADDRINC_INC)                 ||                             \
+    ((x) == DMA_DESADDRINC_DEC))
+
+#define IS_LLP_CHAIN_XFER(x)                                                   \
+(   (0ul != (x)->u32Len)                                        &&             \
+    IS_LLP_CHAIN_DATA_WIDTH((x)->u32DataWidth)                  &&             \
+    IS_LLP_CHAIN_SRC_INC((x)->u32SrcInc)                        &&             \
+    IS_LLP_CHAIN_DES_INC((x)->u32DesInc)                        &&             \
+    ((x)->u32BlockSize <= LLP_CHAIN_BLKSIZE_MAX)                &&             \
+    ((0ul == (x)->u32BlockSize) || (0ul == ((x)->u32Len % (x)->u32BlockSize))))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t LlpChainNextAddr(uint32_t u32Addr, uint32_t u32Inc, uint32_t u32Bytes);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup LLP_CHAIN_Global_Functions LLP_CHAIN Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize an empty descriptor chain on a descriptor pool.
+ * @param  [out] pstcChain              Pointer to a @ref stc_llp_chain_t structure
+ * @param  [in] pstcPool                Descriptor pool in the RAM.
+ * @param  [in] u16PoolSize             Descriptors in the pool.
+ * @param  [in] u32LlpRun               Start of a linked descriptor.
+ *                                      This parameter can be a value of @ref DMA_Llp_Mode
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize successfully
+ *           - ErrorInvalidParameter: a pointer is NULL, the pool is empty or
+ *                                    u32LlpRun is invalid
+ */
+en_result_t LLP_CHAIN_Init(stc_llp_chain_t *pstcChain, stc_dma_llp_descriptor_t *pstcPool,
+                           uint16_t u16PoolSize, uint32_t u32LlpRun)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcChain)
+    {
+        if ((NULL != pstcPool) && (0u != u16PoolSize) && IS_LLP_CHAIN_LLP_RUN(u32LlpRun))
+        {
+            enRet = Ok;
+        }
+        pstcChain->pstcPool = pstcPool;
+        pstcChain->u16PoolSize = u16PoolSize;
+        pstcChain->u16Num = 0u;
+        pstcChain->u32LlpRun = u32LlpRun;
+        pstcChain->enStatus = enRet;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Append a transfer to the chain, split into descriptors of at most
+ *         LLP_CHAIN_CNT_MAX requests of at most LLP_CHAIN_BLKSIZE_MAX data.
+ * @note   The first descriptor of the transfer is linked to the last one of the
+ *         chain, LLP_CHAIN_DESC_NUM() gives the descriptors it takes.
+ * @param  [in] pstcChain               Pointer to a @ref stc_llp_chain_t structure
+ * @param  [in] pstcXfer                Pointer to a @ref stc_llp_chain_xfer_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Appended
+ *           - ErrorInvalidParameter: a pointer is NULL or the transfer is invalid
+ *           - ErrorAddressAlignment: an address is not aligned to the data width
+ *           - ErrorBufferFull: the pool is too small
+ *           - ErrorInvalidMode: the chain is a loop
+ *           - The first error of the chain
+ */
+en_result_t LLP_CHAIN_Add(stc_llp_chain_t *pstcChain, const stc_llp_chain_xfer_t *pstcXfer)
+{
+    uint32_t u32Rem;
+    uint32_t u32Blk;
+    uint32_t u32Cnt;
+    uint32_t u32Bytes;
+    uint32_t u32SrcAddr;
+    uint32_t u32DesAddr;
+    stc_dma_llp_descriptor_t *pstcDesc;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcChain)
+    {
+        enRet = pstcChain->enStatus;
+        if (Ok == enRet)
+        {
+            if ((NULL == pstcXfer) || (!IS_LLP_CHAIN_XFER(pstcXfer)))
+            {
+                enRet = ErrorInvalidParameter;
+            }
+            else if ((0ul != (pstcXfer->u32SrcAddr & (LLP_CHAIN_WIDTH_BYTES(pstcXfer->u32DataWidth) - 1ul))) ||
+                     (0ul != (pstcXfer->u32DesAddr & (LLP_CHAIN_WIDTH_BYTES(pstcXfer->u32DataWidth) - 1ul))))
+            {
+                enRet = ErrorAddressAlignment;
+            }
+            else if (((uint32_t)pstcChain->u16PoolSize - pstcChain->u16Num) <
+                     LLP_CHAIN_DESC_NUM(pstcXfer->u32Len, pstcXfer->u32BlockSize))
+            {
+                enRet = ErrorBufferFull;
+            }
+            else if ((0u != pstcChain->u16Num) &&
+                     (0ul != (pstcChain->pstcPool[pstcChain->u16Num - 1u].CHxCTL0 & DMA_LLP_ENABLE)))
+            {
+                enRet = ErrorInvalidMode;
+            }
+            else
+            {
+                u32Rem = pstcXfer->u32Len;
+                u32SrcAddr = pstcXfer->u32SrcAddr;
+                u32DesAddr = pstcXfer->u32DesAddr;
+                while (0ul != u32Rem)
+                {
+                    u32Blk = pstcXfer->u32BlockSize;
+                    if (0ul == u32Blk)
+                    {
+                        u32Blk = (u32Rem < LLP_CHAIN_BLKSIZE_MAX) ? u32Rem : LLP_CHAIN_BLKSIZE_MAX;
+                    }
+                    u32Cnt = u32Rem / u32Blk;
+                    if (u32Cnt > LLP_CHAIN_CNT_MAX)
+                    {
+                        u32Cnt = LLP_CHAIN_CNT_MAX;
+                    }
+
+                    /* Link the last descriptor of the chain to the new one. */
+                    pstcDesc = &pstcChain->pstcPool[pstcChain->u16Num];
+                    if (0u != pstcChain->u16Num)
+                    {
+                        pstcChain->pstcPool[pstcChain->u16Num - 1u].CHxCTL0 |= DMA_LLP_ENABLE | pstcChain->u32LlpRun |
+                                                                              LLP_CHAIN_LLP_FIELD((uint32_t)pstcDesc);
+                    }
+                    pstcDesc->SARx = u32SrcAddr;
+                    pstcDesc->DARx = u32DesAddr;
+                    pstcDesc->CHxCTL0 = u32Blk | (u32Cnt << DMA_CH0CTL0_CNT_POS) | pstcXfer->u32DataWidth;
+                    pstcDesc->CHxCTL1 = pstcXfer->u32SrcInc | pstcXfer->u32DesInc;
+                    pstcChain->u16Num++;
+
+                    u32Bytes = u32Blk * u32Cnt * LLP_CHAIN_WIDTH_BYTES(pstcXfer->u32DataWidth);
+                    u32SrcAddr = LlpChainNextAddr(u32SrcAddr, pstcXfer->u32SrcInc >> DMA_CH0CTL1_SINC_POS, u32Bytes);
+                    u32DesAddr = LlpChainNextAddr(u32DesAddr, pstcXfer->u32DesInc >> DMA_CH0CTL1_DINC_POS, u32Bytes);
+                    u32Rem -= u32Blk * u32Cnt;
+                }
+            }
+            pstcChain->enStatus = enRet;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Link the last descriptor of the chain to the first one, the chain then
+ *         runs until the channel is disabled.
+ * @param  [in] pstcChain               Pointer to a @ref stc_llp_chain_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Linked
+ *           - ErrorInvalidParameter: pstcChain == NULL or the chain is empty
+ *           - The first error of the chain
+ */
+en_result_t LLP_CHAIN_Loop(stc_llp_chain_t *pstcChain)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcChain)
+    {
+        enRet = pstcChain->enStatus;
+        if ((Ok == enRet) && (0u != pstcChain->u16Num))
+        {
+            pstcChain->pstcPool[pstcChain->u16Num - 1u].CHxCTL0 =
+                (pstcChain->pstcPool[pstcChain->u16Num - 1u].CHxCTL0 & ~LLP_CHAIN_LLP_MASK) |
+                DMA_LLP_ENABLE | pstcChain->u32LlpRun | LLP_CHAIN_LLP_FIELD((uint32_t)pstcChain->pstcPool);
+        }
+        else if (Ok == enRet)
+        {
+            enRet = ErrorInvalidParameter;
+            pstcChain->enStatus = enRet;
+        }
+        else
+        {
+            /* rsvd */
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the channel configuration of the first descriptor and the descriptor
+ *         linked to it, e.g. for DMA_MGR_Submit().
+ * @param  [in] pstcChain               Pointer to a @ref stc_llp_chain_t structure
+ * @param  [out] pstcChCfg              Pointer to a @ref stc_dma_ch_cfg_t structure
+ * @param  [out] ppstcLlp               The linked descriptor, NULL: none. The mode is
+ *                                      u32LlpRun of the chain.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Got
+ *           - ErrorInvalidParameter: a pointer is NULL or the chain is empty
+ *           - The first error of the chain
+ */
+en_result_t LLP_CHAIN_GetChCfg(const stc_llp_chain_t *pstcChain, stc_dma_ch_cfg_t *pstcChCfg,
+                               const stc_dma_llp_descriptor_t **ppstcLlp)
+{
+    const stc_dma_llp_descriptor_t *pstcDesc;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcChain) && (NULL != pstcChCfg) && (NULL != ppstcLlp))
+    {
+        enRet = pstcChain->enStatus;
+        if ((Ok == enRet) && (0u != pstcChain->u16Num))
+        {
+            pstcDesc = &pstcChain->pstcPool[0u];
+            pstcChCfg->u32DataWidth = pstcDesc->CHxCTL0 & DMA_CH0CTL0_HSIZE;
+            pstcChCfg->u32BlockSize = pstcDesc->CHxCTL0 & DMA_CH0CTL0_BLKSIZE;
+            pstcChCfg->u32TransferCnt = (pstcDesc->CHxCTL0 & DMA_CH0CTL0_CNT) >> DMA_CH0CTL0_CNT_POS;
+            pstcChCfg->u32SrcAddr = pstcDesc->SARx;
+            pstcChCfg->u32DesAddr = pstcDesc->DARx;
+            pstcChCfg->u32SrcInc = pstcDesc->CHxCTL1 & DMA_CH0CTL1_SINC;
+            pstcChCfg->u32DesInc = pstcDesc->CHxCTL1 & DMA_CH0CTL1_DINC;
+
+            *ppstcLlp = NULL;
+            if (0ul != (pstcDesc->CHxCTL0 & DMA_LLP_ENABLE))
+            {
+                /* The second descriptor, or the first one of a loop of one. */
+                *ppstcLlp = (pstcChain->u16Num > 1u) ? &pstcChain->pstcPool[1u] : pstcDesc;
+            }
+        }
+        else if (Ok == enRet)
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else
+        {
+            /* rsvd */
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Load the first descriptor of the chain into a DMA channel and set its
+ *         trigger source. The channel is enabled by DMA_ChannelEnable().
+ * @param  [in] pstcChain               Pointer to a @ref stc_llp_chain_t structure
+ * @param  [in] u8Ch                    DMA_CHANNEL_0 or DMA_CHANNEL_1.
+ * @param  [in] enTrigSrc               Event which requests the transfers.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Loaded
+ *           - ErrorInvalidParameter: pstcChain == NULL, the chain is empty or the
+ *                                    channel is invalid
+ *           - The first error of the chain
+ */
+en_result_t LLP_CHAIN_Load(const stc_llp_chain_t *pstcChain, uint8_t u8Ch, en_event_src_t enTrigSrc)
+{
+    stc_dma_ch_cfg_t stcChCfg;
+    const stc_dma_llp_descriptor_t *pstcLlp;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((DMA_CHANNEL_0 == u8Ch) || (DMA_CHANNEL_1 == u8Ch))
+    {
+        enRet = LLP_CHAIN_GetChCfg(pstcChain, &stcChCfg, &pstcLlp);
+        if (Ok == enRet)
+        {
+            CLK_FcgPeriphClockCmd(CLK_FCG_DMA | CLK_FCG_AOS, Enable);
+            DMA_ChannelCfg(u8Ch, &stcChCfg);
+            if (NULL != pstcLlp)
+            {
+                DMA_LlpInit(u8Ch, pstcChain->u32LlpRun, (uint32_t)pstcLlp);
+            }
+            else
+            {
+                DMA_LlpCmd(u8Ch, Disable);
+            }
+            DMA_SetTriggerSrc(u8Ch, enTrigSrc);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup LLP_CHAIN_Local_Functions LLP_CHAIN Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Address after a descriptor.
+ * @param  [in] u32Addr                 Address of the descriptor.
+ * @param  [in] u32Inc                  0: fixed, 1: increment, 2: decrement.
+ * @param  [in] u32Bytes                Bytes transferred by the descriptor.
+ * @retval The address.
+ */
+static uint32_t LlpChainNextAddr(uint32_t u32Addr, uint32_t u32Inc, uint32_t u32Bytes)
+{
+    uint32_t u32Ret = u32Addr;
+
+    if (1ul == u32Inc)
+    {
+        u32Ret = u32Addr + u32Bytes;
+    }
+    else if (2ul == u32Inc)
+    {
+        u32Ret = u32Addr - u32Bytes;
+    }
+    else
+    {
+        /* rsvd */
+    }
+
+    return u32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_LLP_CHAIN_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
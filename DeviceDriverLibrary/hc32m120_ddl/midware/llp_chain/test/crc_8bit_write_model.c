@@ -0,0 +1,278 @@
+/**
+ *******************************************************************************
+ * @file  crc_8bit_write_model.c
+ * @brief Host check of CRC_8BitWrite() in hc32m120_crc.c. The CRC data register
+ *        is modeled and the bytes of every write are fed to CalaCRC16() and
+ *        CalaCRC32() of the crc_software example, which are compared with the
+ *        checksums of the buffer.
+ @verbatim
+   Build and run on the host from the directory hc32m120_ddl, <cfg> is a
+   directory with a ddl_config.h which turns DDL_CRC_ENABLE and
+   DDL_UTILITY_ENABLE on:
+     gcc -std=c99 -DUSE_DDL_DRIVER -DHC32M120 -I<cfg> -Imcu/common
+         -Imcu/GCC/CMSIS/Core/Include -Idriver/inc -Idriver/src
+         midware/llp_chain/test/crc_8bit_write_model.c -o crc_8bit_write_model
+     ./crc_8bit_write_model
+   The exit code is the number of failed cases.
+
+   The CRC unit consumes a write of any width as its bytes in memory order,
+   the model feeds them the same way. A written byte is found by the change of
+   the register, which is filled with the complement of the expected bytes
+   before each access.
+
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Heqb            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "hc32m120_crc.h"
+
+/* Every access to the CRC registers goes through ModelCrcReg(). */
+#undef M0P_CRC
+#define M0P_CRC                         (ModelCrcReg())
+#undef bM0P_CRC
+#define bM0P_CRC                        (&m_stcModelBit)
+
+static M0P_CRC_TypeDef *ModelCrcReg(void);
+static bM0P_CRC_TypeDef m_stcModelBit;
+
+#include "hc32m120_crc.c"
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define MODEL_OFFSET_MAX                (8u)
+#define MODEL_LENGTH_MAX                (300u)
+
+#define MODEL_CRC16_INIT                (0xFFFFul)
+#define MODEL_CRC32_INIT                (0xFFFFFFFFul)
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static M0P_CRC_TypeDef m_stcModelReg;
+/* Complement of the expected bytes, written into DAT0 before each access. */
+static uint8_t m_au8Sentinel[4u];
+/* Expected byte stream and the bytes fed so far. */
+static const uint8_t *m_pu8Expect;
+static uint32_t m_u32ExpectLen;
+static uint32_t m_u32Fed;
+static uint8_t m_au8Fed[MODEL_LENGTH_MAX + 4u];
+static int m_iBadWrite;
+static int m_iFails;
+
+/*******************************************************************************
+ * Function implementation - local ('static')
+ ******************************************************************************/
+/* CRC-16 of the crc_software example. */
+static uint16_t CalaCRC16(const uint8_t *pu8Data, uint32_t u32InitVal, uint8_t u8ByteWidth, uint32_t u32Length)
+{
+    uint32_t i = 0u, j = 0u;
+    uint16_t crc = (uint16_t)u32InitVal;
+
+    while (u32Length--)
+    {
+        i = u8ByteWidth;
+        while (i--)
+        {
+            crc ^= (*pu8Data++);
+            for (j = 0u; j < 8u; j++)
+            {
+                if (crc & 0x1u)
+                {
+                    crc >>= 1u;
+                    crc ^= 0x8408u;
+                }
+                else
+                {
+                    crc >>= 1u;
+                }
+            }
+        }
+    }
+
+    crc = ~crc;
+
+    return crc;
+}
+
+/* CRC-32 of the crc_software example. */
+static uint32_t CalaCRC32(const uint8_t *pu8Data, uint32_t u32InitVal, uint8_t u8ByteWidth, uint32_t u32Length)
+{
+    uint32_t i = 0u, j = 0u;
+    uint32_t crc = u32InitVal;
+
+    while (u32Length--)
+    {
+        i = u8ByteWidth;
+        while (i--)
+        {
+            crc ^= (*pu8Data++);
+            for (j = 0u; j < 8u; j++)
+            {
+                if (crc & 0x1u)
+                {
+                    crc = (crc >> 1u) ^ 0xEDB88320ul;
+                }
+                else
+                {
+                    crc = (crc >> 1u);
+                }
+            }
+        }
+    }
+    crc = ~crc;
+
+    return crc;
+}
+
+/* Feed the bytes written into DAT0 since the last access, then arm DAT0 again. */
+static void ModelFeed(void)
+{
+    uint8_t au8Dat[4u];
+    uint32_t u32Num = 0ul;
+    uint32_t i;
+
+    memcpy(au8Dat, (const void *)&m_stcModelReg.DAT0, 4u);
+    while ((u32Num < 4ul) && (au8Dat[u32Num] != m_au8Sentinel[u32Num]))
+    {
+        u32Num++;
+    }
+    /* A write is 1, 2 or 4 bytes from DAT0 on, nothing is written behind it. */
+    for (i = u32Num; i < 4ul; i++)
+    {
+        if (au8Dat[i] != m_au8Sentinel[i])
+        {
+            m_iBadWrite = 1;
+        }
+    }
+    if ((3ul == u32Num) || ((m_u32Fed + u32Num) > (MODEL_LENGTH_MAX + 4u)))
+    {
+        m_iBadWrite = 1;
+    }
+    else
+    {
+        memcpy(&m_au8Fed[m_u32Fed], au8Dat, u32Num);
+        m_u32Fed += u32Num;
+    }
+
+    for (i = 0ul; i < 4ul; i++)
+    {
+        m_au8Sentinel[i] = ((m_u32Fed + i) < m_u32ExpectLen) ?
+                           (uint8_t)~m_pu8Expect[m_u32Fed + i] : (uint8_t)0xA5u;
+    }
+    memcpy((void *)&m_stcModelReg.DAT0, m_au8Sentinel, 4u);
+}
+
+static M0P_CRC_TypeDef *ModelCrcReg(void)
+{
+    ModelFeed();
+    return &m_stcModelReg;
+}
+
+static void ModelCheck(int iCond, const char *pcMsg, uint32_t u32Offset, uint32_t u32Len)
+{
+    if (!iCond)
+    {
+        printf("FAIL offset %u length %u: %s\n", (unsigned)u32Offset, (unsigned)u32Len, pcMsg);
+        m_iFails++;
+    }
+}
+
+/*******************************************************************************
+ * Function implementation - global ('extern')
+ ******************************************************************************/
+int main(void)
+{
+    static uint32_t au32Buf[(MODEL_OFFSET_MAX + MODEL_LENGTH_MAX + 3u) / 4u];
+    uint8_t *pu8Buf = (uint8_t *)au32Buf;
+    uint32_t u32Offset;
+    uint32_t u32Len;
+    uint32_t i;
+
+    for (i = 0ul; i < sizeof(au32Buf); i++)
+    {
+        pu8Buf[i] = (uint8_t)((i * 2654435761ul) >> 24u);
+    }
+
+    for (u32Offset = 0ul; u32Offset < MODEL_OFFSET_MAX; u32Offset++)
+    {
+        for (u32Len = 0ul; u32Len < MODEL_LENGTH_MAX; u32Len++)
+        {
+            m_pu8Expect    = &pu8Buf[u32Offset];
+            m_u32ExpectLen = u32Len;
+            m_u32Fed       = 0ul;
+            m_iBadWrite    = 0;
+            ModelFeed();
+
+            CRC_8BitWrite(m_pu8Expect, u32Len);
+            ModelFeed();
+
+            ModelCheck(0 == m_iBadWrite, "write width", u32Offset, u32Len);
+            ModelCheck(m_u32Fed == u32Len, "bytes written", u32Offset, u32Len);
+            if (m_u32Fed == u32Len)
+            {
+                ModelCheck(CalaCRC16(m_au8Fed, MODEL_CRC16_INIT, 1u, m_u32Fed) ==
+                           CalaCRC16(m_pu8Expect, MODEL_CRC16_INIT, 1u, u32Len), "CRC16", u32Offset, u32Len);
+                ModelCheck(CalaCRC32(m_au8Fed, MODEL_CRC32_INIT, 1u, m_u32Fed) ==
+                           CalaCRC32(m_pu8Expect, MODEL_CRC32_INIT, 1u, u32Len), "CRC32", u32Offset, u32Len);
+            }
+        }
+    }
+
+    printf("CRC_8BitWrite model: %u offsets, %u lengths, %d failures\n",
+           (unsigned)MODEL_OFFSET_MAX, (unsigned)MODEL_LENGTH_MAX, m_iFails);
+
+    return m_iFails;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
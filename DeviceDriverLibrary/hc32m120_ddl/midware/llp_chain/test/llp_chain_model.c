@@ -0,0 +1,538 @@
+/**
+ *******************************************************************************
+ * @file  llp_chain_model.c
+ * @brief Host model of the DMA for the LLP descriptor chain builder. The chains
+ *        built by llp_chain.c are run block by block as the DMA does and the
+ *        moved data is compared with the transfers.
+ @verbatim
+   Build and run on the host from the directory hc32m120_ddl, <cfg> is a
+   directory with a ddl_config.h which turns DDL_CLK_ENABLE, DDL_DMA_ENABLE
+   and MW_LLP_CHAIN_ENABLE on:
+     gcc -std=c99 -DUSE_DDL_DRIVER -DHC32M120 -I<cfg> -Imcu/common
+         -Imcu/GCC/CMSIS/Core/Include -Idriver/inc -Imidware/llp_chain/inc
+         midware/llp_chain/test/llp_chain_model.c midware/llp_chain/src/llp_chain.c
+         -o llp_chain_model
+     ./llp_chain_model
+   The exit code is the number of failed cases.
+
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "llp_chain.h"
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/* Address space of the model, the addresses of the transfers are offsets in it. */
+#define MODEL_MEM_SIZE                  (0x02000000ul)
+/* Each transfer reads its own source window and writes its own destination window. */
+#define MODEL_WIN_SIZE                  (0x00400000ul)
+#define MODEL_SRC_BASE                  (0x00100000ul)
+#define MODEL_DES_BASE                  (0x01000000ul)
+
+#define MODEL_POOL_SIZE                 (256u)
+#define MODEL_XFER_MAX                  (3u)
+#define MODEL_CHAIN_NUM                 (3000u)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Destination window of a transfer
+ */
+typedef struct
+{
+    uint32_t u32Lo;
+    uint32_t u32Size;
+} stc_model_win_t;
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint8_t *m_pu8Mem;
+static uint8_t *m_pu8Ref;
+static stc_dma_llp_descriptor_t m_astcPool[MODEL_POOL_SIZE];
+static stc_model_win_t m_astcWin[MODEL_XFER_MAX];
+static uint32_t m_u32WinNum;
+static uint32_t m_u32Seed = 1ul;
+static int m_iFails;
+
+static const uint32_t m_au32Width[3u] =
+{
+    DMA_DATAWIDTH_8BIT, DMA_DATAWIDTH_16BIT, DMA_DATAWIDTH_32BIT,
+};
+static const uint32_t m_au32SrcInc[3u] =
+{
+    DMA_SRCADDRINC_FIX, DMA_SRCADDRINC_INC, DMA_SRCADDRINC_DEC,
+};
+static const uint32_t m_au32DesInc[3u] =
+{
+    DMA_DESADDRINC_FIX, DMA_DESADDRINC_INC, DMA_DESADDRINC_DEC,
+};
+
+/*******************************************************************************
+ * Function implementation - local ('static')
+ ******************************************************************************/
+/* xorshift32, the same sequence on every host. */
+static uint32_t ModelRand(void)
+{
+    m_u32Seed ^= m_u32Seed << 13u;
+    m_u32Seed ^= m_u32Seed >> 17u;
+    m_u32Seed ^= m_u32Seed << 5u;
+    return m_u32Seed;
+}
+
+static void ModelCheck(int iCond, const char *pcMsg, uint32_t u32Case)
+{
+    if (!iCond)
+    {
+        printf("FAIL case %u: %s\n", (unsigned)u32Case, pcMsg);
+        m_iFails++;
+    }
+}
+
+/* Fill both memories with a pattern of the address. */
+static void ModelFill(uint32_t u32Addr, uint32_t u32Size)
+{
+    uint32_t i;
+
+    for (i = u32Addr; i < (u32Addr + u32Size); i++)
+    {
+        m_pu8Mem[i] = (uint8_t)((i * 2654435761ul) >> 24u);
+        m_pu8Ref[i] = m_pu8Mem[i];
+    }
+}
+
+static uint32_t ModelStep(uint32_t u32Addr, uint32_t u32Inc, uint32_t u32Bytes)
+{
+    uint32_t u32Ret = u32Addr;
+
+    if (1ul == u32Inc)
+    {
+        u32Ret = u32Addr + u32Bytes;
+    }
+    else if (2ul == u32Inc)
+    {
+        u32Ret = u32Addr - u32Bytes;
+    }
+    else
+    {
+        /* rsvd */
+    }
+
+    return u32Ret;
+}
+
+/* Every write of the DMA must hit a destination window of the chain. */
+static int ModelInWin(uint32_t u32Addr, uint32_t u32Bytes)
+{
+    uint32_t i;
+    int iRet = 0;
+
+    for (i = 0ul; i < m_u32WinNum; i++)
+    {
+        if ((u32Addr >= m_astcWin[i].u32Lo) &&
+            ((u32Addr + u32Bytes) <= (m_astcWin[i].u32Lo + m_astcWin[i].u32Size)))
+        {
+            iRet = 1;
+        }
+    }
+
+    return iRet;
+}
+
+static int ModelFindDesc(uint32_t u32Field)
+{
+    int i;
+    int iRet = -1;
+
+    for (i = 0; i < (int)MODEL_POOL_SIZE; i++)
+    {
+        if ((((uint32_t)(uintptr_t)&m_astcPool[i]) & 0x00000FFCul) == u32Field)
+        {
+            iRet = i;
+        }
+    }
+
+    return iRet;
+}
+
+/**
+ * @brief  Run the chain as the DMA does: each request moves a block, TC is set
+ *         when the count is 0 and the linked descriptor is loaded then. A loop
+ *         is run once.
+ * @retval Descriptors run, or a negative value for an error of the chain.
+ */
+static int ModelRun(const stc_llp_chain_t *pstcChain)
+{
+    stc_dma_ch_cfg_t stcCfg;
+    const stc_dma_llp_descriptor_t *pstcLlp;
+    const stc_dma_llp_descriptor_t *pstcDesc;
+    uint32_t u32Sar;
+    uint32_t u32Dar;
+    uint32_t u32Blk;
+    uint32_t u32Cnt;
+    uint32_t u32Bytes;
+    uint32_t u32Sinc;
+    uint32_t u32Dinc;
+    uint32_t u32Ctl0;
+    uint32_t k;
+    int iDesc;
+    int iLoads = 1;
+
+    if (Ok != LLP_CHAIN_GetChCfg(pstcChain, &stcCfg, &pstcLlp))
+    {
+        return -1;
+    }
+    u32Sar   = stcCfg.u32SrcAddr;
+    u32Dar   = stcCfg.u32DesAddr;
+    u32Blk   = stcCfg.u32BlockSize;
+    u32Cnt   = stcCfg.u32TransferCnt;
+    u32Bytes = 1ul << (stcCfg.u32DataWidth >> DMA_CH0CTL0_HSIZE_POS);
+    u32Sinc  = stcCfg.u32SrcInc >> DMA_CH0CTL1_SINC_POS;
+    u32Dinc  = stcCfg.u32DesInc >> DMA_CH0CTL1_DINC_POS;
+    u32Ctl0  = pstcChain->pstcPool[0u].CHxCTL0;
+
+    if ((NULL != pstcLlp) != (0ul != (u32Ctl0 & DMA_LLP_ENABLE)))
+    {
+        return -2;
+    }
+    if ((NULL != pstcLlp) && (pstcChain->u16Num > 1u) && (pstcLlp != &pstcChain->pstcPool[1u]))
+    {
+        return -2;
+    }
+
+    for (;;)
+    {
+        if ((0ul == u32Blk) || (0ul == u32Cnt) ||
+            (u32Blk > LLP_CHAIN_BLKSIZE_MAX) || (u32Cnt > LLP_CHAIN_CNT_MAX))
+        {
+            return -3;
+        }
+
+        for (; 0ul != u32Cnt; u32Cnt--)
+        {
+            for (k = 0ul; k < u32Blk; k++)
+            {
+                if (!ModelInWin(u32Dar, u32Bytes))
+                {
+                    return -5;
+                }
+                memcpy(&m_pu8Mem[u32Dar], &m_pu8Mem[u32Sar], u32Bytes);
+                u32Sar = ModelStep(u32Sar, u32Sinc, u32Bytes);
+                u32Dar = ModelStep(u32Dar, u32Dinc, u32Bytes);
+            }
+        }
+
+        if ((0ul == (u32Ctl0 & DMA_LLP_ENABLE)) || (iLoads >= (int)pstcChain->u16Num))
+        {
+            break;
+        }
+        if ((u32Ctl0 & DMA_CH0CTL0_LLPRUN) != pstcChain->u32LlpRun)
+        {
+            return -6;
+        }
+
+        iDesc = ModelFindDesc(((u32Ctl0 & DMA_CH0CTL0_LLP) >> DMA_CH0CTL0_LLP_POS) << 2u);
+        if (iDesc < 0)
+        {
+            return -4;
+        }
+        pstcDesc = &m_astcPool[iDesc];
+        u32Ctl0  = pstcDesc->CHxCTL0;
+        u32Sar   = pstcDesc->SARx;
+        u32Dar   = pstcDesc->DARx;
+        u32Blk   = u32Ctl0 & DMA_CH0CTL0_BLKSIZE;
+        u32Cnt   = (u32Ctl0 & DMA_CH0CTL0_CNT) >> DMA_CH0CTL0_CNT_POS;
+        u32Bytes = 1ul << ((u32Ctl0 & DMA_CH0CTL0_HSIZE) >> DMA_CH0CTL0_HSIZE_POS);
+        u32Sinc  = (pstcDesc->CHxCTL1 & DMA_CH0CTL1_SINC) >> DMA_CH0CTL1_SINC_POS;
+        u32Dinc  = (pstcDesc->CHxCTL1 & DMA_CH0CTL1_DINC) >> DMA_CH0CTL1_DINC_POS;
+        iLoads++;
+    }
+
+    return iLoads;
+}
+
+/* A chain of 1 ~ MODEL_XFER_MAX random transfers. */
+static void ModelChain(uint32_t u32Case)
+{
+    stc_llp_chain_t stcChain;
+    stc_llp_chain_xfer_t stcXfer;
+    en_result_t enRet;
+    uint32_t x;
+    uint32_t i;
+    uint32_t u32XferNum;
+    uint32_t u32Wi;
+    uint32_t u32Bytes;
+    uint32_t u32Len;
+    uint32_t u32Blk;
+    uint32_t u32S;
+    uint32_t u32D;
+    uint32_t u32Need;
+    uint32_t u32SrcBase;
+    uint32_t u32DesBase;
+    uint32_t u32Sa;
+    uint32_t u32Da;
+    uint16_t u16Before;
+    int iFull = 0;
+    int iRun;
+    const int iLoop = (0ul == (u32Case % 7ul));
+
+    (void)memset(m_astcPool, 0, sizeof(m_astcPool));
+    (void)LLP_CHAIN_Init(&stcChain, m_astcPool, MODEL_POOL_SIZE,
+                         (0ul != (u32Case & 1ul)) ? DMA_LLP_RUN : DMA_LLP_WAIT);
+
+    m_u32WinNum = 0ul;
+    u32XferNum = 1ul + (ModelRand() % MODEL_XFER_MAX);
+    for (x = 0ul; (x < u32XferNum) && (0 == iFull); x++)
+    {
+        u32Wi    = ModelRand() % 3ul;
+        u32Bytes = 1ul << u32Wi;
+        /* Now and then a transfer of several descriptors, at most 3 full ones. */
+        if (0ul == (ModelRand() % 4ul))
+        {
+            u32Len = 1ul + (ModelRand() % ((3ul * LLP_CHAIN_XFER_MAX) / u32XferNum));
+        }
+        else
+        {
+            u32Len = 1ul + (ModelRand() % 2000ul);
+        }
+        u32Blk = (0ul != (ModelRand() % 2ul)) ? 0ul : (1ul + (ModelRand() % LLP_CHAIN_BLKSIZE_MAX));
+        if (0ul != u32Blk)
+        {
+            u32Len = ((u32Len >= u32Blk) ? (u32Len / u32Blk) : 1ul) * u32Blk;
+        }
+        u32S = ModelRand() % 3ul;
+        u32D = ModelRand() % 3ul;
+
+        u32SrcBase = MODEL_SRC_BASE + (x * MODEL_WIN_SIZE);
+        u32DesBase = MODEL_DES_BASE + (x * MODEL_WIN_SIZE);
+        stcXfer.u32Len       = u32Len;
+        stcXfer.u32DataWidth = m_au32Width[u32Wi];
+        stcXfer.u32BlockSize = u32Blk;
+        stcXfer.u32SrcInc    = m_au32SrcInc[u32S];
+        stcXfer.u32DesInc    = m_au32DesInc[u32D];
+        stcXfer.u32SrcAddr   = (2ul == u32S) ? (u32SrcBase + ((u32Len - 1ul) * u32Bytes)) : u32SrcBase;
+        stcXfer.u32DesAddr   = (2ul == u32D) ? (u32DesBase + ((u32Len - 1ul) * u32Bytes)) : u32DesBase;
+
+        u32Need   = LLP_CHAIN_DESC_NUM(u32Len, u32Blk);
+        u16Before = stcChain.u16Num;
+        enRet     = LLP_CHAIN_Add(&stcChain, &stcXfer);
+        if (((uint32_t)u16Before + u32Need) > MODEL_POOL_SIZE)
+        {
+            ModelCheck(ErrorBufferFull == enRet, "pool full", u32Case);
+            ModelCheck(ErrorBufferFull == LLP_CHAIN_Load(&stcChain, DMA_CHANNEL_0, EVT_AOS_STRG),
+                       "first error kept", u32Case);
+            iFull = 1;
+        }
+        else
+        {
+            ModelCheck(Ok == enRet, "add", u32Case);
+            ModelCheck(((uint32_t)stcChain.u16Num - u16Before) == u32Need,
+                       "descriptors of LLP_CHAIN_DESC_NUM()", u32Case);
+
+            m_astcWin[m_u32WinNum].u32Lo   = u32DesBase;
+            m_astcWin[m_u32WinNum].u32Size = (0ul == u32D) ? u32Bytes : (u32Len * u32Bytes);
+            m_u32WinNum++;
+
+            /* The expected data, element by element. */
+            for (i = 0ul; i < u32Len; i++)
+            {
+                u32Sa = (0ul == u32S) ? stcXfer.u32SrcAddr :
+                        ((1ul == u32S) ? (stcXfer.u32SrcAddr + (i * u32Bytes)) : (stcXfer.u32SrcAddr - (i * u32Bytes)));
+                u32Da = (0ul == u32D) ? stcXfer.u32DesAddr :
+                        ((1ul == u32D) ? (stcXfer.u32DesAddr + (i * u32Bytes)) : (stcXfer.u32DesAddr - (i * u32Bytes)));
+                memcpy(&m_pu8Ref[u32Da], &m_pu8Ref[u32Sa], u32Bytes);
+            }
+        }
+    }
+
+    if (0 == iFull)
+    {
+        if (iLoop)
+        {
+            ModelCheck(Ok == LLP_CHAIN_Loop(&stcChain), "loop", u32Case);
+        }
+
+        iRun = ModelRun(&stcChain);
+        ModelCheck(iRun == (int)stcChain.u16Num, "descriptors run", u32Case);
+        for (i = 0ul; i < m_u32WinNum; i++)
+        {
+            ModelCheck(0 == memcmp(&m_pu8Mem[m_astcWin[i].u32Lo], &m_pu8Ref[m_astcWin[i].u32Lo],
+                                   m_astcWin[i].u32Size), "data", u32Case);
+        }
+
+        if (iLoop)
+        {
+            ModelCheck((((m_astcPool[stcChain.u16Num - 1u].CHxCTL0 & DMA_CH0CTL0_LLP) >> DMA_CH0CTL0_LLP_POS) << 2u) ==
+                       (((uint32_t)(uintptr_t)&m_astcPool[0u]) & 0x00000FFCul), "loop link", u32Case);
+            stcXfer.u32Len       = 1ul;
+            stcXfer.u32DataWidth = DMA_DATAWIDTH_8BIT;
+            stcXfer.u32BlockSize = 0ul;
+            stcXfer.u32SrcInc    = DMA_SRCADDRINC_FIX;
+            stcXfer.u32DesInc    = DMA_DESADDRINC_FIX;
+            stcXfer.u32SrcAddr   = MODEL_SRC_BASE;
+            stcXfer.u32DesAddr   = MODEL_DES_BASE;
+            ModelCheck(ErrorInvalidMode == LLP_CHAIN_Add(&stcChain, &stcXfer), "add to a loop", u32Case);
+        }
+    }
+
+    /* Restore the destination windows for the next chain. */
+    for (i = 0ul; i < m_u32WinNum; i++)
+    {
+        ModelFill(m_astcWin[i].u32Lo, m_astcWin[i].u32Size);
+    }
+}
+
+/* The errors of the API, each call on its own so the order is defined. */
+static void ModelErrors(uint32_t u32Case)
+{
+    stc_llp_chain_t stcChain;
+    stc_llp_chain_xfer_t stcXfer;
+    en_result_t enRet;
+
+    stcXfer.u32SrcAddr   = MODEL_SRC_BASE + 1ul;
+    stcXfer.u32DesAddr   = MODEL_DES_BASE;
+    stcXfer.u32Len       = 8ul;
+    stcXfer.u32DataWidth = DMA_DATAWIDTH_16BIT;
+    stcXfer.u32SrcInc    = DMA_SRCADDRINC_INC;
+    stcXfer.u32DesInc    = DMA_DESADDRINC_INC;
+    stcXfer.u32BlockSize = 0ul;
+
+    (void)LLP_CHAIN_Init(&stcChain, m_astcPool, 4u, DMA_LLP_WAIT);
+    enRet = LLP_CHAIN_Add(&stcChain, &stcXfer);
+    ModelCheck(ErrorAddressAlignment == enRet, "unaligned address", u32Case);
+    enRet = LLP_CHAIN_Load(&stcChain, DMA_CHANNEL_0, EVT_AOS_STRG);
+    ModelCheck(ErrorAddressAlignment == enRet, "first error kept by load", u32Case);
+
+    (void)LLP_CHAIN_Init(&stcChain, m_astcPool, 4u, DMA_LLP_WAIT);
+    stcXfer.u32SrcAddr   = MODEL_SRC_BASE;
+    stcXfer.u32BlockSize = 3ul;
+    enRet = LLP_CHAIN_Add(&stcChain, &stcXfer);
+    ModelCheck(ErrorInvalidParameter == enRet, "length not a multiple of the block", u32Case);
+
+    (void)LLP_CHAIN_Init(&stcChain, m_astcPool, 4u, DMA_LLP_WAIT);
+    enRet = LLP_CHAIN_Loop(&stcChain);
+    ModelCheck(ErrorInvalidParameter == enRet, "loop of an empty chain", u32Case);
+
+    (void)LLP_CHAIN_Init(&stcChain, m_astcPool, 4u, DMA_LLP_WAIT);
+    stcXfer.u32BlockSize = 0ul;
+    enRet = LLP_CHAIN_Add(&stcChain, &stcXfer);
+    ModelCheck(Ok == enRet, "add", u32Case);
+    enRet = LLP_CHAIN_Load(&stcChain, 2u, EVT_AOS_STRG);
+    ModelCheck(ErrorInvalidParameter == enRet, "invalid channel", u32Case);
+}
+
+int main(void)
+{
+    uint32_t u32Case;
+
+    m_pu8Mem = malloc(MODEL_MEM_SIZE);
+    m_pu8Ref = malloc(MODEL_MEM_SIZE);
+    if ((NULL == m_pu8Mem) || (NULL == m_pu8Ref))
+    {
+        return 1;
+    }
+    ModelFill(0ul, MODEL_MEM_SIZE);
+
+    for (u32Case = 0ul; u32Case < MODEL_CHAIN_NUM; u32Case++)
+    {
+        ModelChain(u32Case);
+    }
+    ModelErrors(u32Case);
+
+    printf("LLP_CHAIN model: %u chains, %d failures\n", (unsigned)MODEL_CHAIN_NUM, m_iFails);
+
+    free(m_pu8Mem);
+    free(m_pu8Ref);
+
+    return m_iFails;
+}
+
+/*******************************************************************************
+ * Stubs of the DMA driver functions called by llp_chain.c
+ ******************************************************************************/
+void CLK_FcgPeriphClockCmd(uint32_t u32Fcg, en_functional_state_t enNewState)
+{
+    (void)u32Fcg;
+    (void)enNewState;
+}
+
+void DMA_ChannelCfg(uint8_t u8Ch, const stc_dma_ch_cfg_t *pstcChCfg)
+{
+    (void)u8Ch;
+    (void)pstcChCfg;
+}
+
+void DMA_LlpInit(uint8_t u8Ch, uint32_t u32LlpRun, uint32_t u32Llp)
+{
+    (void)u8Ch;
+    (void)u32LlpRun;
+    (void)u32Llp;
+}
+
+void DMA_LlpCmd(uint8_t u8Ch, en_functional_state_t enNewState)
+{
+    (void)u8Ch;
+    (void)enNewState;
+}
+
+void DMA_SetTriggerSrc(uint8_t u8Ch, en_event_src_t enSrc)
+{
+    (void)u8Ch;
+    (void)enSrc;
+}
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
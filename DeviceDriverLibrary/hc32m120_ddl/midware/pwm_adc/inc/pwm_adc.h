@@ -0,0 +1,200 @@
+/**
+ *******************************************************************************
+ * @file  pwm_adc.h
+ * @brief This file contains all the functions prototypes of the PWM synchronous
+ *        ADC sampling midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __PWM_ADC_H__
+#define __PWM_ADC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_PWM_ADC
+ * @{
+ */
+
+#if (MW_PWM_ADC_ENABLE == DDL_ON)
+
+#if (DDL_ADC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_ADC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_TIMER4_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMER4_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/* Phases(OCO channels) updated together with the sample point. */
+#define PWM_ADC_OCO_CH_MAX              (3u)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_ADC_Global_Types PWM_ADC Global Types
+ * @{
+ */
+
+/**
+ * @brief Sample callback, called in the EOCB interrupt with the samples of the
+ *        sequence B channels in ascending order of the ADC pin.
+ */
+typedef void (*func_ptr_pwm_adc_cb_t)(const uint16_t *pu16Sample, uint8_t u8Num);
+
+/**
+ * @brief PWM synchronous ADC sampling handle structure definition
+ */
+typedef struct
+{
+    uint32_t u32SevtCh;                 /*!< Timer4 SEVT channel.
+                                             This parameter can be a value of @ref TIMER4_SEVT_Channel */
+    uint16_t u16SevtEvt;                /*!< Event output by the SEVT channel, it triggers sequence B.
+                                             This parameter can be a value of @ref TIMER4_SEVT_Trigger_Event */
+    uint16_t u16BufMode;                /*!< SCCR buffer transfer, set the same as the OCCR buffer mode of the PWM.
+                                             This parameter can be a value of @ref TIMER4_SEVT_Buffer_Mode */
+    uint8_t  u8SamplePoint;             /*!< Sample around the peak or the valley of the counter.
+                                             This parameter can be a value of @ref PWM_ADC_Sample_Point */
+    uint16_t u16SampleOffset;           /*!< Counts after the peak or the valley, at least the dead time
+                                             plus the settling time of the current. */
+    uint16_t u16AdcChannel;             /*!< Channels of sequence B, e.g. the phase currents.
+                                             This parameter can be values of @ref ADC_Channels */
+    IRQn_Type enAdcIRQn;                /*!< IRQ number of the EOCB interrupt. */
+    uint32_t au32OcoCh[PWM_ADC_OCO_CH_MAX]; /*!< OCO channels(TIMER4_OCO_xH) of the phases updated by PWM_ADC_Update(). */
+    uint8_t  u8OcoChNum;                /*!< Number of valid channels in au32OcoCh. */
+    func_ptr_pwm_adc_cb_t pfnSampleCb;  /*!< Sample callback. */
+
+    /* Internal state, set by PWM_ADC_Init() */
+    uint16_t au16Sample[ADC_CH_COUNT];  /*!< Samples of the last conversion. */
+    stc_adc_read_plan_t stcReadPlan;    /*!< Data registers of sequence B. */
+} stc_pwm_adc_handle_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_ADC_Global_Macros PWM_ADC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup PWM_ADC_Sample_Point PWM_ADC Sample Point
+ * @brief The counter of Timer4 runs in triangular wave mode.
+ * @{
+ */
+#define PWM_ADC_SAMPLE_VALLEY           ((uint8_t)0u)   /*!< Count up from 0 to the offset, center of the low side on time. */
+#define PWM_ADC_SAMPLE_PEAK             ((uint8_t)1u)   /*!< Count down from CPSR by the offset, center of the high side on time. */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup PWM_ADC_Global_Functions
+ * @{
+ */
+en_result_t PWM_ADC_Init(stc_pwm_adc_handle_t *pstcHandle);
+en_result_t PWM_ADC_Cmd(const stc_pwm_adc_handle_t *pstcHandle, en_functional_state_t enNewState);
+en_result_t PWM_ADC_SetSampleOffset(stc_pwm_adc_handle_t *pstcHandle, uint16_t u16Offset);
+en_result_t PWM_ADC_Update(stc_pwm_adc_handle_t *pstcHandle,
+                           const uint16_t *pu16OccrVal,
+                           uint16_t u16Offset);
+/**
+ * @}
+ */
+
+#endif /* MW_PWM_ADC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PWM_ADC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,361 @@
+/**
+ *******************************************************************************
+ * @file  pwm_adc.c
+ * @brief This midware file provides firmware functions to sample the motor
+ *        currents synchronously with the Timer4 PWM.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "pwm_adc.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_PWM_ADC PWM_ADC
+ * @brief PWM Synchronous ADC Sampling Midware Library
+ * @{
+ */
+
+#if (MW_PWM_ADC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_ADC_Local_Macros PWM_ADC Local Macros
+ * @{
+ */
+
+/* Event number of the SEVT trigger event, EVT_TMR4_SCMUH ~ EVT_TMR4_SCMWL. */
+#define PWM_ADC_SEVT_EVENT(evt)                                                \
+    ((en_event_src_t)((uint32_t)EVT_TMR4_SCMUH + ((uint32_t)(evt) >> TMR4_SCSR_EVTOS_POS)))
+
+#define IS_PWM_ADC_SAMPLE_POINT(x)                                             \
+(   ((x) == PWM_ADC_SAMPLE_VALLEY)              ||                             \
+    ((x) == PWM_ADC_SAMPLE_PEAK))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint16_t PwmAdcCalcSccr(const stc_pwm_adc_handle_t *pstcHandle, uint16_t u16Offset);
+static void PwmAdcEocbIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_pwm_adc_handle_t *m_pstcPwmAdcHandle = NULL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_ADC_Global_Functions PWM_ADC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the PWM synchronous sampling.
+ * @note   1. The counter of Timer4 must be configured in mode TIMER4_CNT_MODE_TRIANGLE_WAVE
+ *            and its cycle value(CPSR) must be set before, the OCO/PWM channels and the
+ *            counter are configured and started by the application.
+ *         2. ADC must be initialized by ADC_Init() in mode ADC_MODE_SA_SB_SINGLE or
+ *            ADC_MODE_SA_CONTINUOUS_SB_SINGLE before, sequence B is used here so that
+ *            the PWM synchronous sampling has the priority over sequence A.
+ *         3. The clocks of Timer4, ADC and AOS are enabled by the application.
+ *         4. The handle is used by the EOCB interrupt, it must be kept valid.
+ *         5. The trigger is disabled after initialization, call PWM_ADC_Cmd() to start.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_pwm_adc_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, or no sequence B channel, or
+ *                                    the number of OCO channels is invalid
+ */
+en_result_t PWM_ADC_Init(stc_pwm_adc_handle_t *pstcHandle)
+{
+    stc_timer4_sevt_init_t stcSevtInit;
+    stc_adc_trg_cfg_t stcTrgCfg;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) &&
+        (0u != (pstcHandle->u16AdcChannel & ADC_CH_ALL)) &&
+        (pstcHandle->u8OcoChNum <= PWM_ADC_OCO_CH_MAX))
+    {
+        DDL_ASSERT(IS_PWM_ADC_SAMPLE_POINT(pstcHandle->u8SamplePoint));
+
+        m_pstcPwmAdcHandle = pstcHandle;
+
+        /* The interrupt reads the data registers without scanning the channel bits. */
+        (void)ADC_ReadPlanInit(&pstcHandle->stcReadPlan, pstcHandle->u16AdcChannel);
+
+        /* SEVT compares SCCR with the counter in one direction only: counting down
+           after the peak, or counting up after the valley. */
+        stcSevtInit.u16SccrVal = PwmAdcCalcSccr(pstcHandle, pstcHandle->u16SampleOffset);
+        stcSevtInit.u16Mode    = TIMER4_SEVT_MODE_COMPARE_TRIGGER;
+        stcSevtInit.u16TrigEvt = pstcHandle->u16SevtEvt;
+        stcSevtInit.u16BufMode = pstcHandle->u16BufMode;
+        stcSevtInit.enLinkTransfer = Disable;
+        stcSevtInit.stcTriggerCond.enDownMatchCmd = \
+            (PWM_ADC_SAMPLE_PEAK == pstcHandle->u8SamplePoint) ? Enable : Disable;
+        stcSevtInit.stcTriggerCond.enPeakMatchCmd = Disable;
+        stcSevtInit.stcTriggerCond.enUpMatchCmd = \
+            (PWM_ADC_SAMPLE_VALLEY == pstcHandle->u8SamplePoint) ? Enable : Disable;
+        stcSevtInit.stcTriggerCond.enZeroMatchCmd = Disable;
+        stcSevtInit.stcTriggerCond.enCmpAmcZicCmd = Disable;
+        stcSevtInit.stcTriggerCond.enCmpAmcPicCmd = Disable;
+        stcSevtInit.stcTriggerCond.u16MaskTimes = TIMER4_SEVT_MASK_0;
+        enRet = TIMER4_SEVT_Init(pstcHandle->u32SevtCh, &stcSevtInit);
+
+        if (Ok == enRet)
+        {
+            /* Sequence B channels and the SEVT trigger. */
+            ADC_TriggerSrcCmd(ADC_SEQ_B, Disable);
+            ADC_AddAdcChannel(ADC_SEQ_B, pstcHandle->u16AdcChannel);
+            ADC_TriggerSrcStructInit(&stcTrgCfg);
+            stcTrgCfg.u16TrgSrc = ADC_TRGSRC_IN_EVT0;
+            stcTrgCfg.enEvent0  = PWM_ADC_SEVT_EVENT(pstcHandle->u16SevtEvt);
+            ADC_ConfigTriggerSrc(ADC_SEQ_B, &stcTrgCfg);
+
+            /* Register EOCB IRQ handler && configure NVIC. */
+            stcIrqRegiConf.enIRQn = pstcHandle->enAdcIRQn;
+            stcIrqRegiConf.enIntSrc = INT_ADC_EOCB;
+            stcIrqRegiConf.pfnCallback = &PwmAdcEocbIrqCallback;
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+            ADC_ClrEocFlag(ADC_FLAG_EOCB);
+            ADC_AdcIntCmd(ADC_SEQ_B, Enable);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Enable or disable the PWM synchronous trigger of sequence B.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_pwm_adc_handle_t structure
+ * @param  [in] enNewState              An en_functional_state_t enumeration type value.
+ *   @arg Enable:                       Enable the trigger.
+ *   @arg Disable:                      Disable the trigger.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t PWM_ADC_Cmd(const stc_pwm_adc_handle_t *pstcHandle, en_functional_state_t enNewState)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+        ADC_TriggerSrcCmd(ADC_SEQ_B, enNewState);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Move the sample point, e.g. when the dead time is changed.
+ * @note   SCCR is buffered if u16BufMode is not TIMER4_SEVT_BUF_DISABLE, the new sample
+ *         point takes effect at the next buffer transfer event.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_pwm_adc_handle_t structure
+ * @param  [in] u16Offset               Counts after the peak or the valley.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t PWM_ADC_SetSampleOffset(stc_pwm_adc_handle_t *pstcHandle, uint16_t u16Offset)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        pstcHandle->u16SampleOffset = u16Offset;
+        enRet = TIMER4_SEVT_SetSccrVal(pstcHandle->u32SevtCh,
+                                       PwmAdcCalcSccr(pstcHandle, u16Offset));
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Update the duty of the phases and the sample point in the same PWM cycle.
+ * @note   1. OCCR of the phases and SCCR must be buffered with the same transfer event
+ *            (the OCCR buffer mode is set by TIMER4_OCO_SetOccrBufMode()), then the new
+ *            duty and the new sample point are transferred together and the sample is
+ *            never taken at an edge of the new duty.
+ *         2. Call it right after the sample callback of the current cycle, e.g. at the end
+ *            of the control loop in the callback, and before the next transfer event.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_pwm_adc_handle_t structure
+ * @param  [in] pu16OccrVal             Compare values, one for each channel in au32OcoCh.
+ * @param  [in] u16Offset               Counts after the peak or the valley.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or pu16OccrVal == NULL
+ */
+en_result_t PWM_ADC_Update(stc_pwm_adc_handle_t *pstcHandle,
+                           const uint16_t *pu16OccrVal,
+                           uint16_t u16Offset)
+{
+    uint8_t i;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (NULL != pu16OccrVal))
+    {
+        for (i = 0u; i < pstcHandle->u8OcoChNum; i++)
+        {
+            TIMER4_OCO_SetOccrVal(pstcHandle->au32OcoCh[i], pu16OccrVal[i]);
+        }
+
+        pstcHandle->u16SampleOffset = u16Offset;
+        enRet = TIMER4_SEVT_SetSccrVal(pstcHandle->u32SevtCh,
+                                       PwmAdcCalcSccr(pstcHandle, u16Offset));
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_ADC_Local_Functions PWM_ADC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Calculate SCCR of the sample point.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_pwm_adc_handle_t structure
+ * @param  [in] u16Offset               Counts after the peak or the valley.
+ * @retval SCCR value, limited in [1, CPSR - 1] so that the compare always matches.
+ */
+static uint16_t PwmAdcCalcSccr(const stc_pwm_adc_handle_t *pstcHandle, uint16_t u16Offset)
+{
+    uint16_t u16Sccr;
+    uint16_t u16Peak = TIMER4_CNT_GetCycleVal();
+
+    if (u16Offset >= u16Peak)
+    {
+        u16Offset = u16Peak - 1u;
+    }
+    if (0u == u16Offset)
+    {
+        u16Offset = 1u;
+    }
+
+    if (PWM_ADC_SAMPLE_PEAK == pstcHandle->u8SamplePoint)
+    {
+        u16Sccr = u16Peak - u16Offset;
+    }
+    else
+    {
+        u16Sccr = u16Offset;
+    }
+
+    return u16Sccr;
+}
+
+/**
+ * @brief  EOCB IRQ callback, sequence B is converted.
+ * @note   Only the data registers in the read plan are read, the latency from the end
+ *         of conversion to the sample callback is fixed by the number of channels.
+ * @param  None
+ * @retval None
+ */
+static void PwmAdcEocbIrqCallback(void)
+{
+    stc_pwm_adc_handle_t *pstcHandle = m_pstcPwmAdcHandle;
+
+    ADC_ReadPlanExec(&pstcHandle->stcReadPlan, pstcHandle->au16Sample);
+    ADC_ClrEocFlag(ADC_FLAG_EOCB);
+
+    if (NULL != pstcHandle->pfnSampleCb)
+    {
+        pstcHandle->pfnSampleCb(pstcHandle->au16Sample, pstcHandle->stcReadPlan.u8Num);
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_PWM_ADC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,242 @@
+/**
+ *******************************************************************************
+ * @file  pwm_calc.h
+ * @brief This file contains all the functions prototypes of the PWM register
+ *        calculation midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wangmin         First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __PWM_CALC_H__
+#define __PWM_CALC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_PWM_CALC
+ * @{
+ */
+
+#if (MW_PWM_CALC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_CALC_Global_Types PWM_CALC Global Types
+ * @{
+ */
+
+/**
+ * @brief PWM calculation request structure definition
+ */
+typedef struct
+{
+    uint8_t  u8Timer;                   /*!< Timer unit type.
+                                             This parameter can be a value of @ref PWM_CALC_Timer */
+    uint8_t  u8Wave;                    /*!< Count wave.
+                                             This parameter can be a value of @ref PWM_CALC_Wave */
+    uint32_t u32ClkFreq;                /*!< Clock before the divider in Hz, HCLK or PCLK for Timer4,
+                                             0: SystemCoreClock. */
+    uint32_t u32Freq;                   /*!< PWM frequency in Hz. */
+    uint32_t u32MinRes;                 /*!< Minimum duty steps per period, 0 or 1: any. */
+    uint32_t u32DeadNs;                 /*!< Dead time in ns, 0: none. */
+} stc_pwm_calc_cfg_t;
+
+/**
+ * @brief PWM calculation result structure definition
+ */
+typedef struct
+{
+    uint16_t u16ClkDiv;                 /*!< Value of the clock division field, TIMERA_CLKDIV_DIVx,
+                                             TIMERB_CLKDIV_DIVx, TIMER2_CLK_PRESCALER_x or TIMER4_CNT_CLK_DIVx. */
+    uint16_t u16Period;                 /*!< PERAR of TimerA/TimerB, CPSR of Timer4, CMPAR of Timer2. */
+    uint32_t u32Res;                    /*!< Duty steps per period. */
+    uint64_t u64FreqMilliHz;            /*!< Achieved frequency in mHz, above 4.29MHz does not fit 32 bits. */
+    int32_t  i32ErrPpm;                 /*!< (achieved - requested) / requested in ppm. */
+    uint16_t u16DeadCnt;                /*!< Dead time in counts of the counter clock, for Timer4 in counts of
+                                             the PWM clock (PDAR/PDBR). */
+    uint16_t u16DeadClkDiv;             /*!< TIMER4_PWM_CLK_DIVx of the dead time, 0 for the other timers. */
+    uint32_t u32DeadNs;                 /*!< Achieved dead time in ns. */
+} stc_pwm_calc_result_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_CALC_Global_Macros PWM_CALC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup PWM_CALC_Timer PWM_CALC Timer
+ * @{
+ */
+#define PWM_CALC_TIMER_A                ((uint8_t)0u)   /*!< TimerA, HCLK / 1 ~ 1024. */
+#define PWM_CALC_TIMER_B                ((uint8_t)1u)   /*!< TimerB, HCLK / 1 ~ 1024. */
+#define PWM_CALC_TIMER_2                ((uint8_t)2u)   /*!< Timer2, HCLK / 1 ~ 1024, output toggles at the match. */
+#define PWM_CALC_TIMER_4                ((uint8_t)3u)   /*!< Timer4, PCLK / 1 ~ 1024, dead time PCLK / 1 ~ 128. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_CALC_Wave PWM_CALC Wave
+ * @{
+ */
+#define PWM_CALC_WAVE_SAWTOOTH          ((uint8_t)0u)   /*!< Period = (period register + 1) counts. */
+#define PWM_CALC_WAVE_TRIANGLE          ((uint8_t)1u)   /*!< Period = 2 * period register counts, not for Timer2. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_CALC_Const_Calc PWM_CALC Build-time Calculation
+ * @brief    Integer constant expressions for fixed clocks, folded by the compiler.
+ *           The shift is the smallest division 2^shift that fits the period into
+ *           16 bits (the finest resolution), 11 when none does.
+ * @{
+ */
+#define PWM_CALC_FIT(clk, freq, s, cnt)                                        \
+(   (uint64_t)(clk) <= (((uint64_t)(freq) << (s)) * (uint64_t)(cnt)))
+
+#define PWM_CALC_SHIFT(clk, freq, cnt)                                         \
+(   PWM_CALC_FIT((clk), (freq), 0u, (cnt)) ? 0u :                              \
+    PWM_CALC_FIT((clk), (freq), 1u, (cnt)) ? 1u :                              \
+    PWM_CALC_FIT((clk), (freq), 2u, (cnt)) ? 2u :                              \
+    PWM_CALC_FIT((clk), (freq), 3u, (cnt)) ? 3u :                              \
+    PWM_CALC_FIT((clk), (freq), 4u, (cnt)) ? 4u :                              \
+    PWM_CALC_FIT((clk), (freq), 5u, (cnt)) ? 5u :                              \
+    PWM_CALC_FIT((clk), (freq), 6u, (cnt)) ? 6u :                              \
+    PWM_CALC_FIT((clk), (freq), 7u, (cnt)) ? 7u :                              \
+    PWM_CALC_FIT((clk), (freq), 8u, (cnt)) ? 8u :                              \
+    PWM_CALC_FIT((clk), (freq), 9u, (cnt)) ? 9u :                              \
+    PWM_CALC_FIT((clk), (freq), 10u, (cnt)) ? 10u : 11u)
+
+/* Counts per period rounded, and the counts per half period for the triangle wave and Timer2. */
+#define PWM_CALC_CNT(clk, freq, s)                                             \
+(   ((uint64_t)(clk) + (((uint64_t)(freq) << (s)) >> 1u)) / ((uint64_t)(freq) << (s)))
+#define PWM_CALC_HALF_CNT(clk, freq, s)                                        \
+(   ((uint64_t)(clk) + ((uint64_t)(freq) << (s))) / ((uint64_t)(freq) << ((s) + 1u)))
+
+#define PWM_CALC_SAW_SHIFT(clk, freq)       PWM_CALC_SHIFT((clk), (freq), 65536ul)
+#define PWM_CALC_SAW_PERIOD(clk, freq, s)   ((uint16_t)(PWM_CALC_CNT((clk), (freq), (s)) - 1u))
+#define PWM_CALC_TRI_SHIFT(clk, freq)       PWM_CALC_SHIFT((clk), (freq), 131070ul)
+#define PWM_CALC_TRI_PERIOD(clk, freq, s)   ((uint16_t)PWM_CALC_HALF_CNT((clk), (freq), (s)))
+#define PWM_CALC_TMR2_SHIFT(clk, freq)      PWM_CALC_SHIFT((clk), (freq), 131072ul)
+#define PWM_CALC_TMR2_CMP(clk, freq, s)     ((uint16_t)(PWM_CALC_HALF_CNT((clk), (freq), (s)) - 1u))
+
+/* Dead time in counts of clk / 2^s. */
+#define PWM_CALC_DEAD_CNT(clk, s, ns)                                          \
+(   (uint16_t)((((uint64_t)(ns) * (uint64_t)(clk)) + (500000000ull << (s))) / (1000000000ull << (s))))
+
+/* Clock division field from the shift. */
+#define PWM_CALC_TMRA_CLKDIV(s)         ((uint16_t)((uint32_t)(s) << TMRA_BCSTR_CKDIV_POS))
+#define PWM_CALC_TMRB_CLKDIV(s)         ((uint16_t)((uint32_t)(s) << TMRB_BCSTR_CKDIV_POS))
+#define PWM_CALC_TMR2_CLKDIV(s)         ((uint16_t)((uint32_t)(s) << TMR2_BCONR_CKDIVA_POS))
+#define PWM_CALC_TMR4_CLKDIV(s)         ((uint16_t)((uint32_t)(s) << TMR4_CCSR_CKDIV_POS))
+#define PWM_CALC_TMR4_PWM_CLKDIV(s)     ((uint16_t)((uint32_t)(s) << TMR4_POCR_DIVCK_POS))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup PWM_CALC_Global_Functions
+ * @{
+ */
+en_result_t PWM_CALC_Solve(const stc_pwm_calc_cfg_t *pstcCfg, stc_pwm_calc_result_t *pstcResult);
+/**
+ * @}
+ */
+
+#endif /* MW_PWM_CALC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PWM_CALC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,294 @@
+/**
+ *******************************************************************************
+ * @file  pwm_calc.c
+ * @brief This midware file provides firmware functions to calculate the clock
+ *        division, the period and the dead time registers of a PWM from its
+ *        frequency, resolution and dead time, in integer arithmetic.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wangmin         First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "pwm_calc.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_PWM_CALC PWM_CALC
+ * @brief PWM Register Calculation Midware Library
+ * @{
+ */
+
+#if (MW_PWM_CALC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_CALC_Local_Macros PWM_CALC Local Macros
+ * @{
+ */
+
+/* log2 of the largest counter division of all timers, and of the Timer4 dead time clock. */
+#define PWM_CALC_SHIFT_MAX              (10u)
+#define PWM_CALC_DEAD_SHIFT_MAX         (7u)
+
+/* Dead time in counts of clk / 2^s, not truncated to 16 bits. */
+#define PWM_CALC_DEAD_CNT64(clk, s, ns)                                        \
+(   (((uint64_t)(ns) * (uint64_t)(clk)) + (500000000ull << (s))) / (1000000000ull << (s)))
+
+#define IS_PWM_CALC_TIMER(x)                                                   \
+(   ((x) == PWM_CALC_TIMER_A)                   ||                             \
+    ((x) == PWM_CALC_TIMER_B)                   ||                             \
+    ((x) == PWM_CALC_TIMER_2)                   ||                             \
+    ((x) == PWM_CALC_TIMER_4))
+
+#define IS_PWM_CALC_WAVE(t, w)                                                 \
+(   ((w) == PWM_CALC_WAVE_SAWTOOTH)             ||                             \
+    (((w) == PWM_CALC_WAVE_TRIANGLE) && ((t) != PWM_CALC_TIMER_2)))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint16_t PwmCalcClkDiv(uint8_t u8Timer, uint32_t u32Shift);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWM_CALC_Global_Functions PWM_CALC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Calculate the registers of a PWM.
+ * @note   1. Every division 2^0 ~ 2^10 of the timer is tried, the one with the
+ *            smallest frequency error and at least u32MinRes duty steps is taken,
+ *            the smaller division on a tie. The dead time uses the clock of the
+ *            chosen division, for Timer4 the finest PWM clock that fits it.
+ *         2. Duty steps are the counts per period for the sawtooth wave and per half
+ *            period for the triangle wave. The Timer2 output toggles at each match,
+ *            its duty is 50% and its steps are the counts per half period.
+ *         3. Call it again after a clock change, it only uses integer arithmetic.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_pwm_calc_cfg_t structure
+ * @param  [out] pstcResult             Pointer to a @ref stc_pwm_calc_result_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Solved
+ *           - ErrorInvalidParameter: a pointer is NULL, the timer, the wave or the
+ *                                    frequency is invalid, no division meets the
+ *                                    frequency and the resolution, or the dead time
+ *                                    is not shorter than a duty step range
+ */
+en_result_t PWM_CALC_Solve(const stc_pwm_calc_cfg_t *pstcCfg, stc_pwm_calc_result_t *pstcResult)
+{
+    uint32_t s;
+    uint32_t u32Clk;
+    uint32_t u32Res;
+    uint32_t u32Reg;
+    uint32_t u32Cnt;
+    uint32_t u32BestShift = 0ul;
+    uint32_t u32BestCnt = 0ul;
+    uint64_t u64Den;
+    uint64_t u64Dead;
+    int64_t  i64Err;
+    int64_t  i64BestErr = 0;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCfg) && (NULL != pstcResult) && IS_PWM_CALC_TIMER(pstcCfg->u8Timer) &&
+        IS_PWM_CALC_WAVE(pstcCfg->u8Timer, pstcCfg->u8Wave) && (0ul != pstcCfg->u32Freq))
+    {
+        u32Clk = (0ul != pstcCfg->u32ClkFreq) ? pstcCfg->u32ClkFreq : SystemCoreClock;
+
+        for (s = 0ul; s <= PWM_CALC_SHIFT_MAX; s++)
+        {
+            u64Den = (uint64_t)pstcCfg->u32Freq << s;
+            if ((PWM_CALC_WAVE_SAWTOOTH == pstcCfg->u8Wave) && (PWM_CALC_TIMER_2 != pstcCfg->u8Timer))
+            {
+                /* Period = register + 1. */
+                u32Cnt = (uint32_t)(((uint64_t)u32Clk + (u64Den >> 1u)) / u64Den);
+                u32Res = u32Cnt;
+                u32Reg = u32Cnt - 1ul;
+            }
+            else
+            {
+                /* Half period = register for the triangle wave, register + 1 for Timer2. */
+                u32Res = (uint32_t)(((uint64_t)u32Clk + u64Den) / (u64Den << 1u));
+                u32Cnt = u32Res << 1u;
+                u32Reg = (PWM_CALC_TIMER_2 == pstcCfg->u8Timer) ? (u32Res - 1ul) : u32Res;
+            }
+
+            if ((u32Res >= 1ul) && (u32Res >= pstcCfg->u32MinRes) && (u32Reg <= 0xFFFFul) && (u32Cnt >= 2ul))
+            {
+                /* (f_clk / (2^s * cnt) - f) / f = (f_clk - f * 2^s * cnt) / (f * 2^s * cnt) */
+                i64Err = (((int64_t)u32Clk - (int64_t)(u64Den * u32Cnt)) * 1000000) /
+                         (int64_t)(u64Den * u32Cnt);
+                if ((Ok != enRet) || (((i64Err < 0) ? -i64Err : i64Err) < ((i64BestErr < 0) ? -i64BestErr : i64BestErr)))
+                {
+                    i64BestErr   = i64Err;
+                    u32BestShift = s;
+                    u32BestCnt   = u32Cnt;
+                    pstcResult->u16Period = (uint16_t)u32Reg;
+                    pstcResult->u32Res    = u32Res;
+                    enRet = Ok;
+                }
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcResult->u16ClkDiv = PwmCalcClkDiv(pstcCfg->u8Timer, u32BestShift);
+        u64Den = (uint64_t)u32BestCnt << u32BestShift;
+        pstcResult->u64FreqMilliHz = (((uint64_t)u32Clk * 1000ull) + (u64Den >> 1u)) / u64Den;
+        pstcResult->i32ErrPpm = (int32_t)i64BestErr;
+        pstcResult->u16DeadClkDiv = 0u;
+
+        /* Timer4 has its own dead time clock, the others count it with the counter. */
+        s = (PWM_CALC_TIMER_4 == pstcCfg->u8Timer) ? 0ul : u32BestShift;
+        u64Dead = PWM_CALC_DEAD_CNT64(u32Clk, s, pstcCfg->u32DeadNs);
+        if (PWM_CALC_TIMER_4 == pstcCfg->u8Timer)
+        {
+            while ((u64Dead > 0xFFFFull) && (s < PWM_CALC_DEAD_SHIFT_MAX))
+            {
+                s++;
+                u64Dead = PWM_CALC_DEAD_CNT64(u32Clk, s, pstcCfg->u32DeadNs);
+            }
+            pstcResult->u16DeadClkDiv = PWM_CALC_TMR4_PWM_CLKDIV(s);
+        }
+
+        /* Compare in clock cycles, the Timer4 dead time clock differs from the counter clock. */
+        if ((u64Dead > 0xFFFFull) ||
+            ((0ull != u64Dead) && ((u64Dead << s) >= ((uint64_t)pstcResult->u32Res << u32BestShift))))
+        {
+            enRet = ErrorInvalidParameter;
+        }
+        else
+        {
+            pstcResult->u16DeadCnt = (uint16_t)u64Dead;
+            pstcResult->u32DeadNs  = (uint32_t)(((u64Dead << s) * 1000000000ull + (u32Clk >> 1u)) / u32Clk);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWM_CALC_Local_Functions PWM_CALC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Clock division field of a timer from the shift.
+ * @param  [in] u8Timer                 Timer unit type.
+ * @param  [in] u32Shift                log2 of the division, 0 ~ 10.
+ * @retval Value of the clock division field.
+ */
+static uint16_t PwmCalcClkDiv(uint8_t u8Timer, uint32_t u32Shift)
+{
+    uint16_t u16Div;
+
+    switch (u8Timer)
+    {
+        case PWM_CALC_TIMER_A:
+            u16Div = PWM_CALC_TMRA_CLKDIV(u32Shift);
+            break;
+        case PWM_CALC_TIMER_B:
+            u16Div = PWM_CALC_TMRB_CLKDIV(u32Shift);
+            break;
+        case PWM_CALC_TIMER_2:
+            u16Div = PWM_CALC_TMR2_CLKDIV(u32Shift);
+            break;
+        default:
+            u16Div = PWM_CALC_TMR4_CLKDIV(u32Shift);
+            break;
+    }
+
+    return u16Div;
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_PWM_CALC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
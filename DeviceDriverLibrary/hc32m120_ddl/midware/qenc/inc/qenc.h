@@ -0,0 +1,233 @@
+/**
+ *******************************************************************************
+ * @file  qenc.h
+ * @brief This file contains all the functions prototypes of the quadrature
+ *        encoder midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __QENC_H__
+#define __QENC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_QENC
+ * @{
+ */
+
+#if (MW_QENC_ENABLE == DDL_ON)
+
+#if (DDL_TIMERA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_TIMERB_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERB_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_GPIO_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_GPIO_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup QENC_Global_Types QENC Global Types
+ * @{
+ */
+
+/**
+ * @brief Quadrature encoder configuration structure definition
+ * @note  1. TimerA counts the decoded edges of TIMA_<t>_CLKA(A) and TIMA_<t>_CLKB(B)
+ *           up and down in hardware, A leading B counts up. The application sets the
+ *           functions of the two pins, the clock of TimerA and the clock of TimerB.
+ *        2. For the velocity the TimerB unit timestamps the edges of A: the EIRQ
+ *           event of the A pin triggers the capture of the unit, without interrupt.
+ *           The A pin is initialized with PIN_EXINT_ON by the application, this
+ *           midware configures the EXINT channel and TMRB_HTSSR, which is shared by
+ *           all TimerB units.
+ */
+typedef struct
+{
+    uint8_t  u8Mode;                    /*!< Decoding.
+                                             This parameter can be a value of @ref QENC_Mode */
+    uint8_t  u8Dir;                     /*!< Counting direction.
+                                             This parameter can be a value of @ref QENC_Direction */
+    uint8_t  u8Filter;                  /*!< Noise filter of the A and B inputs.
+                                             This parameter can be a value of @ref QENC_Filter */
+    IRQn_Type enOvfIRQn;                /*!< IRQ number of INT_TMRA_OVF. */
+    IRQn_Type enUdfIRQn;                /*!< IRQ number of INT_TMRA_UDF. */
+    uint8_t  u8PortA;                   /*!< Port of the A pin. */
+    uint8_t  u8PinA;                    /*!< Pin of the A pin. */
+    uint8_t  u8PortB;                   /*!< Port of the B pin. */
+    uint8_t  u8PinB;                    /*!< Pin of the B pin. */
+
+    /* Velocity */
+    M0P_TMRB_TypeDef *TMRBx;            /*!< TimerB unit timestamping the edges of A, NULL: no velocity. */
+    uint16_t u16TmrbClkDiv;             /*!< Clock division of the unit, 65536 counts must be longer than
+                                             the period of QENC_UpdateVelocity().
+                                             This parameter can be a value of @ref TIMERB_Count_Clock_Division */
+    uint16_t u16ExIntCh;                /*!< EXINT channel of the A pin.
+                                             This parameter can be a value of @ref EXINT_Channel_Sel */
+    en_event_src_t enEdgeEvt;           /*!< EIRQ event of the A pin, EVT_PORT_EIRQx. */
+    uint16_t u16ZeroSpeedMs;            /*!< The velocity is 0 after this time without an edge of A, 0: never. */
+} stc_qenc_cfg_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup QENC_Global_Macros QENC Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup QENC_Mode QENC Mode
+ * @{
+ */
+#define QENC_MODE_X1                    ((uint8_t)0u)   /*!< One count per cycle, the edges of A with B low. */
+#define QENC_MODE_X2                    ((uint8_t)1u)   /*!< Two counts per cycle, the edges of A. */
+#define QENC_MODE_X4                    ((uint8_t)2u)   /*!< Four counts per cycle, the edges of A and B. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup QENC_Direction QENC Direction
+ * @{
+ */
+#define QENC_DIR_NORMAL                 ((uint8_t)0u)   /*!< A leading B counts up. */
+#define QENC_DIR_REVERSE                ((uint8_t)1u)   /*!< A leading B counts down. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup QENC_Filter QENC Filter
+ * @{
+ */
+#define QENC_FILTER_OFF                 ((uint8_t)0u)   /*!< No noise filter. */
+#define QENC_FILTER_HCLK_DIV1           ((uint8_t)1u)   /*!< Noise filter clocked by HCLK. */
+#define QENC_FILTER_HCLK_DIV4           ((uint8_t)2u)   /*!< Noise filter clocked by HCLK/4. */
+#define QENC_FILTER_HCLK_DIV16          ((uint8_t)3u)   /*!< Noise filter clocked by HCLK/16. */
+#define QENC_FILTER_HCLK_DIV64          ((uint8_t)4u)   /*!< Noise filter clocked by HCLK/64. */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup QENC_Global_Functions
+ * @{
+ */
+en_result_t QENC_Init(const stc_qenc_cfg_t *pstcCfg);
+void QENC_Cmd(en_functional_state_t enNewSta);
+int32_t QENC_GetPosition(void);
+void QENC_SetPosition(int32_t i32Pos);
+int32_t QENC_UpdateVelocity(void);
+int32_t QENC_GetVelocity(void);
+/**
+ * @}
+ */
+
+#endif /* MW_QENC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __QENC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
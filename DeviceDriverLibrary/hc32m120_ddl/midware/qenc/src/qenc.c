@@ -0,0 +1,600 @@
+/**
+ *******************************************************************************
+ * @file  qenc.c
+ * @brief This midware file provides firmware functions to manage the quadrature
+ *        encoder interface on TimerA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Yangjp          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "qenc.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_QENC QENC
+ * @brief Quadrature Encoder Midware Library
+ * @{
+ */
+
+#if (MW_QENC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup QENC_Local_Macros QENC Local Macros
+ * @{
+ */
+
+/* Count up conditions of A leading B, the count down conditions are the same
+   edges passed backwards. */
+#define QENC_X1_FORWARD                 (TIMERA_HWUP_CLKB_LOW_CLKA_RISING)
+#define QENC_X1_BACKWARD                (TIMERA_HWUP_CLKB_LOW_CLKA_FALLING)
+#define QENC_X2_FORWARD                 (TIMERA_HWUP_CLKB_LOW_CLKA_RISING   |          \
+                                         TIMERA_HWUP_CLKB_HIGH_CLKA_FALLING)
+#define QENC_X2_BACKWARD                (TIMERA_HWUP_CLKB_HIGH_CLKA_RISING  |          \
+                                         TIMERA_HWUP_CLKB_LOW_CLKA_FALLING)
+#define QENC_X4_FORWARD                 (QENC_X2_FORWARD                    |          \
+                                         TIMERA_HWUP_CLKA_HIGH_CLKB_RISING  |          \
+                                         TIMERA_HWUP_CLKA_LOW_CLKB_FALLING)
+#define QENC_X4_BACKWARD                (QENC_X2_BACKWARD                   |          \
+                                         TIMERA_HWUP_CLKA_LOW_CLKB_RISING   |          \
+                                         TIMERA_HWUP_CLKA_HIGH_CLKB_FALLING)
+
+/* TIMERA_HWDOWN_xxx is TIMERA_HWUP_xxx at the same bit of HCDOR. */
+#define QENC_HWDOWN(x)                  ((uint16_t)(x))
+
+#define IS_QENC_MODE(x)                                                        \
+(   ((x) == QENC_MODE_X1)                       ||                             \
+    ((x) == QENC_MODE_X2)                       ||                             \
+    ((x) == QENC_MODE_X4))
+
+#define IS_QENC_DIR(x)                                                         \
+(   ((x) == QENC_DIR_NORMAL)                    ||                             \
+    ((x) == QENC_DIR_REVERSE))
+
+#define IS_QENC_FILTER(x)               ((x) <= QENC_FILTER_HCLK_DIV64)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static int32_t QencEdgeLocation(int32_t i32Pos, int32_t i32Dir);
+static void QencVelocityReset(void);
+static void QencOvfIrqCallback(void);
+static void QencUdfIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* Bits 16 ~ 31 of the position, counted by the overflow and underflow interrupts. */
+static __IO int32_t m_i32QencHigh = 0;
+
+static uint8_t m_u8QencMode = QENC_MODE_X4;
+static uint8_t m_u8QencDir = QENC_DIR_NORMAL;
+static uint8_t m_u8QencPortA;
+static uint8_t m_u8QencPinA;
+static uint8_t m_u8QencPortB;
+static uint8_t m_u8QencPinB;
+
+/* Velocity state, see QENC_UpdateVelocity(). */
+static M0P_TMRB_TypeDef *m_pstcQencTmrb = NULL;
+static uint32_t m_u32QencTickFreq;
+static uint32_t m_u32QencZeroTicks;
+static int32_t  m_i32QencLastPos;
+static int32_t  m_i32QencLastEdge;
+static int32_t  m_i32QencMoveDir;
+static uint16_t m_u16QencLastTick;
+static uint16_t m_u16QencLastCap;
+static uint32_t m_u32QencSinceEdge;
+static uint8_t  m_u8QencEdgeValid;
+static int32_t  m_i32QencVelocity;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup QENC_Global_Functions QENC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the quadrature encoder interface, the position is 0.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_qenc_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcCfg == NULL, or the mode, the direction or
+ *                                    the filter is invalid
+ */
+en_result_t QENC_Init(const stc_qenc_cfg_t *pstcCfg)
+{
+    uint16_t u16Fwd;
+    uint16_t u16Bwd;
+    uint16_t u16FilterDiv;
+    stc_timera_init_t stcTmraInit;
+    stc_timerb_init_t stcTmrbInit;
+    stc_timerb_ic_init_t stcTmrbIcInit;
+    stc_exint_config_t stcExIntInit;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCfg) && IS_QENC_MODE(pstcCfg->u8Mode) &&
+        IS_QENC_DIR(pstcCfg->u8Dir) && IS_QENC_FILTER(pstcCfg->u8Filter))
+    {
+        m_u8QencMode  = pstcCfg->u8Mode;
+        m_u8QencDir   = pstcCfg->u8Dir;
+        m_u8QencPortA = pstcCfg->u8PortA;
+        m_u8QencPinA  = pstcCfg->u8PinA;
+        m_u8QencPortB = pstcCfg->u8PortB;
+        m_u8QencPinB  = pstcCfg->u8PinB;
+        m_i32QencHigh = 0;
+
+        if (QENC_MODE_X1 == m_u8QencMode)
+        {
+            u16Fwd = QENC_X1_FORWARD;
+            u16Bwd = QENC_X1_BACKWARD;
+        }
+        else if (QENC_MODE_X2 == m_u8QencMode)
+        {
+            u16Fwd = QENC_X2_FORWARD;
+            u16Bwd = QENC_X2_BACKWARD;
+        }
+        else
+        {
+            u16Fwd = QENC_X4_FORWARD;
+            u16Bwd = QENC_X4_BACKWARD;
+        }
+
+        (void)TIMERA_StructInit(&stcTmraInit);
+        stcTmraInit.u16PeriodVal = 0xFFFFu;
+        if (QENC_DIR_NORMAL == m_u8QencDir)
+        {
+            stcTmraInit.u16HwUpCondition   = u16Fwd;
+            stcTmraInit.u16HwDownCondition = QENC_HWDOWN(u16Bwd);
+        }
+        else
+        {
+            stcTmraInit.u16HwUpCondition   = u16Bwd;
+            stcTmraInit.u16HwDownCondition = QENC_HWDOWN(u16Fwd);
+        }
+        if (QENC_FILTER_OFF != pstcCfg->u8Filter)
+        {
+            u16FilterDiv = (uint16_t)pstcCfg->u8Filter - 1u;
+            stcTmraInit.u16ClkAFilterState  = TIMERA_CLKA_FILTER_ENABLE;
+            stcTmraInit.u16ClkAFilterClkDiv = (uint16_t)(u16FilterDiv << TMRA_FCONR_NOFICKCA_POS);
+            stcTmraInit.u16ClkBFilterState  = TIMERA_CLKB_FILTER_ENABLE;
+            stcTmraInit.u16ClkBFilterClkDiv = (uint16_t)(u16FilterDiv << TMRA_FCONR_NOFICKCB_POS);
+        }
+        enRet = TIMERA_Init(M0P_TMRA, &stcTmraInit);
+    }
+
+    if (Ok == enRet)
+    {
+        TIMERA_ClearFlag(M0P_TMRA, TIMERA_FLAG_OVF | TIMERA_FLAG_UDF);
+        TIMERA_IntCmd(M0P_TMRA, TIMERA_INT_OVF | TIMERA_INT_UDF, Enable);
+
+        /* Register overflow and underflow IRQ handler && configure NVIC. */
+        stcIrqRegiConf.enIRQn = pstcCfg->enOvfIRQn;
+        stcIrqRegiConf.enIntSrc = INT_TMRA_OVF;
+        stcIrqRegiConf.pfnCallback = &QencOvfIrqCallback;
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+        stcIrqRegiConf.enIRQn = pstcCfg->enUdfIRQn;
+        stcIrqRegiConf.enIntSrc = INT_TMRA_UDF;
+        stcIrqRegiConf.pfnCallback = &QencUdfIrqCallback;
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+        m_pstcQencTmrb = pstcCfg->TMRBx;
+        if (NULL != m_pstcQencTmrb)
+        {
+            m_u32QencTickFreq = SystemCoreClock >> ((uint32_t)pstcCfg->u16TmrbClkDiv >> TMRB_BCSTR_CKDIV_POS);
+            m_u32QencZeroTicks = (0u == pstcCfg->u16ZeroSpeedMs) ? 0xFFFFFFFFul :
+                                 ((m_u32QencTickFreq / 1000ul) * pstcCfg->u16ZeroSpeedMs);
+
+            /* Enable peripheral clock */
+            CLK_FcgPeriphClockCmd(CLK_FCG_AOS, Enable);
+
+            /* Both edges of A raise the EIRQ event, which captures the counter. */
+            stcExIntInit.u16ExIntCh  = pstcCfg->u16ExIntCh;
+            stcExIntInit.u8ExIntFE   = EXINT_FILTER_OFF;
+            stcExIntInit.u8ExIntFClk = EXINT_FCLK_HCLK_DIV1;
+            stcExIntInit.u8ExIntLvl  = EXINT_TRIGGER_BOTH;
+            (void)EXINT_Init(&stcExIntInit);
+
+            (void)TIMERB_StructInit(&stcTmrbInit);
+            stcTmrbInit.u16ClkDiv = pstcCfg->u16TmrbClkDiv;
+            (void)TIMERB_Init(m_pstcQencTmrb, &stcTmrbInit);
+            (void)TIMERB_IC_StructInit(&stcTmrbIcInit);
+            stcTmrbIcInit.u16CaptureCondition = TIMERB_IC_EVT;
+            (void)TIMERB_IC_Init(m_pstcQencTmrb, &stcTmrbIcInit);
+            TIMERB_SetTriggerSrc(pstcCfg->enEdgeEvt);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start or stop counting, the position is kept.
+ * @param  [in] enNewSta                An en_functional_state_t enumeration value.
+ *           @arg Enable:               Start counting.
+ *           @arg Disable:              Stop counting.
+ * @retval None
+ */
+void QENC_Cmd(en_functional_state_t enNewSta)
+{
+    TIMERA_Cmd(M0P_TMRA, enNewSta);
+    if (NULL != m_pstcQencTmrb)
+    {
+        if (Enable == enNewSta)
+        {
+            TIMERB_Start(m_pstcQencTmrb);
+        }
+        else
+        {
+            TIMERB_Stop(m_pstcQencTmrb);
+        }
+    }
+    QencVelocityReset();
+}
+
+/**
+ * @brief  Get the position.
+ * @note   The overflow or underflow pending with the read counter is taken into
+ *         account, as the interrupt will do.
+ * @param  None
+ * @retval The position in counts.
+ */
+int32_t QENC_GetPosition(void)
+{
+    uint32_t u32Primask;
+    uint16_t u16Cnt;
+    uint16_t u16Flag;
+    int32_t i32High;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    do
+    {
+        u16Flag = READ_REG16(M0P_TMRA->BCSTR) & (TIMERA_FLAG_OVF | TIMERA_FLAG_UDF);
+        u16Cnt = TIMERA_GetCounter(M0P_TMRA);
+    } while (u16Flag != (READ_REG16(M0P_TMRA->BCSTR) & (TIMERA_FLAG_OVF | TIMERA_FLAG_UDF)));
+    i32High = m_i32QencHigh;
+    __set_PRIMASK(u32Primask);
+
+    if (0u != (u16Flag & TIMERA_FLAG_OVF))
+    {
+        i32High++;
+    }
+    if (0u != (u16Flag & TIMERA_FLAG_UDF))
+    {
+        i32High--;
+    }
+
+    return (int32_t)(((uint32_t)i32High << 16u) | (uint32_t)u16Cnt);
+}
+
+/**
+ * @brief  Set the position, the velocity restarts from 0.
+ * @param  [in] i32Pos                  The position in counts.
+ * @retval None
+ */
+void QENC_SetPosition(int32_t i32Pos)
+{
+    uint32_t u32Primask;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    TIMERA_SetCounter(M0P_TMRA, (uint16_t)((uint32_t)i32Pos & 0xFFFFul));
+    TIMERA_ClearFlag(M0P_TMRA, TIMERA_FLAG_OVF | TIMERA_FLAG_UDF);
+    m_i32QencHigh = (int32_t)((uint32_t)i32Pos >> 16u);
+    if (i32Pos < 0)
+    {
+        m_i32QencHigh |= (int32_t)0xFFFF0000ul;
+    }
+    __set_PRIMASK(u32Primask);
+
+    QencVelocityReset();
+}
+
+/**
+ * @brief  Update the velocity, call it periodically.
+ * @note   1. The velocity is the distance between the last edges of A seen by two
+ *            updates over the time between them, from the TimerB timestamps: at high
+ *            speed this is the position difference over about one update period, at
+ *            low speed it is the period of A. Without a new edge of A the velocity
+ *            decays to the largest one which still has no edge, and becomes 0 after
+ *            u16ZeroSpeedMs.
+ *         2. The period of the call must be shorter than 65536 counts of TimerB.
+ * @param  None
+ * @retval The velocity in counts per second, Q8 (256 is 1 count/s), 0 if no TimerB.
+ */
+int32_t QENC_UpdateVelocity(void)
+{
+    uint16_t u16Cap;
+    uint16_t u16Tick;
+    uint32_t u32DeltaTick;
+    uint32_t u32EdgeToNow;
+    uint32_t u32Time;
+    int32_t i32Pos;
+    int32_t i32Edge;
+    int64_t i64Vel;
+
+    if (NULL != m_pstcQencTmrb)
+    {
+        /* A snapshot without an edge of A between the reads. */
+        do
+        {
+            u16Cap  = TIMERB_GetCompare(m_pstcQencTmrb);
+            i32Pos  = QENC_GetPosition();
+            i32Edge = QencEdgeLocation(i32Pos, (i32Pos > m_i32QencLastPos) ? 1 :
+                                               ((i32Pos < m_i32QencLastPos) ? -1 : m_i32QencMoveDir));
+            u16Tick = TIMERB_GetCounter(m_pstcQencTmrb);
+        } while (u16Cap != TIMERB_GetCompare(m_pstcQencTmrb));
+
+        if (i32Pos != m_i32QencLastPos)
+        {
+            m_i32QencMoveDir = (i32Pos > m_i32QencLastPos) ? 1 : -1;
+        }
+        u32DeltaTick = (uint16_t)(u16Tick - m_u16QencLastTick);
+
+        /* A new timestamp is a new edge of A. */
+        if (u16Cap != m_u16QencLastCap)
+        {
+            u32EdgeToNow = (uint16_t)(u16Tick - u16Cap);
+            if (0u != m_u8QencEdgeValid)
+            {
+                u32Time = m_u32QencSinceEdge + u32DeltaTick - u32EdgeToNow;
+                if (0ul != u32Time)
+                {
+                    /* The edge locations are in half counts. */
+                    i64Vel = ((int64_t)(i32Edge - m_i32QencLastEdge) * (int64_t)m_u32QencTickFreq * 128) /
+                             (int64_t)u32Time;
+                    if (i64Vel > (int64_t)INT32_MAX)
+                    {
+                        i64Vel = (int64_t)INT32_MAX;
+                    }
+                    else if (i64Vel < (int64_t)INT32_MIN)
+                    {
+                        i64Vel = (int64_t)INT32_MIN;
+                    }
+                    else
+                    {
+                        /* rsvd */
+                    }
+                    m_i32QencVelocity = (int32_t)i64Vel;
+                }
+            }
+            m_u32QencSinceEdge = u32EdgeToNow;
+            m_u8QencEdgeValid = 1u;
+            m_i32QencLastEdge = i32Edge;
+            m_u16QencLastCap = u16Cap;
+        }
+        else if (0u != m_u8QencEdgeValid)
+        {
+            m_u32QencSinceEdge += u32DeltaTick;
+            if ((m_u32QencSinceEdge >= m_u32QencZeroTicks) || (m_u32QencSinceEdge < u32DeltaTick))
+            {
+                m_u8QencEdgeValid = 0u;
+                m_i32QencVelocity = 0;
+            }
+            else
+            {
+                /* Edges of A are 1, 2 or 4 half counts apart in x1, x2 or x4. */
+                i64Vel = ((int64_t)(1ul << m_u8QencMode) * (int64_t)m_u32QencTickFreq * 128) /
+                         (int64_t)m_u32QencSinceEdge;
+                if ((int64_t)m_i32QencVelocity > i64Vel)
+                {
+                    m_i32QencVelocity = (int32_t)i64Vel;
+                }
+                else if ((int64_t)m_i32QencVelocity < -i64Vel)
+                {
+                    m_i32QencVelocity = (int32_t)(-i64Vel);
+                }
+                else
+                {
+                    /* rsvd */
+                }
+            }
+        }
+        else
+        {
+            /* rsvd */
+        }
+
+        m_u16QencLastTick = u16Tick;
+        m_i32QencLastPos = i32Pos;
+    }
+
+    return m_i32QencVelocity;
+}
+
+/**
+ * @brief  Get the velocity of the last QENC_UpdateVelocity().
+ * @param  None
+ * @retval The velocity in counts per second, Q8.
+ */
+int32_t QENC_GetVelocity(void)
+{
+    return m_i32QencVelocity;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup QENC_Local_Functions QENC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Location of the last edge of A, in half counts.
+ * @note   A counted edge lies half a count behind the position in the direction of
+ *         the motion. In x1 the edges of A with B high are not counted and lie at the
+ *         position, in x4 the last counted edge may be an edge of B, one count after
+ *         the last edge of A.
+ * @param  [in] i32Pos                  The position.
+ * @param  [in] i32Dir                  Direction of the last counts, 1 or -1.
+ * @retval The location of the last edge of A.
+ */
+static int32_t QencEdgeLocation(int32_t i32Pos, int32_t i32Dir)
+{
+    en_pin_state_t enA;
+    en_pin_state_t enB;
+    int32_t i32HwDir;
+    int32_t i32Loc = (i32Pos * 2) - i32Dir;
+
+    enA = GPIO_ReadInputPortPin(m_u8QencPortA, m_u8QencPinA);
+    enB = GPIO_ReadInputPortPin(m_u8QencPortB, m_u8QencPinB);
+    if (QENC_MODE_X1 == m_u8QencMode)
+    {
+        if (Pin_Set == enB)
+        {
+            i32Loc = i32Pos * 2;
+        }
+    }
+    else if (QENC_MODE_X4 == m_u8QencMode)
+    {
+        /* A leading B: A differs from B after an edge of A. A following B: A equals B. */
+        i32HwDir = (QENC_DIR_NORMAL == m_u8QencDir) ? i32Dir : -i32Dir;
+        if ((enA != enB) != (i32HwDir > 0))
+        {
+            i32Loc = (i32Pos * 2) - (i32Dir * 3);
+        }
+    }
+    else
+    {
+        /* rsvd */
+    }
+
+    return i32Loc;
+}
+
+/**
+ * @brief  Restart the velocity from 0 at the current position.
+ * @param  None
+ * @retval None
+ */
+static void QencVelocityReset(void)
+{
+    m_i32QencLastPos = QENC_GetPosition();
+    m_i32QencMoveDir = 1;
+    m_i32QencLastEdge = QencEdgeLocation(m_i32QencLastPos, m_i32QencMoveDir);
+    m_u8QencEdgeValid = 0u;
+    m_u32QencSinceEdge = 0ul;
+    m_i32QencVelocity = 0;
+    if (NULL != m_pstcQencTmrb)
+    {
+        m_u16QencLastTick = TIMERB_GetCounter(m_pstcQencTmrb);
+        m_u16QencLastCap = TIMERB_GetCompare(m_pstcQencTmrb);
+    }
+}
+
+/**
+ * @brief  TimerA overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void QencOvfIrqCallback(void)
+{
+    TIMERA_ClearFlag(M0P_TMRA, TIMERA_FLAG_OVF);
+    m_i32QencHigh++;
+}
+
+/**
+ * @brief  TimerA underflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void QencUdfIrqCallback(void)
+{
+    TIMERA_ClearFlag(M0P_TMRA, TIMERA_FLAG_UDF);
+    m_i32QencHigh--;
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_QENC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,204 @@
+/**
+ *******************************************************************************
+ * @file  soft_timer.h
+ * @brief This file contains all the functions prototypes of the software
+ *        timer wheel midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __SOFT_TIMER_H__
+#define __SOFT_TIMER_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_SOFT_TIMER
+ * @{
+ */
+
+#if (MW_SOFT_TIMER_ENABLE == DDL_ON)
+
+#if (DDL_TIMERB_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERB_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SOFT_TIMER_Global_Types SOFT_TIMER Global Types
+ * @{
+ */
+
+/**
+ * @brief Expiry callback.
+ */
+typedef void (*func_ptr_soft_timer_cb_t)(void *pvArg);
+
+/**
+ * @brief Software timer structure definition
+ * @note  The timer is allocated by the application, statically or in a structure
+ *        which lives as long as the timer runs.
+ */
+typedef struct stc_soft_timer
+{
+    func_ptr_soft_timer_cb_t pfnCb;     /*!< Expiry callback, not NULL. */
+    void     *pvArg;                    /*!< Argument of the callback. */
+    uint32_t u32Period;                 /*!< Reload ticks of a periodic timer, 0 for a one-shot timer. */
+    uint8_t  u8CbMode;                  /*!< Where the callback runs.
+                                             This parameter can be a value of @ref SOFT_TIMER_Callback_Mode */
+
+    /* Internal state, set by SOFT_TIMER_Start() */
+    uint8_t  u8State;                   /*!< Idle, in the wheel, or waiting for SOFT_TIMER_Process(). */
+    uint8_t  u8Level;                   /*!< Level of the wheel, or the far list. */
+    uint8_t  u8Slot;                    /*!< Slot in the level. */
+    uint32_t u32Expire;                 /*!< Expiry time in ticks. */
+    struct stc_soft_timer *pstcNext;    /*!< Next timer in the same list. */
+    struct stc_soft_timer *pstcPrev;    /*!< Previous timer in the same list. */
+} stc_soft_timer_t;
+
+/**
+ * @brief Software timer hardware configuration structure definition
+ * @note  The TimerB unit counts up freely, one count is one tick. The compare
+ *        register is set to the next expiry only, there is no periodic tick.
+ */
+typedef struct
+{
+    M0P_TMRB_TypeDef *TMRBx;            /*!< TimerB unit, M0P_TMRB1 ~ M0P_TMRB4. */
+    uint16_t  u16ClkDiv;                /*!< Tick = the clock division / HCLK.
+                                             This parameter can be a value of @ref TIMERB_Count_Clock_Division */
+    en_int_src_t enIntSrc;              /*!< Compare interrupt of the unit, INT_TMRB_x_CMP. */
+    IRQn_Type enIRQn;                   /*!< IRQ number of the compare interrupt. */
+} stc_soft_timer_cfg_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SOFT_TIMER_Global_Macros SOFT_TIMER Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup SOFT_TIMER_Callback_Mode SOFT_TIMER Callback Mode
+ * @{
+ */
+#define SOFT_TIMER_CB_ISR               ((uint8_t)0u)   /*!< The callback runs in the compare interrupt. */
+#define SOFT_TIMER_CB_DEFER             ((uint8_t)1u)   /*!< The callback runs in SOFT_TIMER_Process(). */
+/**
+ * @}
+ */
+
+/* The longest timeout in ticks. */
+#define SOFT_TIMER_TICKS_MAX            (0x7FFFFFFFul)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SOFT_TIMER_Global_Functions
+ * @{
+ */
+en_result_t SOFT_TIMER_Init(const stc_soft_timer_cfg_t *pstcCfg);
+en_result_t SOFT_TIMER_Start(stc_soft_timer_t *pstcTimer, uint32_t u32Ticks);
+en_result_t SOFT_TIMER_Stop(stc_soft_timer_t *pstcTimer);
+en_flag_status_t SOFT_TIMER_IsActive(const stc_soft_timer_t *pstcTimer);
+uint32_t SOFT_TIMER_GetTick(void);
+uint32_t SOFT_TIMER_Process(void);
+/**
+ * @}
+ */
+
+#endif /* MW_SOFT_TIMER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SOFT_TIMER_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
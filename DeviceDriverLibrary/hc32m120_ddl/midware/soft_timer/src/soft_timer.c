@@ -0,0 +1,775 @@
+/**
+ *******************************************************************************
+ * @file  soft_timer.c
+ * @brief This midware file provides firmware functions to manage the software
+ *        timers on a hierarchical timer wheel driven by one TimerB unit.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Wuze            First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "soft_timer.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_SOFT_TIMER SOFT_TIMER
+ * @brief Software Timer Wheel Midware Library
+ * @{
+ */
+
+#if (MW_SOFT_TIMER_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SOFT_TIMER_Local_Macros SOFT_TIMER Local Macros
+ * @{
+ */
+
+/* The wheel: 4 levels of 16 slots cover 2^16 ticks, a timer beyond them waits
+   in the far list, which is checked once every 2^16 ticks. */
+#define SOFT_TIMER_SLOT_BITS            (4u)
+#define SOFT_TIMER_SLOT_NUM             (1u << SOFT_TIMER_SLOT_BITS)
+#define SOFT_TIMER_SLOT_MASK            (SOFT_TIMER_SLOT_NUM - 1ul)
+#define SOFT_TIMER_LEVEL_NUM            (4u)
+#define SOFT_TIMER_LEVEL_FAR            (SOFT_TIMER_LEVEL_NUM)
+#define SOFT_TIMER_LEVEL_NONE           (0xFFu)
+#define SOFT_TIMER_WHEEL_MASK           ((1ul << (SOFT_TIMER_SLOT_BITS * SOFT_TIMER_LEVEL_NUM)) - 1ul)
+
+/* The compare is at most so far ahead that the 16 bits counter is extended
+   to the 32 bits tick without missing an overflow. */
+#define SOFT_TIMER_HW_DELTA_MAX         (0x8000ul)
+
+/* Timer state. */
+#define SOFT_TIMER_STATE_IDLE           ((uint8_t)0u)
+#define SOFT_TIMER_STATE_WHEEL          ((uint8_t)1u)
+#define SOFT_TIMER_STATE_DEFER          ((uint8_t)2u)
+
+/* The wheel is shared by the compare interrupt and the application. */
+#define SOFT_TIMER_ENTER_CRITICAL(primask)                                     \
+do {                                                                           \
+    (primask) = __get_PRIMASK();                                               \
+    __disable_irq();                                                           \
+} while (0)
+
+#define SOFT_TIMER_EXIT_CRITICAL(primask)       __set_PRIMASK(primask)
+
+#define IS_SOFT_TIMER_CB_MODE(x)                                               \
+(   ((x) == SOFT_TIMER_CB_ISR)                  ||                             \
+    ((x) == SOFT_TIMER_CB_DEFER))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t SoftTimerUpdateTick(void);
+static uint32_t SoftTimerLowestBit(uint32_t u32Map);
+static stc_soft_timer_t **SoftTimerListHead(const stc_soft_timer_t *pstcTimer);
+static void SoftTimerInsert(stc_soft_timer_t *pstcTimer);
+static void SoftTimerUnlink(stc_soft_timer_t *pstcTimer);
+static uint8_t SoftTimerNextEvent(uint32_t *pu32Time, uint8_t *pu8Slot);
+static en_flag_status_t SoftTimerProgram(void);
+static void SoftTimerRun(void);
+static void SoftTimerCmpIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static M0P_TMRB_TypeDef *m_pstcSoftTimerTmrb = NULL;
+static IRQn_Type m_enSoftTimerIRQn;
+
+/* 32 bits tick extended from the 16 bits counter. */
+static uint32_t m_u32Tick = 0ul;
+static uint16_t m_u16HwCnt = 0u;
+/* Tick of the current compare value. */
+static uint32_t m_u32HwTarget = 0ul;
+
+/* All the ticks before the wheel time are processed. */
+static uint32_t m_u32WheelTime = 0ul;
+static stc_soft_timer_t *m_apstcWheel[SOFT_TIMER_LEVEL_NUM][SOFT_TIMER_SLOT_NUM];
+static uint16_t m_au16SlotMap[SOFT_TIMER_LEVEL_NUM];
+static stc_soft_timer_t *m_pstcFar = NULL;
+
+/* Expired timers waiting for SOFT_TIMER_Process(), in order of expiry. */
+static stc_soft_timer_t *m_pstcDeferHead = NULL;
+static stc_soft_timer_t *m_pstcDeferTail = NULL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SOFT_TIMER_Global_Functions SOFT_TIMER Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the software timer service and start the TimerB unit.
+ * @note   1. The clock of the TimerB unit is enabled by the application.
+ *         2. The TimerB unit is used by the service only, it counts up freely and
+ *            the compare register is set to the next expiry. Without a timer the
+ *            compare interrupt occurs once every 0x8000 ticks to extend the tick.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_soft_timer_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcCfg == NULL or pstcCfg->TMRBx == NULL
+ */
+en_result_t SOFT_TIMER_Init(const stc_soft_timer_cfg_t *pstcCfg)
+{
+    uint32_t i;
+    uint32_t j;
+    stc_timerb_init_t stcTmrbInit;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCfg) && (NULL != pstcCfg->TMRBx))
+    {
+        m_pstcSoftTimerTmrb = pstcCfg->TMRBx;
+        m_enSoftTimerIRQn = pstcCfg->enIRQn;
+
+        for (i = 0ul; i < SOFT_TIMER_LEVEL_NUM; i++)
+        {
+            for (j = 0ul; j < SOFT_TIMER_SLOT_NUM; j++)
+            {
+                m_apstcWheel[i][j] = NULL;
+            }
+            m_au16SlotMap[i] = 0u;
+        }
+        m_pstcFar = NULL;
+        m_pstcDeferHead = NULL;
+        m_pstcDeferTail = NULL;
+        m_u32Tick = 0ul;
+        m_u16HwCnt = 0u;
+        m_u32WheelTime = 0ul;
+        m_u32HwTarget = 0ul;
+
+        TIMERB_StructInit(&stcTmrbInit);
+        stcTmrbInit.u16PeriodVal = 0xFFFFu;
+        stcTmrbInit.u16ClkDiv = pstcCfg->u16ClkDiv;
+        enRet = TIMERB_Init(m_pstcSoftTimerTmrb, &stcTmrbInit);
+        if (Ok == enRet)
+        {
+            TIMERB_ClearFlag(m_pstcSoftTimerTmrb, TIMERB_FLAG_CMP);
+            TIMERB_IntCmd(m_pstcSoftTimerTmrb, TIMERB_IT_CMP, Enable);
+
+            /* Register compare IRQ handler && configure NVIC. */
+            stcIrqRegiConf.enIRQn = pstcCfg->enIRQn;
+            stcIrqRegiConf.enIntSrc = pstcCfg->enIntSrc;
+            stcIrqRegiConf.pfnCallback = &SoftTimerCmpIrqCallback;
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+            (void)SoftTimerProgram();
+            TIMERB_Start(m_pstcSoftTimerTmrb);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start or restart a software timer.
+ * @note   pfnCb, pvArg, u32Period and u8CbMode of the timer are set before. A
+ *         running timer is restarted, a pending deferred callback is dropped.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_soft_timer_t structure
+ * @param  [in] u32Ticks                Ticks from now to the expiry, 0 ~ SOFT_TIMER_TICKS_MAX.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcTimer == NULL, pstcTimer->pfnCb == NULL or
+ *                                    u32Ticks > SOFT_TIMER_TICKS_MAX
+ */
+en_result_t SOFT_TIMER_Start(stc_soft_timer_t *pstcTimer, uint32_t u32Ticks)
+{
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcTimer) && (NULL != pstcTimer->pfnCb) && (u32Ticks <= SOFT_TIMER_TICKS_MAX))
+    {
+        DDL_ASSERT(IS_SOFT_TIMER_CB_MODE(pstcTimer->u8CbMode));
+
+        SOFT_TIMER_ENTER_CRITICAL(u32Primask);
+        if (SOFT_TIMER_STATE_IDLE != pstcTimer->u8State)
+        {
+            SoftTimerUnlink(pstcTimer);
+        }
+        pstcTimer->u32Expire = SoftTimerUpdateTick() + u32Ticks;
+        SoftTimerInsert(pstcTimer);
+
+        /* Only an expiry before the current compare moves the compare. */
+        if ((int32_t)(pstcTimer->u32Expire - m_u32HwTarget) < 0l)
+        {
+            if (Set == SoftTimerProgram())
+            {
+                NVIC_SetPendingIRQ(m_enSoftTimerIRQn);
+            }
+        }
+        SOFT_TIMER_EXIT_CRITICAL(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop a software timer.
+ * @note   The compare is not moved, the interrupt at the old expiry finds nothing to do.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_soft_timer_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcTimer == NULL
+ */
+en_result_t SOFT_TIMER_Stop(stc_soft_timer_t *pstcTimer)
+{
+    uint32_t u32Primask;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcTimer)
+    {
+        SOFT_TIMER_ENTER_CRITICAL(u32Primask);
+        if (SOFT_TIMER_STATE_IDLE != pstcTimer->u8State)
+        {
+            SoftTimerUnlink(pstcTimer);
+        }
+        SOFT_TIMER_EXIT_CRITICAL(u32Primask);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Check whether a software timer is running or its callback is pending.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_soft_timer_t structure
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The timer is running, or waiting for SOFT_TIMER_Process()
+ *           - Reset: The timer is idle
+ */
+en_flag_status_t SOFT_TIMER_IsActive(const stc_soft_timer_t *pstcTimer)
+{
+    en_flag_status_t enFlag = Reset;
+
+    if ((NULL != pstcTimer) && (SOFT_TIMER_STATE_IDLE != pstcTimer->u8State))
+    {
+        enFlag = Set;
+    }
+
+    return enFlag;
+}
+
+/**
+ * @brief  Get the current tick.
+ * @param  None
+ * @retval Ticks since SOFT_TIMER_Init(), wraps at 2^32.
+ */
+uint32_t SOFT_TIMER_GetTick(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Tick;
+
+    SOFT_TIMER_ENTER_CRITICAL(u32Primask);
+    u32Tick = SoftTimerUpdateTick();
+    SOFT_TIMER_EXIT_CRITICAL(u32Primask);
+
+    return u32Tick;
+}
+
+/**
+ * @brief  Run the deferred callbacks, called in the main loop.
+ * @note   A periodic timer with a deferred callback is restarted here from its
+ *         last expiry, so a late main loop skips periods instead of queueing them.
+ * @param  None
+ * @retval Number of the callbacks run.
+ */
+uint32_t SOFT_TIMER_Process(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Num = 0ul;
+    stc_soft_timer_t *pstcTimer;
+
+    do
+    {
+        SOFT_TIMER_ENTER_CRITICAL(u32Primask);
+        pstcTimer = m_pstcDeferHead;
+        if (NULL != pstcTimer)
+        {
+            SoftTimerUnlink(pstcTimer);
+            if (0ul != pstcTimer->u32Period)
+            {
+                pstcTimer->u32Expire += pstcTimer->u32Period;
+                SoftTimerInsert(pstcTimer);
+                if ((int32_t)(pstcTimer->u32Expire - m_u32HwTarget) < 0l)
+                {
+                    if (Set == SoftTimerProgram())
+                    {
+                        NVIC_SetPendingIRQ(m_enSoftTimerIRQn);
+                    }
+                }
+            }
+        }
+        SOFT_TIMER_EXIT_CRITICAL(u32Primask);
+
+        if (NULL != pstcTimer)
+        {
+            pstcTimer->pfnCb(pstcTimer->pvArg);
+            u32Num++;
+        }
+    } while (NULL != pstcTimer);
+
+    return u32Num;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SOFT_TIMER_Local_Functions SOFT_TIMER Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Extend the counter to the 32 bits tick, in the critical section.
+ * @param  None
+ * @retval Current tick.
+ */
+static uint32_t SoftTimerUpdateTick(void)
+{
+    uint16_t u16Cnt = TIMERB_GetCounter(m_pstcSoftTimerTmrb);
+
+    m_u32Tick += (uint16_t)(u16Cnt - m_u16HwCnt);
+    m_u16HwCnt = u16Cnt;
+
+    return m_u32Tick;
+}
+
+/**
+ * @brief  Position of the lowest set bit, no loop.
+ * @param  [in] u32Map                  Slot map, not 0.
+ * @retval 0 ~ 15
+ */
+static uint32_t SoftTimerLowestBit(uint32_t u32Map)
+{
+    uint32_t u32Pos = 0ul;
+
+    if (0ul == (u32Map & 0xFFul))
+    {
+        u32Map >>= 8u;
+        u32Pos += 8ul;
+    }
+    if (0ul == (u32Map & 0x0Ful))
+    {
+        u32Map >>= 4u;
+        u32Pos += 4ul;
+    }
+    if (0ul == (u32Map & 0x03ul))
+    {
+        u32Map >>= 2u;
+        u32Pos += 2ul;
+    }
+    if (0ul == (u32Map & 0x01ul))
+    {
+        u32Pos += 1ul;
+    }
+
+    return u32Pos;
+}
+
+/**
+ * @brief  Head of the list which holds the timer in the wheel.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_soft_timer_t structure
+ * @retval Pointer to the list head.
+ */
+static stc_soft_timer_t **SoftTimerListHead(const stc_soft_timer_t *pstcTimer)
+{
+    stc_soft_timer_t **ppstcHead = &m_pstcFar;
+
+    if (SOFT_TIMER_LEVEL_FAR != pstcTimer->u8Level)
+    {
+        ppstcHead = &m_apstcWheel[pstcTimer->u8Level][pstcTimer->u8Slot];
+    }
+
+    return ppstcHead;
+}
+
+/**
+ * @brief  Put a timer into the wheel by its expiry.
+ * @note   The level is the highest digit(SOFT_TIMER_SLOT_BITS bits) in which the
+ *         expiry differs from the wheel time, the slot is that digit of the expiry.
+ *         The slot is reached when the wheel time gets the same digits, then the
+ *         timer expires(level 0) or moves to a lower level.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_soft_timer_t structure
+ * @retval None
+ */
+static void SoftTimerInsert(stc_soft_timer_t *pstcTimer)
+{
+    uint32_t u32Diff;
+    uint8_t u8Level = 0u;
+    uint8_t u8Slot = 0u;
+    stc_soft_timer_t **ppstcHead = &m_pstcFar;
+
+    /* A periodic timer restarted late expires at once. */
+    if ((int32_t)(pstcTimer->u32Expire - m_u32WheelTime) < 0l)
+    {
+        pstcTimer->u32Expire = m_u32WheelTime;
+    }
+
+    u32Diff = pstcTimer->u32Expire ^ m_u32WheelTime;
+    if (u32Diff > SOFT_TIMER_WHEEL_MASK)
+    {
+        u8Level = SOFT_TIMER_LEVEL_FAR;
+    }
+    else
+    {
+        while (0ul != (u32Diff >> (SOFT_TIMER_SLOT_BITS * (u8Level + 1u))))
+        {
+            u8Level++;
+        }
+        u8Slot = (uint8_t)((pstcTimer->u32Expire >> (SOFT_TIMER_SLOT_BITS * u8Level)) & SOFT_TIMER_SLOT_MASK);
+        ppstcHead = &m_apstcWheel[u8Level][u8Slot];
+        m_au16SlotMap[u8Level] |= (uint16_t)(1ul << u8Slot);
+    }
+
+    pstcTimer->u8Level = u8Level;
+    pstcTimer->u8Slot = u8Slot;
+    pstcTimer->u8State = SOFT_TIMER_STATE_WHEEL;
+    pstcTimer->pstcPrev = NULL;
+    pstcTimer->pstcNext = *ppstcHead;
+    if (NULL != *ppstcHead)
+    {
+        (*ppstcHead)->pstcPrev = pstcTimer;
+    }
+    *ppstcHead = pstcTimer;
+}
+
+/**
+ * @brief  Take a timer out of the wheel or the deferred list.
+ * @param  [in] pstcTimer               Pointer to a @ref stc_soft_timer_t structure
+ * @retval None
+ */
+static void SoftTimerUnlink(stc_soft_timer_t *pstcTimer)
+{
+    stc_soft_timer_t **ppstcHead;
+
+    if (SOFT_TIMER_STATE_WHEEL == pstcTimer->u8State)
+    {
+        ppstcHead = SoftTimerListHead(pstcTimer);
+        if (NULL != pstcTimer->pstcPrev)
+        {
+            pstcTimer->pstcPrev->pstcNext = pstcTimer->pstcNext;
+        }
+        else
+        {
+            *ppstcHead = pstcTimer->pstcNext;
+        }
+        if (NULL != pstcTimer->pstcNext)
+        {
+            pstcTimer->pstcNext->pstcPrev = pstcTimer->pstcPrev;
+        }
+        if ((SOFT_TIMER_LEVEL_FAR != pstcTimer->u8Level) && (NULL == *ppstcHead))
+        {
+            m_au16SlotMap[pstcTimer->u8Level] &= (uint16_t)~(1ul << pstcTimer->u8Slot);
+        }
+    }
+    else if (SOFT_TIMER_STATE_DEFER == pstcTimer->u8State)
+    {
+        if (NULL != pstcTimer->pstcPrev)
+        {
+            pstcTimer->pstcPrev->pstcNext = pstcTimer->pstcNext;
+        }
+        else
+        {
+            m_pstcDeferHead = pstcTimer->pstcNext;
+        }
+        if (NULL != pstcTimer->pstcNext)
+        {
+            pstcTimer->pstcNext->pstcPrev = pstcTimer->pstcPrev;
+        }
+        else
+        {
+            m_pstcDeferTail = pstcTimer->pstcPrev;
+        }
+    }
+    else
+    {
+        /* Idle */
+    }
+
+    pstcTimer->u8State = SOFT_TIMER_STATE_IDLE;
+}
+
+/**
+ * @brief  Find the next slot of the wheel to be processed.
+ * @note   A slot of level 0 is processed at the expiry, a slot of a higher level
+ *         at the start of its span, the far list when the wheel wraps. The lower
+ *         level always comes first, at most SOFT_TIMER_LEVEL_NUM maps are checked.
+ * @param  [out] pu32Time               Tick of the slot.
+ * @param  [out] pu8Slot                Slot in the level.
+ * @retval Level of the slot, SOFT_TIMER_LEVEL_FAR for the far list or
+ *         SOFT_TIMER_LEVEL_NONE if there is no timer.
+ */
+static uint8_t SoftTimerNextEvent(uint32_t *pu32Time, uint8_t *pu8Slot)
+{
+    uint8_t u8Level;
+    uint32_t u32Shift;
+    uint32_t u32Map;
+    uint32_t u32First;
+
+    for (u8Level = 0u; u8Level < SOFT_TIMER_LEVEL_NUM; u8Level++)
+    {
+        u32Shift = SOFT_TIMER_SLOT_BITS * (uint32_t)u8Level;
+        /* Level 0 starts at the current slot, the others after it. */
+        u32First = (m_u32WheelTime >> u32Shift) & SOFT_TIMER_SLOT_MASK;
+        if (0u != u8Level)
+        {
+            u32First++;
+        }
+        u32Map = (uint32_t)m_au16SlotMap[u8Level] & (0xFFFFul << u32First) & 0xFFFFul;
+        if (0ul != u32Map)
+        {
+            *pu8Slot = (uint8_t)SoftTimerLowestBit(u32Map);
+            *pu32Time = (m_u32WheelTime & ~((1ul << (u32Shift + SOFT_TIMER_SLOT_BITS)) - 1ul)) |
+                        ((uint32_t)*pu8Slot << u32Shift);
+            break;
+        }
+    }
+
+    if ((SOFT_TIMER_LEVEL_NUM == u8Level) && (NULL == m_pstcFar))
+    {
+        u8Level = SOFT_TIMER_LEVEL_NONE;
+    }
+    else if (SOFT_TIMER_LEVEL_FAR == u8Level)
+    {
+        *pu8Slot = 0u;
+        *pu32Time = (m_u32WheelTime | SOFT_TIMER_WHEEL_MASK) + 1ul;
+    }
+    else
+    {
+        /* Wheel slot */
+    }
+
+    return u8Level;
+}
+
+/**
+ * @brief  Set the compare to the next slot, in the critical section.
+ * @param  None
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The next slot is due already, the wheel is run again
+ *           - Reset: The compare is set
+ */
+static en_flag_status_t SoftTimerProgram(void)
+{
+    uint8_t u8Slot;
+    uint32_t u32Time;
+    uint32_t u32Delta = SOFT_TIMER_HW_DELTA_MAX;
+    uint32_t u32Now = SoftTimerUpdateTick();
+    en_flag_status_t enDue = Reset;
+
+    if (SOFT_TIMER_LEVEL_NONE != SoftTimerNextEvent(&u32Time, &u8Slot))
+    {
+        u32Time -= u32Now;
+        if ((int32_t)u32Time <= 0l)
+        {
+            enDue = Set;
+        }
+        else if (u32Time < u32Delta)
+        {
+            u32Delta = u32Time;
+        }
+        else
+        {
+            /* The longest delta */
+        }
+    }
+
+    if (Reset == enDue)
+    {
+        m_u32HwTarget = u32Now + u32Delta;
+        TIMERB_SetCompare(m_pstcSoftTimerTmrb, (uint16_t)(m_u16HwCnt + u32Delta));
+
+        /* The counter has passed the compare while it was set. */
+        if ((uint16_t)(TIMERB_GetCounter(m_pstcSoftTimerTmrb) - m_u16HwCnt) >= u32Delta)
+        {
+            enDue = Set;
+        }
+    }
+
+    return enDue;
+}
+
+/**
+ * @brief  Process the due slots of the wheel and set the compare, in the interrupt.
+ * @param  None
+ * @retval None
+ */
+static void SoftTimerRun(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Now;
+    uint32_t u32Time;
+    uint8_t u8Level;
+    uint8_t u8Slot;
+    stc_soft_timer_t *pstcTimer;
+    stc_soft_timer_t *pstcList;
+
+    SOFT_TIMER_ENTER_CRITICAL(u32Primask);
+    do
+    {
+        u32Now = SoftTimerUpdateTick();
+        u8Level = SoftTimerNextEvent(&u32Time, &u8Slot);
+        while ((SOFT_TIMER_LEVEL_NONE != u8Level) && ((int32_t)(u32Now - u32Time) >= 0l))
+        {
+            m_u32WheelTime = u32Time;
+            if (0u == u8Level)
+            {
+                /* Expire one by one, a callback may stop the others in the slot. */
+                pstcTimer = m_apstcWheel[0u][u8Slot];
+                SoftTimerUnlink(pstcTimer);
+                if (SOFT_TIMER_CB_DEFER == pstcTimer->u8CbMode)
+                {
+                    pstcTimer->u8State = SOFT_TIMER_STATE_DEFER;
+                    pstcTimer->pstcNext = NULL;
+                    pstcTimer->pstcPrev = m_pstcDeferTail;
+                    if (NULL != m_pstcDeferTail)
+                    {
+                        m_pstcDeferTail->pstcNext = pstcTimer;
+                    }
+                    else
+                    {
+                        m_pstcDeferHead = pstcTimer;
+                    }
+                    m_pstcDeferTail = pstcTimer;
+                }
+                else
+                {
+                    if (0ul != pstcTimer->u32Period)
+                    {
+                        pstcTimer->u32Expire += pstcTimer->u32Period;
+                        SoftTimerInsert(pstcTimer);
+                    }
+                    SOFT_TIMER_EXIT_CRITICAL(u32Primask);
+                    pstcTimer->pfnCb(pstcTimer->pvArg);
+                    SOFT_TIMER_ENTER_CRITICAL(u32Primask);
+                }
+            }
+            else
+            {
+                /* Move the slot(or the far list) down, no callback. */
+                if (SOFT_TIMER_LEVEL_FAR == u8Level)
+                {
+                    pstcList = m_pstcFar;
+                    m_pstcFar = NULL;
+                }
+                else
+                {
+                    pstcList = m_apstcWheel[u8Level][u8Slot];
+                    m_apstcWheel[u8Level][u8Slot] = NULL;
+                    m_au16SlotMap[u8Level] &= (uint16_t)~(1ul << u8Slot);
+                }
+                while (NULL != pstcList)
+                {
+                    pstcTimer = pstcList;
+                    pstcList = pstcList->pstcNext;
+                    SoftTimerInsert(pstcTimer);
+                }
+            }
+            u8Level = SoftTimerNextEvent(&u32Time, &u8Slot);
+        }
+
+        /* Nothing is due up to now, the slots passed are empty. */
+        m_u32WheelTime = u32Now;
+    } while (Set == SoftTimerProgram());
+    SOFT_TIMER_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Compare IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void SoftTimerCmpIrqCallback(void)
+{
+    TIMERB_ClearFlag(m_pstcSoftTimerTmrb, TIMERB_FLAG_CMP);
+    SoftTimerRun();
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_SOFT_TIMER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,255 @@
+/**
+ *******************************************************************************
+ * @file  stepper.h
+ * @brief This file contains all the functions prototypes of the stepper motor
+ *        ramp generator midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Hongjh          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __STEPPER_H__
+#define __STEPPER_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_STEPPER
+ * @{
+ */
+
+#if (MW_STEPPER_ENABLE == DDL_ON)
+
+#if (DDL_TIMERB_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERB_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_DMA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_DMA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup STEPPER_Global_Types STEPPER Global Types
+ * @{
+ */
+
+/**
+ * @brief Stepper ramp configuration structure definition
+ */
+typedef struct
+{
+    uint32_t u32ClkFreq;                /*!< Count clock of the TimerB unit in Hz, HCLK / division. */
+    uint32_t u32StartSpeed;             /*!< Speed of the first step in steps/s, may be 0. */
+    uint32_t u32MaxSpeed;               /*!< Cruise speed in steps/s, u32StartSpeed < u32MaxSpeed < STEPPER_SPEED_MAX. */
+    uint32_t u32Accel;                  /*!< Acceleration in steps/s^2, the peak value for the S-curve. */
+    uint8_t  u8Profile;                 /*!< Ramp profile.
+                                             This parameter can be a value of @ref STEPPER_Profile */
+} stc_stepper_ramp_cfg_t;
+
+/**
+ * @brief Stepper ramp structure definition
+ * @note  pu16Table[n] is the interval of step n + 1 of the ramp in count clocks,
+ *        pu16Table[u16Len] is the cruise interval. The table is read by DMA while a
+ *        move runs and can be shared by several axes.
+ */
+typedef struct
+{
+    uint16_t *pu16Table;                /*!< Buffer of the step intervals. */
+    uint16_t u16Size;                   /*!< Entries of the buffer. */
+    uint16_t u16Len;                    /*!< Steps of the ramp, set by STEPPER_RampInit(). */
+} stc_stepper_ramp_t;
+
+/**
+ * @brief Stepper axis handle structure definition
+ * @note  1. The TimerB unit counts up with the count clock of the ramp and outputs the
+ *           step pulses on its PWM pin, configured by the application: output high at
+ *           the start and at the period match, low at the compare match and at the
+ *           stop. The compare value is the pulse width and must be shorter than the
+ *           shortest interval of the ramp.
+ *        2. STEPPER_MODE_DMA: the intervals are written into the period register by
+ *           DMA on the overflow event, the CPU takes one interrupt per 1023 steps at
+ *           most. STEPPER_MODE_IRQ: the overflow interrupt writes the next interval
+ *           from the table, for the axes beyond the two DMA channels.
+ *        3. The counter is stopped by the hardware at the overflow of the last step.
+ *           STEPPER_MODE_DMA: the stop is armed by DMA right after the interval of
+ *           the last step, so the step count and the step timing do not depend on
+ *           the interrupt latency. The transfer complete interrupt must only be served
+ *           within a block of 1023 steps, to leave the cruise loop of a long move.
+ *           STEPPER_MODE_IRQ: the overflow interrupt must be served within the
+ *           shortest interval of the ramp. A later one repeats the previous interval,
+ *           and at the end of the move outputs steps beyond u32Steps until it arms
+ *           the stop.
+ */
+typedef struct
+{
+    M0P_TMRB_TypeDef *TMRBx;            /*!< TimerB unit, M0P_TMRB1 ~ M0P_TMRB4. */
+    uint8_t  u8Mode;                    /*!< Interval update mode.
+                                             This parameter can be a value of @ref STEPPER_Mode */
+    uint8_t  u8DmaCh;                   /*!< DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1 (DMA mode). */
+    IRQn_Type enDmaIRQn;                /*!< IRQ number of the DMA transfer complete interrupt (DMA mode). */
+    IRQn_Type enOvfIRQn;                /*!< IRQ number of the overflow interrupt INT_TMRB_x_OVF (IRQ mode). */
+    const stc_stepper_ramp_t *pstcRamp; /*!< Ramp of the axis. */
+
+    /* Internal state, set by STEPPER_Init() and STEPPER_Prepare() */
+    stc_dma_llp_descriptor_t astcDesc[8u];  /*!< Descriptors of a move, acceleration 2, cruise 3, deceleration 2, stop 1. */
+    uint8_t  u8DescNum;                 /*!< Descriptors used. */
+    uint8_t  u8PatchIdx;                /*!< Descriptor which leaves the cruise loop. */
+    uint8_t  u8Ready;                   /*!< A move is prepared. */
+    uint16_t u16StopBcstr;              /*!< BCSTR written by DMA after the last interval, stops at the overflow.
+                                             Taken at the start, see STEPPER_Prepare(). */
+    uint32_t u32PatchCtl0;              /*!< CHxCTL0 of u8PatchIdx leaving the loop. */
+    uint32_t u32TcPatch;                /*!< Transfer complete count to patch at, 0: none. */
+    __IO uint32_t u32TcCnt;             /*!< Transfer complete count of the move. */
+    uint32_t u32Steps;                  /*!< Steps of the move. */
+    uint32_t u32Accel;                  /*!< Steps of the acceleration and of the deceleration. */
+    uint32_t u32Cruise;                 /*!< Steps of the cruise. */
+    __IO uint32_t u32Step;              /*!< Intervals written in IRQ mode. */
+} stc_stepper_handle_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup STEPPER_Global_Macros STEPPER Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup STEPPER_Profile STEPPER Profile
+ * @{
+ */
+#define STEPPER_PROFILE_TRAPEZOID       ((uint8_t)0u)   /*!< Constant acceleration. */
+#define STEPPER_PROFILE_SCURVE          ((uint8_t)1u)   /*!< Acceleration rises and falls smoothly, no jerk steps. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup STEPPER_Mode STEPPER Mode
+ * @{
+ */
+#define STEPPER_MODE_DMA                ((uint8_t)0u)   /*!< DMA writes the intervals. */
+#define STEPPER_MODE_IRQ                ((uint8_t)1u)   /*!< The overflow interrupt writes the intervals. */
+/**
+ * @}
+ */
+
+#define STEPPER_SPEED_MAX               (0x20000ul)     /*!< Speed limit of the ramp calculation in steps/s. */
+#define STEPPER_RAMP_LEN_MAX            (2046u)         /*!< Ramp steps, two DMA blocks. */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup STEPPER_Global_Functions
+ * @{
+ */
+en_result_t STEPPER_RampInit(stc_stepper_ramp_t *pstcRamp, const stc_stepper_ramp_cfg_t *pstcCfg);
+en_result_t STEPPER_Init(stc_stepper_handle_t *pstcHandle);
+en_result_t STEPPER_Prepare(stc_stepper_handle_t *pstcHandle, uint32_t u32Steps);
+en_result_t STEPPER_Start(stc_stepper_handle_t *pstcHandle);
+en_result_t STEPPER_StartSync(stc_stepper_handle_t *const apstcHandle[], uint8_t u8Num);
+en_result_t STEPPER_Stop(stc_stepper_handle_t *pstcHandle);
+en_flag_status_t STEPPER_IsBusy(const stc_stepper_handle_t *pstcHandle);
+/**
+ * @}
+ */
+
+#endif /* MW_STEPPER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __STEPPER_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,968 @@
+/**
+ *******************************************************************************
+ * @file  stepper.c
+ * @brief This midware file provides firmware functions to move stepper motors
+ *        with acceleration ramps precomputed into step interval tables, output
+ *        by TimerB and fed by DMA or by the overflow interrupt.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Hongjh          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "stepper.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_STEPPER STEPPER
+ * @brief Stepper Motor Ramp Generator Midware Library
+ * @{
+ */
+
+#if (MW_STEPPER_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup STEPPER_Local_Macros STEPPER Local Macros
+ * @{
+ */
+
+#define STEPPER_UNIT_NUM                (4u)
+#define STEPPER_DESC_NUM                (8u)
+
+/* Transfer count field of the DMA channel. */
+#define STEPPER_BLOCK_MAX               (1023ul)
+
+/* LLP field of CHxCTL0 holds bit[11:2] of the descriptor address. */
+#define STEPPER_LLP_FIELD(addr)         (((addr) & 0x00000FFCul) << (DMA_CH0CTL0_LLP_POS - 2ul))
+#define STEPPER_LLP_MASK                (DMA_LLP_ENABLE | DMA_CH0CTL0_LLPRUN | DMA_CH0CTL0_LLP)
+
+#define IS_STEPPER_DMA_CH(x)                                                   \
+(   ((x) == DMA_CHANNEL_0)                      ||                             \
+    ((x) == DMA_CHANNEL_1))
+
+#define IS_STEPPER_MODE(x)                                                     \
+(   ((x) == STEPPER_MODE_DMA)                   ||                             \
+    ((x) == STEPPER_MODE_IRQ))
+
+#define IS_STEPPER_PROFILE(x)                                                  \
+(   ((x) == STEPPER_PROFILE_TRAPEZOID)          ||                             \
+    ((x) == STEPPER_PROFILE_SCURVE))
+
+#define IS_STEPPER_RAMP_CFG(c)                                                 \
+(   (0ul != (c)->u32ClkFreq)                    &&                             \
+    (0ul != (c)->u32Accel)                      &&                             \
+    ((c)->u32StartSpeed < (c)->u32MaxSpeed)     &&                             \
+    ((c)->u32MaxSpeed < STEPPER_SPEED_MAX)      &&                             \
+    IS_STEPPER_PROFILE((c)->u8Profile))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t StepperSqrt(uint64_t u64Value);
+static uint8_t StepperGetUnit(const M0P_TMRB_TypeDef *TMRBx);
+static uint16_t StepperInterval(const stc_stepper_handle_t *pstcHandle, uint32_t u32Step);
+static uint16_t StepperStopBcstr(const M0P_TMRB_TypeDef *TMRBx);
+static void StepperAddDesc(stc_stepper_handle_t *pstcHandle, uint32_t u32Src,
+                           uint32_t u32Cnt, uint32_t u32SrcInc);
+static void StepperDmaBuild(stc_stepper_handle_t *pstcHandle);
+static void StepperDmaLoad(const stc_stepper_handle_t *pstcHandle);
+static void StepperDmaTcHandler(uint8_t u8DmaCh);
+static void StepperOvfHandler(uint8_t u8Unit);
+static void StepperDma0TcIrqCallback(void);
+static void StepperDma1TcIrqCallback(void);
+static void StepperTmrb1OvfIrqCallback(void);
+static void StepperTmrb2OvfIrqCallback(void);
+static void StepperTmrb3OvfIrqCallback(void);
+static void StepperTmrb4OvfIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_stepper_handle_t *m_apstcStepperDma[2u];
+static stc_stepper_handle_t *m_apstcStepperUnit[STEPPER_UNIT_NUM];
+
+static M0P_TMRB_TypeDef *const m_apstcStepperTmrb[STEPPER_UNIT_NUM] =
+{
+    M0P_TMRB1, M0P_TMRB2, M0P_TMRB3, M0P_TMRB4,
+};
+
+static const en_event_src_t m_aenStepperOvfEvt[STEPPER_UNIT_NUM] =
+{
+    EVT_TMRB_1_OVF, EVT_TMRB_2_OVF, EVT_TMRB_3_OVF, EVT_TMRB_4_OVF,
+};
+
+static const func_ptr_t m_apfnStepperOvfCb[STEPPER_UNIT_NUM] =
+{
+    &StepperTmrb1OvfIrqCallback, &StepperTmrb2OvfIrqCallback,
+    &StepperTmrb3OvfIrqCallback, &StepperTmrb4OvfIrqCallback,
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup STEPPER_Global_Functions STEPPER Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Calculate the step intervals of an acceleration ramp from the start speed
+ *         to the cruise speed, the deceleration uses the same table backwards.
+ * @note   1. STEPPER_PROFILE_TRAPEZOID: step n starts at the time
+ *            (sqrt(v0^2 + 2 * a * n) - v0) / a, the radicand grows by an addition per
+ *            step and the square root is taken bit by bit, so the table is built
+ *            without a division per step and the rounding error does not add up.
+ *         2. STEPPER_PROFILE_SCURVE: v^2 follows 3x^2 - 2x^3 over the ramp, so the
+ *            acceleration starts and ends at 0 and peaks at u32Accel in the middle.
+ *            The interval of a step is the count clock / the speed in its middle.
+ *         3. This is done once per ramp, the moves only read the table.
+ * @param  [in] pstcRamp                Pointer to a @ref stc_stepper_ramp_t structure
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_stepper_ramp_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The table is calculated
+ *           - ErrorInvalidParameter: a pointer is NULL, the configuration is invalid,
+ *                                    the ramp is longer than STEPPER_RAMP_LEN_MAX or
+ *                                    an interval is out of 1 ~ 65535 count clocks
+ *           - ErrorBufferFull: the buffer is shorter than the ramp + 1
+ */
+en_result_t STEPPER_RampInit(stc_stepper_ramp_t *pstcRamp, const stc_stepper_ramp_cfg_t *pstcCfg)
+{
+    uint32_t n;
+    uint32_t u32Len = 0ul;
+    uint32_t u32Root;
+    uint32_t u32Time;
+    uint32_t u32LastTime = 0ul;
+    uint64_t u64Delta = 0ull;
+    uint64_t u64Rad;
+    uint64_t u64Step;
+    uint64_t u64K;
+    uint64_t u64M;
+    uint64_t u64Poly;
+    uint64_t u64Interval = 0ull;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcRamp) && (NULL != pstcRamp->pu16Table) &&
+        (NULL != pstcCfg) && IS_STEPPER_RAMP_CFG(pstcCfg))
+    {
+        u64Delta = ((uint64_t)pstcCfg->u32MaxSpeed * pstcCfg->u32MaxSpeed) -
+                   ((uint64_t)pstcCfg->u32StartSpeed * pstcCfg->u32StartSpeed);
+        if (STEPPER_PROFILE_TRAPEZOID == pstcCfg->u8Profile)
+        {
+            u32Len = (uint32_t)((u64Delta + (2ull * pstcCfg->u32Accel) - 1ull) /
+                                (2ull * pstcCfg->u32Accel));
+        }
+        else
+        {
+            u32Len = (uint32_t)(((3ull * u64Delta) + (4ull * pstcCfg->u32Accel) - 1ull) /
+                                (4ull * pstcCfg->u32Accel));
+        }
+
+        if (u32Len <= STEPPER_RAMP_LEN_MAX)
+        {
+            enRet = (u32Len < (uint32_t)pstcRamp->u16Size) ? Ok : ErrorBufferFull;
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        if (STEPPER_PROFILE_TRAPEZOID == pstcCfg->u8Profile)
+        {
+            /* Root in Q12, time = K * (root - v0) with K = f / a in Q20. */
+            u64K    = ((uint64_t)pstcCfg->u32ClkFreq << 20u) / pstcCfg->u32Accel;
+            u64Rad  = ((uint64_t)pstcCfg->u32StartSpeed * pstcCfg->u32StartSpeed) << 24u;
+            u64Step = (uint64_t)pstcCfg->u32Accel << 25u;
+            for (n = 1ul; (n <= u32Len) && (Ok == enRet); n++)
+            {
+                u64Rad += u64Step;
+                u32Root = StepperSqrt(u64Rad) - (pstcCfg->u32StartSpeed << 12u);
+                u32Time = (uint32_t)(((u64K * u32Root) + 0x80000000ull) >> 32u);
+                u64Interval = (uint64_t)u32Time - u32LastTime;
+                u32LastTime = u32Time;
+                if ((0ull == u64Interval) || (u64Interval > 0xFFFFull))
+                {
+                    enRet = ErrorInvalidParameter;
+                }
+                else
+                {
+                    pstcRamp->pu16Table[n - 1ul] = (uint16_t)u64Interval;
+                }
+            }
+        }
+        else
+        {
+            /* Middle of step n is x = (2n + 1) / 2N, 3x^2 - 2x^3 in Q16, v^2 in Q8. */
+            u64M = 2ull * u32Len;
+            for (n = 0ul; (n < u32Len) && (Ok == enRet); n++)
+            {
+                u64Poly = (2ull * n) + 1ull;
+                u64Poly = (((3ull * u64M) - (2ull * u64Poly)) * u64Poly * u64Poly << 16u) /
+                          (u64M * u64M * u64M);
+                u64Rad  = (((uint64_t)pstcCfg->u32StartSpeed * pstcCfg->u32StartSpeed) << 8u) +
+                          ((u64Delta * u64Poly) >> 8u);
+                u32Root = StepperSqrt(u64Rad);
+                u64Interval = (0ul != u32Root) ?
+                              (((uint64_t)pstcCfg->u32ClkFreq << 4u) + (u32Root >> 1u)) / u32Root : 0ull;
+                if ((0ull == u64Interval) || (u64Interval > 0xFFFFull))
+                {
+                    enRet = ErrorInvalidParameter;
+                }
+                else
+                {
+                    pstcRamp->pu16Table[n] = (uint16_t)u64Interval;
+                }
+            }
+        }
+
+        /* Cruise interval. */
+        u64Interval = ((uint64_t)pstcCfg->u32ClkFreq + (pstcCfg->u32MaxSpeed >> 1u)) / pstcCfg->u32MaxSpeed;
+        if ((Ok == enRet) && (0ull != u64Interval) && (u64Interval <= 0xFFFFull))
+        {
+            pstcRamp->pu16Table[u32Len] = (uint16_t)u64Interval;
+            pstcRamp->u16Len = (uint16_t)u32Len;
+        }
+        else
+        {
+            pstcRamp->u16Len = 0u;
+            enRet = ErrorInvalidParameter;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Initialize a stepper axis and register its interrupt.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, the unit, the mode, the DMA
+ *                                    channel or the ramp is invalid
+ */
+en_result_t STEPPER_Init(stc_stepper_handle_t *pstcHandle)
+{
+    uint8_t u8Unit;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && IS_STEPPER_MODE(pstcHandle->u8Mode) &&
+        (NULL != pstcHandle->pstcRamp) && (0u != pstcHandle->pstcRamp->u16Len))
+    {
+        u8Unit = StepperGetUnit(pstcHandle->TMRBx);
+        if ((u8Unit < STEPPER_UNIT_NUM) &&
+            ((STEPPER_MODE_IRQ == pstcHandle->u8Mode) || IS_STEPPER_DMA_CH(pstcHandle->u8DmaCh)))
+        {
+            pstcHandle->u8Ready = 0u;
+            m_apstcStepperUnit[u8Unit] = pstcHandle;
+
+            if (STEPPER_MODE_DMA == pstcHandle->u8Mode)
+            {
+                /* Enable peripheral clock */
+                CLK_FcgPeriphClockCmd(CLK_FCG_DMA | CLK_FCG_AOS, Enable);
+
+                m_apstcStepperDma[pstcHandle->u8DmaCh] = pstcHandle;
+
+                /* Register DMA transfer complete IRQ handler && configure NVIC. */
+                stcIrqRegiConf.enIRQn = pstcHandle->enDmaIRQn;
+                if (DMA_CHANNEL_0 == pstcHandle->u8DmaCh)
+                {
+                    stcIrqRegiConf.enIntSrc = INT_DAM_1_TC0;
+                    stcIrqRegiConf.pfnCallback = &StepperDma0TcIrqCallback;
+                }
+                else
+                {
+                    stcIrqRegiConf.enIntSrc = INT_DAM_2_TC0;
+                    stcIrqRegiConf.pfnCallback = &StepperDma1TcIrqCallback;
+                }
+            }
+            else
+            {
+                /* Register overflow IRQ handler && configure NVIC. */
+                stcIrqRegiConf.enIRQn = pstcHandle->enOvfIRQn;
+                stcIrqRegiConf.enIntSrc = (en_int_src_t)m_aenStepperOvfEvt[u8Unit];
+                stcIrqRegiConf.pfnCallback = m_apfnStepperOvfCb[u8Unit];
+            }
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Prepare a move: load the first interval and arm the interval updates, the
+ *         counter is left stopped.
+ * @note   1. The move accelerates over min(ramp, u32Steps / 2) steps, cruises and
+ *            decelerates over the same steps backwards. A short move turns at the
+ *            speed it has reached.
+ *         2. STEPPER_MODE_DMA: the stop of the move is armed by DMA writing a copy
+ *            of BCSTR, taken again by STEPPER_Start() and STEPPER_StartSync(). A
+ *            change of BCSTR by the application while the axis moves is reverted
+ *            at the last step.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @param  [in] u32Steps                Steps of the move, 1 or more.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: The move is prepared
+ *           - ErrorInvalidParameter: pstcHandle == NULL, not initialized or u32Steps == 0
+ *           - ErrorOperationInProgress: the axis is moving
+ */
+en_result_t STEPPER_Prepare(stc_stepper_handle_t *pstcHandle, uint32_t u32Steps)
+{
+    uint8_t u8Unit;
+    M0P_TMRB_TypeDef *TMRBx;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (0ul != u32Steps))
+    {
+        u8Unit = StepperGetUnit(pstcHandle->TMRBx);
+        if ((u8Unit < STEPPER_UNIT_NUM) && (pstcHandle == m_apstcStepperUnit[u8Unit]))
+        {
+            enRet = (Set == STEPPER_IsBusy(pstcHandle)) ? ErrorOperationInProgress : Ok;
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        TMRBx = pstcHandle->TMRBx;
+        pstcHandle->u32Steps  = u32Steps;
+        pstcHandle->u32Accel  = u32Steps >> 1u;
+        if (pstcHandle->u32Accel > (uint32_t)pstcHandle->pstcRamp->u16Len)
+        {
+            pstcHandle->u32Accel = (uint32_t)pstcHandle->pstcRamp->u16Len;
+        }
+        pstcHandle->u32Cruise = u32Steps - (pstcHandle->u32Accel << 1u);
+        pstcHandle->u32Step   = 1ul;
+        pstcHandle->u32TcCnt  = 0ul;
+
+        /* The first interval is in place before the start, the overflow at the end of
+           step k writes the interval of step k + 1. */
+        TIMERB_Stop(TMRBx);
+        CLEAR_REG16_BIT(TMRBx->BCSTR, TMRB_BCSTR_OVSTP);
+        TIMERB_IntCmd(TMRBx, TIMERB_IT_OVF, Disable);
+        TIMERB_SetCounter(TMRBx, 0u);
+        TIMERB_SetPeriod(TMRBx, pstcHandle->pstcRamp->pu16Table[0u]);
+        TIMERB_ClearFlag(TMRBx, TIMERB_FLAG_OVF);
+
+        if (1ul == u32Steps)
+        {
+            SET_REG16_BIT(TMRBx->BCSTR, TMRB_BCSTR_OVSTP);
+        }
+        else if (STEPPER_MODE_DMA == pstcHandle->u8Mode)
+        {
+            pstcHandle->u16StopBcstr = StepperStopBcstr(TMRBx);
+            StepperDmaBuild(pstcHandle);
+            StepperDmaLoad(pstcHandle);
+            DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+            DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Enable);
+            DMA_SetTriggerSrc(pstcHandle->u8DmaCh, m_aenStepperOvfEvt[StepperGetUnit(TMRBx)]);
+            DMA_ChannelEnable(pstcHandle->u8DmaCh);
+            DMA_Cmd(Enable);
+        }
+        else
+        {
+            TIMERB_IntCmd(TMRBx, TIMERB_IT_OVF, Enable);
+        }
+
+        pstcHandle->u8Ready = 1u;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start a prepared move.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or no move is prepared
+ */
+en_result_t STEPPER_Start(stc_stepper_handle_t *pstcHandle)
+{
+    return STEPPER_StartSync(&pstcHandle, 1u);
+}
+
+/**
+ * @brief  Start the prepared moves of several axes together.
+ * @note   TimerB unit 2 and unit 4 are started by the hardware with unit 1 and
+ *         unit 3 when both units of the pair are in apstcHandle, the other units
+ *         are started one after the other with the interrupts disabled.
+ * @param  [in] apstcHandle             Array of pointers to @ref stc_stepper_handle_t structures
+ * @param  [in] u8Num                   Number of the axes.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: apstcHandle == NULL, u8Num == 0, or an axis has
+ *                                    no move prepared
+ */
+en_result_t STEPPER_StartSync(stc_stepper_handle_t *const apstcHandle[], uint8_t u8Num)
+{
+    uint32_t i;
+    uint32_t u32Primask;
+    uint8_t u8UnitMsk = 0u;
+    uint8_t u8SyncMsk;
+    uint8_t u8Unit;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != apstcHandle) && (0u != u8Num))
+    {
+        enRet = Ok;
+        for (i = 0ul; i < (uint32_t)u8Num; i++)
+        {
+            if ((NULL == apstcHandle[i]) || (0u == apstcHandle[i]->u8Ready))
+            {
+                enRet = ErrorInvalidParameter;
+            }
+            else
+            {
+                u8UnitMsk |= (uint8_t)(1u << StepperGetUnit(apstcHandle[i]->TMRBx));
+            }
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        /* Unit 2 (bit 1) follows unit 1 (bit 0), unit 4 (bit 3) follows unit 3 (bit 2). */
+        u8SyncMsk = u8UnitMsk & (uint8_t)(u8UnitMsk << 1u) & 0x0Au;
+
+        u32Primask = __get_PRIMASK();
+        __disable_irq();
+        /* The stop by DMA keeps the changes of BCSTR since STEPPER_Prepare(). */
+        for (i = 0ul; i < (uint32_t)u8Num; i++)
+        {
+            if ((STEPPER_MODE_DMA == apstcHandle[i]->u8Mode) && (apstcHandle[i]->u32Steps > 1ul))
+            {
+                apstcHandle[i]->u16StopBcstr = StepperStopBcstr(apstcHandle[i]->TMRBx);
+            }
+        }
+        for (u8Unit = 0u; u8Unit < STEPPER_UNIT_NUM; u8Unit++)
+        {
+            if (0u != (u8SyncMsk & (1u << u8Unit)))
+            {
+                TIMERB_EnableSyncStart(m_apstcStepperTmrb[u8Unit]);
+            }
+        }
+        for (u8Unit = 0u; u8Unit < STEPPER_UNIT_NUM; u8Unit++)
+        {
+            if (0u != ((u8UnitMsk & (uint8_t)~u8SyncMsk) & (1u << u8Unit)))
+            {
+                TIMERB_Start(m_apstcStepperTmrb[u8Unit]);
+            }
+        }
+        for (u8Unit = 0u; u8Unit < STEPPER_UNIT_NUM; u8Unit++)
+        {
+            if (0u != (u8SyncMsk & (1u << u8Unit)))
+            {
+                TIMERB_DisableSyncStart(m_apstcStepperTmrb[u8Unit]);
+            }
+        }
+        __set_PRIMASK(u32Primask);
+
+        for (i = 0ul; i < (uint32_t)u8Num; i++)
+        {
+            apstcHandle[i]->u8Ready = 0u;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the axis at once, without deceleration.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Stop success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or not initialized
+ */
+en_result_t STEPPER_Stop(stc_stepper_handle_t *pstcHandle)
+{
+    uint8_t u8Unit;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        u8Unit = StepperGetUnit(pstcHandle->TMRBx);
+        if ((u8Unit < STEPPER_UNIT_NUM) && (pstcHandle == m_apstcStepperUnit[u8Unit]))
+        {
+            TIMERB_Stop(pstcHandle->TMRBx);
+            TIMERB_IntCmd(pstcHandle->TMRBx, TIMERB_IT_OVF, Disable);
+            if (STEPPER_MODE_DMA == pstcHandle->u8Mode)
+            {
+                DMA_ChannelDisable(pstcHandle->u8DmaCh);
+                DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Disable);
+                DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+            }
+            pstcHandle->u8Ready = 0u;
+            enRet = Ok;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the state of the axis.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The counter runs, the move is not done
+ *           - Reset: The axis stands still
+ */
+en_flag_status_t STEPPER_IsBusy(const stc_stepper_handle_t *pstcHandle)
+{
+    en_flag_status_t enRet = Reset;
+
+    if ((NULL != pstcHandle) && (NULL != pstcHandle->TMRBx))
+    {
+        if (0u != READ_REG16_BIT(pstcHandle->TMRBx->BCSTR, TMRB_BCSTR_START))
+        {
+            enRet = Set;
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup STEPPER_Local_Functions STEPPER Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Integer square root, bit by bit without division.
+ * @param  [in] u64Value                Radicand.
+ * @retval floor(sqrt(u64Value))
+ */
+static uint32_t StepperSqrt(uint64_t u64Value)
+{
+    uint64_t u64Root = 0ull;
+    uint64_t u64Bit = 1ull << 62u;
+
+    while (u64Bit > u64Value)
+    {
+        u64Bit >>= 2u;
+    }
+
+    while (0ull != u64Bit)
+    {
+        if (u64Value >= (u64Root + u64Bit))
+        {
+            u64Value -= u64Root + u64Bit;
+            u64Root = (u64Root >> 1u) + u64Bit;
+        }
+        else
+        {
+            u64Root >>= 1u;
+        }
+        u64Bit >>= 2u;
+    }
+
+    return (uint32_t)u64Root;
+}
+
+/**
+ * @brief  BCSTR which the DMA writes after the last interval: the counter runs
+ *         and stops at the next overflow, the flags are not written.
+ * @param  [in] TMRBx                   Pointer to TimerB instance register base
+ * @retval Value of BCSTR.
+ */
+static uint16_t StepperStopBcstr(const M0P_TMRB_TypeDef *TMRBx)
+{
+    return (uint16_t)((READ_REG16(TMRBx->BCSTR) & (uint16_t)~(TMRB_BCSTR_OVFF | TMRB_BCSTR_UDFF)) |
+                      TMRB_BCSTR_START | TMRB_BCSTR_OVSTP);
+}
+
+/**
+ * @brief  Get the unit index of a TimerB instance.
+ * @param  [in] TMRBx                   Pointer to TimerB instance register base
+ * @retval 0 ~ 3 for TimerB unit 1 ~ 4, STEPPER_UNIT_NUM for an invalid instance.
+ */
+static uint8_t StepperGetUnit(const M0P_TMRB_TypeDef *TMRBx)
+{
+    uint8_t u8Unit = 0u;
+
+    while ((u8Unit < STEPPER_UNIT_NUM) && (TMRBx != m_apstcStepperTmrb[u8Unit]))
+    {
+        u8Unit++;
+    }
+
+    return u8Unit;
+}
+
+/**
+ * @brief  Interval of a step of the move.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @param  [in] u32Step                 Step, 1 ~ u32Steps.
+ * @retval Interval in count clocks.
+ */
+static uint16_t StepperInterval(const stc_stepper_handle_t *pstcHandle, uint32_t u32Step)
+{
+    uint32_t u32Idx;
+
+    if (u32Step <= pstcHandle->u32Accel)
+    {
+        u32Idx = u32Step - 1ul;
+    }
+    else if (u32Step <= (pstcHandle->u32Accel + pstcHandle->u32Cruise))
+    {
+        u32Idx = pstcHandle->u32Accel;
+    }
+    else
+    {
+        u32Idx = pstcHandle->u32Steps - u32Step;
+    }
+
+    return pstcHandle->pstcRamp->pu16Table[u32Idx];
+}
+
+/**
+ * @brief  Append a descriptor to the move, the link is set by StepperDmaBuild().
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @param  [in] u32Src                  Address of the first interval.
+ * @param  [in] u32Cnt                  Intervals, 1 ~ STEPPER_BLOCK_MAX.
+ * @param  [in] u32SrcInc               DMA_SRCADDRINC_INC, DMA_SRCADDRINC_FIX or DMA_SRCADDRINC_DEC.
+ * @retval None
+ */
+static void StepperAddDesc(stc_stepper_handle_t *pstcHandle, uint32_t u32Src,
+                           uint32_t u32Cnt, uint32_t u32SrcInc)
+{
+    stc_dma_llp_descriptor_t *pstcDesc = &pstcHandle->astcDesc[pstcHandle->u8DescNum];
+
+    DDL_ASSERT(pstcHandle->u8DescNum < STEPPER_DESC_NUM);
+
+    pstcDesc->SARx    = u32Src;
+    pstcDesc->DARx    = (uint32_t)(&pstcHandle->TMRBx->PERAR);
+    pstcDesc->CHxCTL0 = 1ul | (u32Cnt << DMA_CH0CTL0_CNT_POS) | DMA_DATAWIDTH_16BIT;
+    pstcDesc->CHxCTL1 = u32SrcInc | DMA_DESADDRINC_FIX;
+    pstcHandle->u8DescNum++;
+}
+
+/**
+ * @brief  Build the descriptors of the intervals of step 2 ~ u32Steps.
+ * @note   The acceleration reads the table forwards, the cruise reads the cruise
+ *         interval again and again, and the deceleration reads the table backwards.
+ *         The descriptor of the last interval runs on to one which sets the stop at
+ *         the overflow in BCSTR, during the last step.
+ *         A cruise of more than 2 blocks runs in a loop of two descriptors, the
+ *         descriptor of the last block is patched to leave the loop while the other
+ *         one runs, and each block of 1023 steps leaves time enough for that.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @retval None
+ */
+static void StepperDmaBuild(stc_stepper_handle_t *pstcHandle)
+{
+    uint32_t i;
+    uint32_t u32Cnt;
+    uint32_t u32Left;
+    uint32_t u32Src;
+    uint32_t u32Loop;
+    uint8_t u8Loop;
+    const uint16_t *pu16Table = pstcHandle->pstcRamp->pu16Table;
+
+    pstcHandle->u8DescNum = 0u;
+
+    /* Acceleration, step 2 ~ u32Accel. */
+    u32Src  = (uint32_t)(&pu16Table[1u]);
+    u32Left = (pstcHandle->u32Accel > 0ul) ? (pstcHandle->u32Accel - 1ul) : 0ul;
+    while (0ul != u32Left)
+    {
+        u32Cnt = (u32Left > STEPPER_BLOCK_MAX) ? STEPPER_BLOCK_MAX : u32Left;
+        StepperAddDesc(pstcHandle, u32Src, u32Cnt, DMA_SRCADDRINC_INC);
+        u32Src  += u32Cnt * 2ul;
+        u32Left -= u32Cnt;
+    }
+
+    /* Cruise, full blocks and the rest. */
+    u8Loop  = pstcHandle->u8DescNum;
+    u32Src  = (uint32_t)(&pu16Table[pstcHandle->u32Accel]);
+    u32Loop = pstcHandle->u32Cruise / STEPPER_BLOCK_MAX;
+    for (i = 0ul; (i < u32Loop) && (i < 2ul); i++)
+    {
+        StepperAddDesc(pstcHandle, u32Src, STEPPER_BLOCK_MAX, DMA_SRCADDRINC_FIX);
+    }
+    u32Cnt = pstcHandle->u32Cruise % STEPPER_BLOCK_MAX;
+    if (0ul != u32Cnt)
+    {
+        StepperAddDesc(pstcHandle, u32Src, u32Cnt, DMA_SRCADDRINC_FIX);
+    }
+
+    /* Deceleration, the table backwards down to the first interval. */
+    u32Src  = (uint32_t)(&pu16Table[pstcHandle->u32Accel]) - 2ul;
+    u32Left = pstcHandle->u32Accel;
+    while (0ul != u32Left)
+    {
+        u32Cnt = (u32Left > STEPPER_BLOCK_MAX) ? STEPPER_BLOCK_MAX : u32Left;
+        StepperAddDesc(pstcHandle, u32Src, u32Cnt, DMA_SRCADDRINC_DEC);
+        u32Src  -= u32Cnt * 2ul;
+        u32Left -= u32Cnt;
+    }
+
+    /* Stop at the overflow of the last step. */
+    StepperAddDesc(pstcHandle, (uint32_t)(&pstcHandle->u16StopBcstr), 1ul, DMA_SRCADDRINC_FIX);
+    pstcHandle->astcDesc[pstcHandle->u8DescNum - 1u].DARx = (uint32_t)(&pstcHandle->TMRBx->BCSTR);
+
+    /* Chain the descriptors, the one of the stop follows the last interval at once. */
+    for (i = 0ul; (i + 1ul) < (uint32_t)pstcHandle->u8DescNum; i++)
+    {
+        pstcHandle->astcDesc[i].CHxCTL0 |= DMA_LLP_ENABLE |
+                                           (((i + 2ul) == (uint32_t)pstcHandle->u8DescNum) ? DMA_LLP_RUN : DMA_LLP_WAIT) |
+                                           STEPPER_LLP_FIELD((uint32_t)(&pstcHandle->astcDesc[i + 1ul]));
+    }
+
+    pstcHandle->u32TcPatch = 0ul;
+    if (u32Loop > 2ul)
+    {
+        /* Block k of the loop runs descriptor u8Loop + ((k - 1) & 1). The one of the
+           last block is patched to go on after the loop when the one before the
+           previous block completes. */
+        pstcHandle->u8PatchIdx   = u8Loop + (uint8_t)((u32Loop - 1ul) & 1ul);
+        pstcHandle->u32PatchCtl0 = pstcHandle->astcDesc[pstcHandle->u8PatchIdx].CHxCTL0;
+        if (pstcHandle->u8PatchIdx == u8Loop)
+        {
+            pstcHandle->u32PatchCtl0 = (pstcHandle->u32PatchCtl0 & ~STEPPER_LLP_MASK) |
+                                       (pstcHandle->astcDesc[u8Loop + 1u].CHxCTL0 & STEPPER_LLP_MASK);
+        }
+        else
+        {
+            /* rsvd */
+        }
+        pstcHandle->astcDesc[u8Loop + 1u].CHxCTL0 = (pstcHandle->astcDesc[u8Loop + 1u].CHxCTL0 & ~STEPPER_LLP_MASK) |
+                                                    DMA_LLP_ENABLE | DMA_LLP_WAIT |
+                                                    STEPPER_LLP_FIELD((uint32_t)(&pstcHandle->astcDesc[u8Loop]));
+        pstcHandle->u32TcPatch = (uint32_t)u8Loop + u32Loop - 2ul;
+    }
+}
+
+/**
+ * @brief  Load the first descriptor of the move into the DMA channel.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_stepper_handle_t structure
+ * @retval None
+ */
+static void StepperDmaLoad(const stc_stepper_handle_t *pstcHandle)
+{
+    stc_dma_ch_cfg_t stcDmaCfg;
+    const stc_dma_llp_descriptor_t *pstcDesc = &pstcHandle->astcDesc[0u];
+
+    DMA_ChannelDisable(pstcHandle->u8DmaCh);
+
+    stcDmaCfg.u32DataWidth   = DMA_DATAWIDTH_16BIT;
+    stcDmaCfg.u32BlockSize   = 1ul;
+    stcDmaCfg.u32TransferCnt = (pstcDesc->CHxCTL0 & DMA_CH0CTL0_CNT) >> DMA_CH0CTL0_CNT_POS;
+    stcDmaCfg.u32SrcAddr     = pstcDesc->SARx;
+    stcDmaCfg.u32DesAddr     = pstcDesc->DARx;
+    stcDmaCfg.u32SrcInc      = pstcDesc->CHxCTL1 & DMA_CH0CTL1_SINC;
+    stcDmaCfg.u32DesInc      = DMA_DESADDRINC_FIX;
+    DMA_ChannelCfg(pstcHandle->u8DmaCh, &stcDmaCfg);
+
+    if (0ul != (pstcDesc->CHxCTL0 & DMA_LLP_ENABLE))
+    {
+        DMA_LlpInit(pstcHandle->u8DmaCh, pstcDesc->CHxCTL0 & DMA_CH0CTL0_LLPRUN,
+                    (uint32_t)(&pstcHandle->astcDesc[1u]));
+    }
+    else
+    {
+        DMA_LlpCmd(pstcHandle->u8DmaCh, Disable);
+    }
+}
+
+/**
+ * @brief  DMA transfer complete IRQ handler, a block of intervals is written.
+ * @note   The interrupt is disabled when the hardware has disabled the channel at
+ *         the end of the chain, the stop is armed by then.
+ * @param  [in] u8DmaCh                 DMA channel.
+ * @retval None
+ */
+static void StepperDmaTcHandler(uint8_t u8DmaCh)
+{
+    uint32_t u32Cnt;
+    stc_stepper_handle_t *pstcHandle = m_apstcStepperDma[u8DmaCh];
+
+    DMA_ClearCplFlag(u8DmaCh, DMA_FLAG_TC);
+
+    if (NULL != pstcHandle)
+    {
+        u32Cnt = pstcHandle->u32TcCnt + 1ul;
+        pstcHandle->u32TcCnt = u32Cnt;
+        if (u32Cnt == pstcHandle->u32TcPatch)
+        {
+            pstcHandle->astcDesc[pstcHandle->u8PatchIdx].CHxCTL0 = pstcHandle->u32PatchCtl0;
+        }
+        if (0ul == READ_REG32_BIT(M0P_DMA->CHEN, (1ul << u8DmaCh)))
+        {
+            DMA_CplIrqCmd(u8DmaCh, DMA_IRQ_TC, Disable);
+        }
+    }
+}
+
+/**
+ * @brief  TimerB overflow IRQ handler of IRQ mode, step k is done and the interval
+ *         of step k + 1 is written.
+ * @param  [in] u8Unit                  Unit index, 0 ~ 3.
+ * @retval None
+ */
+static void StepperOvfHandler(uint8_t u8Unit)
+{
+    uint32_t u32Step;
+    stc_stepper_handle_t *pstcHandle = m_apstcStepperUnit[u8Unit];
+    M0P_TMRB_TypeDef *TMRBx = m_apstcStepperTmrb[u8Unit];
+
+    TIMERB_ClearFlag(TMRBx, TIMERB_FLAG_OVF);
+
+    if (NULL != pstcHandle)
+    {
+        u32Step = pstcHandle->u32Step + 1ul;
+        pstcHandle->u32Step = u32Step;
+        TIMERB_SetPeriod(TMRBx, StepperInterval(pstcHandle, u32Step));
+        if (u32Step >= pstcHandle->u32Steps)
+        {
+            SET_REG16_BIT(TMRBx->BCSTR, TMRB_BCSTR_OVSTP);
+            TIMERB_IntCmd(TMRBx, TIMERB_IT_OVF, Disable);
+        }
+    }
+}
+
+/**
+ * @brief  DMA channel 0 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void StepperDma0TcIrqCallback(void)
+{
+    StepperDmaTcHandler(DMA_CHANNEL_0);
+}
+
+/**
+ * @brief  DMA channel 1 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void StepperDma1TcIrqCallback(void)
+{
+    StepperDmaTcHandler(DMA_CHANNEL_1);
+}
+
+/**
+ * @brief  TimerB unit 1 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void StepperTmrb1OvfIrqCallback(void)
+{
+    StepperOvfHandler(0u);
+}
+
+/**
+ * @brief  TimerB unit 2 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void StepperTmrb2OvfIrqCallback(void)
+{
+    StepperOvfHandler(1u);
+}
+
+/**
+ * @brief  TimerB unit 3 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void StepperTmrb3OvfIrqCallback(void)
+{
+    StepperOvfHandler(2u);
+}
+
+/**
+ * @brief  TimerB unit 4 overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void StepperTmrb4OvfIrqCallback(void)
+{
+    StepperOvfHandler(3u);
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_STEPPER_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
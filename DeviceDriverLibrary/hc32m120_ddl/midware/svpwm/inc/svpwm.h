@@ -0,0 +1,195 @@
+/**
+ *******************************************************************************
+ * @file  svpwm.h
+ * @brief This file contains all the functions prototypes of the space vector
+ *        PWM midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Hongjh          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __SVPWM_H__
+#define __SVPWM_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_SVPWM
+ * @{
+ */
+
+#if (MW_SVPWM_ENABLE == DDL_ON)
+
+#if (DDL_TIMER4_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMER4_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/* Phases U, V and W. */
+#define SVPWM_PHASE_NUM                 (3u)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SVPWM_Global_Types SVPWM Global Types
+ * @{
+ */
+
+/**
+ * @brief Space vector PWM handle structure definition
+ * @note  The counter of Timer4 runs in triangular wave mode with PCLK, each phase is
+ *        generated by the OCO low channel(TIMER4_OCO_xL) and output by the PWM couple
+ *        channel in dead timer mode: TIM4_<t>_OxH is the OP signal delayed by the dead
+ *        time and TIM4_<t>_OxL is the inverted OP signal delayed by the dead time.
+ */
+typedef struct
+{
+    uint32_t u32PclkFreq;               /*!< Frequency of PCLK(Hz), the clock of the counter and the dead timer. */
+    uint32_t u32PwmFreq;                /*!< PWM frequency(Hz), PCLK / (2 * PWM frequency) must be in [2, 65535]. */
+    uint16_t u16DeadTimeNs;             /*!< Dead time(ns) of the rising edges of TIM4_<t>_OxH and TIM4_<t>_OxL. */
+    uint8_t  u8Mode;                    /*!< Modulation.
+                                             This parameter can be a value of @ref SVPWM_Mode */
+
+    /* Internal state, set by SVPWM_Init() */
+    uint16_t u16Period;                 /*!< Counter cycle value(CPSR). */
+    __IO uint16_t *apu16Occr[SVPWM_PHASE_NUM]; /*!< OCCR of the phases, written back-to-back. */
+} stc_svpwm_handle_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SVPWM_Global_Macros SVPWM Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup SVPWM_Mode SVPWM Mode
+ * @brief The voltage vector is in Q15 and 1.0 is Vdc / sqrt(3), the radius of the
+ *        largest circle in the hexagon.
+ * @{
+ */
+#define SVPWM_MODE_SVPWM                ((uint8_t)0u)   /*!< Min-max zero sequence injection, linear up to 1.0. */
+#define SVPWM_MODE_SINE                 ((uint8_t)1u)   /*!< Sinusoidal, linear up to sqrt(3) / 2. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SVPWM_Angle SVPWM Angle
+ * @brief The electrical angle is an uint16_t, 65536 is one turn.
+ * @{
+ */
+#define SVPWM_ANGLE_90                  ((uint16_t)0x4000u)
+#define SVPWM_ANGLE_180                 ((uint16_t)0x8000u)
+#define SVPWM_ANGLE_270                 ((uint16_t)0xC000u)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SVPWM_Global_Functions
+ * @{
+ */
+en_result_t SVPWM_Init(stc_svpwm_handle_t *pstcHandle);
+en_result_t SVPWM_SetDeadTime(stc_svpwm_handle_t *pstcHandle, uint16_t u16DeadTimeNs);
+void SVPWM_SetVoltageVector(const stc_svpwm_handle_t *pstcHandle,
+                            int16_t i16Alpha, int16_t i16Beta);
+void SVPWM_SetVoltagePolar(const stc_svpwm_handle_t *pstcHandle,
+                           uint16_t u16Amp, uint16_t u16Angle);
+int16_t SVPWM_Sin(uint16_t u16Angle);
+int16_t SVPWM_Cos(uint16_t u16Angle);
+/**
+ * @}
+ */
+
+#endif /* MW_SVPWM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SVPWM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
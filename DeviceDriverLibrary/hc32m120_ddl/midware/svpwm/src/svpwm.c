@@ -0,0 +1,474 @@
+/**
+ *******************************************************************************
+ * @file  svpwm.c
+ * @brief This midware file provides firmware functions to generate the three
+ *        phase space vector PWM by Timer4.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Hongjh          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "svpwm.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_SVPWM SVPWM
+ * @brief Space Vector PWM Midware Library
+ * @{
+ */
+
+#if (MW_SVPWM_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SVPWM_Local_Macros SVPWM Local Macros
+ * @{
+ */
+
+/* OCCR register address of the OCO channel, the same as the Timer4 driver. */
+#define SVPWM_OCCR(ch)                                                         \
+    ((__IO uint16_t *)((uint32_t)(&(M0P_TMR4->OCCRUH)) + ((uint32_t)(ch)) * 4ul))
+
+/* Q15 constants. */
+#define SVPWM_Q15_ONE                   (32768l)
+#define SVPWM_Q15_HALF                  (16384l)
+#define SVPWM_SQRT3_DIV2_Q15            (28378l)    /* sqrt(3) / 2 */
+#define SVPWM_INV_SQRT3_Q15             (18919l)    /* 1 / sqrt(3) */
+
+/* Quarter wave sine table, 64 segments. */
+#define SVPWM_SIN_TBL_SEG               (64ul)
+#define SVPWM_SIN_FRAC_BITS             (8u)
+#define SVPWM_SIN_FRAC_MASK             (0xFFul)
+#define SVPWM_SIN_QUARTER_MASK          (0x3FFFul)
+
+/* Amplitude of SVPWM_SetVoltagePolar(). */
+#define SVPWM_AMP_MAX                   ((uint16_t)0x7FFFu)
+
+#define IS_SVPWM_MODE(x)                                                       \
+(   ((x) == SVPWM_MODE_SVPWM)                   ||                             \
+    ((x) == SVPWM_MODE_SINE))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void SvpwmOcoConfig(uint32_t u32Ch, uint16_t u16OccrVal);
+static uint16_t SvpwmCalcOccr(uint16_t u16Period, int32_t i32Volt);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* sin(i * 90 / 64 degree) in Q15, i = 0 ~ 64. */
+static const uint16_t m_au16SinTbl[SVPWM_SIN_TBL_SEG + 1ul] =
+{
+        0u,   804u,  1608u,  2410u,  3212u,  4011u,  4808u,  5602u,
+     6393u,  7179u,  7962u,  8739u,  9512u, 10278u, 11039u, 11793u,
+    12539u, 13279u, 14010u, 14732u, 15446u, 16151u, 16846u, 17530u,
+    18204u, 18868u, 19519u, 20159u, 20787u, 21403u, 22005u, 22594u,
+    23170u, 23731u, 24279u, 24811u, 25329u, 25832u, 26319u, 26790u,
+    27245u, 27683u, 28105u, 28510u, 28898u, 29268u, 29621u, 29956u,
+    30273u, 30571u, 30852u, 31113u, 31356u, 31580u, 31785u, 31971u,
+    32137u, 32285u, 32412u, 32521u, 32609u, 32678u, 32728u, 32757u,
+    32767u,
+};
+
+/* OCO low channels and PWM couple channels of the phases. */
+static const uint32_t m_au32OcoCh[SVPWM_PHASE_NUM] =
+{
+    TIMER4_OCO_UL, TIMER4_OCO_VL, TIMER4_OCO_WL,
+};
+
+static const uint32_t m_au32PwmCh[SVPWM_PHASE_NUM] =
+{
+    TIMER4_PWM_U, TIMER4_PWM_V, TIMER4_PWM_W,
+};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SVPWM_Global_Functions SVPWM Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the counter, the OCO low channels and the PWM couple channels
+ *         of Timer4 for the space vector PWM, the duty of the phases is 50%.
+ * @note   1. The clock of Timer4 and the TIM4_<t>_OxH/OxL pins are configured by the
+ *            application, call TIMER4_CNT_Start() to start the PWM.
+ *         2. OCCR is buffered and transferred when the counter is 0x0000, the duties of
+ *            the three phases set by SVPWM_SetVoltageVector() take effect together at
+ *            the valley, that is the center of the low side on time.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_svpwm_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, or the PWM frequency is out of range
+ */
+en_result_t SVPWM_Init(stc_svpwm_handle_t *pstcHandle)
+{
+    uint8_t i;
+    uint32_t u32Period;
+    stc_timer4_cnt_init_t stcCntInit;
+    stc_timer4_pwm_init_t stcPwmInit;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && (0ul != pstcHandle->u32PwmFreq))
+    {
+        DDL_ASSERT(IS_SVPWM_MODE(pstcHandle->u8Mode));
+
+        /* Triangular wave: one PWM cycle is 2 * CPSR counts. */
+        u32Period = pstcHandle->u32PclkFreq / (2ul * pstcHandle->u32PwmFreq);
+        if ((u32Period >= 2ul) && (u32Period <= 0xFFFFul))
+        {
+            pstcHandle->u16Period = (uint16_t)u32Period;
+
+            TIMER4_CNT_StructInit(&stcCntInit);
+            stcCntInit.u16CycleVal = pstcHandle->u16Period;
+            stcCntInit.u16CntMode = TIMER4_CNT_MODE_TRIANGLE_WAVE;
+            stcCntInit.u16ClkSrc = TIMER4_CNT_PCLK;
+            stcCntInit.u16ClkDiv = TIMER4_CNT_CLK_DIV1;
+            TIMER4_CNT_Init(&stcCntInit);
+
+            TIMER4_PWM_StructInit(&stcPwmInit);
+            stcPwmInit.u16Mode = TIMER4_PWM_DEAD_TIMER_MODE;
+            stcPwmInit.u16ClkDiv = TIMER4_PWM_CLK_DIV1;
+
+            for (i = 0u; i < SVPWM_PHASE_NUM; i++)
+            {
+                SvpwmOcoConfig(m_au32OcoCh[i], pstcHandle->u16Period - (pstcHandle->u16Period >> 1u));
+                pstcHandle->apu16Occr[i] = SVPWM_OCCR(m_au32OcoCh[i]);
+                TIMER4_PWM_Init(m_au32PwmCh[i], &stcPwmInit);
+            }
+
+            enRet = SVPWM_SetDeadTime(pstcHandle, pstcHandle->u16DeadTimeNs);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the dead time of the three phases.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_svpwm_handle_t structure
+ * @param  [in] u16DeadTimeNs           Dead time(ns), rounded up to PCLK cycles.
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Success
+ *           - ErrorInvalidParameter: pstcHandle == NULL
+ */
+en_result_t SVPWM_SetDeadTime(stc_svpwm_handle_t *pstcHandle, uint16_t u16DeadTimeNs)
+{
+    uint8_t i;
+    uint32_t u32Cnt;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcHandle)
+    {
+        /* 65535ns * 48000kHz does not overflow. */
+        u32Cnt = ((uint32_t)u16DeadTimeNs * (pstcHandle->u32PclkFreq / 1000ul) + 999999ul) / 1000000ul;
+        if (u32Cnt > 0xFFFFul)
+        {
+            u32Cnt = 0xFFFFul;
+        }
+
+        pstcHandle->u16DeadTimeNs = u16DeadTimeNs;
+        for (i = 0u; i < SVPWM_PHASE_NUM; i++)
+        {
+            (void)TIMER4_PWM_SetDeadRegionValue(m_au32PwmCh[i], (uint16_t)u32Cnt, (uint16_t)u32Cnt);
+        }
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Set the voltage vector in the stationary frame.
+ * @note   1. The three OCCR buffers are written back-to-back after all the duties are
+ *            calculated. Call it right after the valley, e.g. in the sample callback of
+ *            the PWM synchronous ADC sampling at the valley, so that the buffer transfer
+ *            at the next valley never splits the three writes.
+ *         2. No division, the vector outside of the linear range is clamped phase by phase.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_svpwm_handle_t structure
+ * @param  [in] i16Alpha                Alpha component in Q15, see @ref SVPWM_Mode.
+ * @param  [in] i16Beta                 Beta component in Q15, see @ref SVPWM_Mode.
+ * @retval None
+ */
+void SVPWM_SetVoltageVector(const stc_svpwm_handle_t *pstcHandle,
+                            int16_t i16Alpha, int16_t i16Beta)
+{
+    int32_t i32Va;
+    int32_t i32Vb;
+    int32_t i32Vc;
+    int32_t i32Max;
+    int32_t i32Min;
+    int32_t i32HalfAlpha;
+    int32_t i32BetaK;
+    uint16_t u16OccrU;
+    uint16_t u16OccrV;
+    uint16_t u16OccrW;
+
+    DDL_ASSERT(NULL != pstcHandle);
+
+    /* Inverse Clarke transformation. */
+    i32HalfAlpha = (int32_t)i16Alpha >> 1u;
+    i32BetaK = ((int32_t)i16Beta * SVPWM_SQRT3_DIV2_Q15) >> 15u;
+    i32Va = (int32_t)i16Alpha;
+    i32Vb = i32BetaK - i32HalfAlpha;
+    i32Vc = -i32BetaK - i32HalfAlpha;
+
+    if (SVPWM_MODE_SVPWM == pstcHandle->u8Mode)
+    {
+        /* Zero sequence -(max + min) / 2 centers the three phases. */
+        i32Max = i32Va;
+        i32Min = i32Va;
+        if (i32Vb > i32Max)
+        {
+            i32Max = i32Vb;
+        }
+        else
+        {
+            i32Min = i32Vb;
+        }
+        if (i32Vc > i32Max)
+        {
+            i32Max = i32Vc;
+        }
+        if (i32Vc < i32Min)
+        {
+            i32Min = i32Vc;
+        }
+
+        i32Max = (i32Max + i32Min) >> 1u;
+        i32Va -= i32Max;
+        i32Vb -= i32Max;
+        i32Vc -= i32Max;
+    }
+
+    u16OccrU = SvpwmCalcOccr(pstcHandle->u16Period, i32Va);
+    u16OccrV = SvpwmCalcOccr(pstcHandle->u16Period, i32Vb);
+    u16OccrW = SvpwmCalcOccr(pstcHandle->u16Period, i32Vc);
+
+    *pstcHandle->apu16Occr[0] = u16OccrU;
+    *pstcHandle->apu16Occr[1] = u16OccrV;
+    *pstcHandle->apu16Occr[2] = u16OccrW;
+}
+
+/**
+ * @brief  Set the voltage vector by the amplitude and the electrical angle.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_svpwm_handle_t structure
+ * @param  [in] u16Amp                  Amplitude in Q15, 0 ~ 32767, see @ref SVPWM_Mode.
+ * @param  [in] u16Angle                Electrical angle, see @ref SVPWM_Angle.
+ * @retval None
+ */
+void SVPWM_SetVoltagePolar(const stc_svpwm_handle_t *pstcHandle,
+                           uint16_t u16Amp, uint16_t u16Angle)
+{
+    int32_t i32Alpha;
+    int32_t i32Beta;
+
+    if (u16Amp > SVPWM_AMP_MAX)
+    {
+        u16Amp = SVPWM_AMP_MAX;
+    }
+
+    i32Alpha = ((int32_t)u16Amp * (int32_t)SVPWM_Cos(u16Angle)) >> 15u;
+    i32Beta  = ((int32_t)u16Amp * (int32_t)SVPWM_Sin(u16Angle)) >> 15u;
+
+    SVPWM_SetVoltageVector(pstcHandle, (int16_t)i32Alpha, (int16_t)i32Beta);
+}
+
+/**
+ * @brief  Sine of the electrical angle, interpolated linearly in the quarter wave table.
+ * @param  [in] u16Angle                Electrical angle, see @ref SVPWM_Angle.
+ * @retval Sine in Q15, -32767 ~ 32767.
+ */
+int16_t SVPWM_Sin(uint16_t u16Angle)
+{
+    uint32_t u32Pos = (uint32_t)u16Angle & SVPWM_SIN_QUARTER_MASK;
+    uint32_t u32Idx;
+    uint32_t u32Frac;
+    int32_t i32Val;
+
+    /* The second and the fourth quadrants are mirrored, 0x4000 is the last entry. */
+    if (0u != (u16Angle & SVPWM_ANGLE_90))
+    {
+        u32Pos = (SVPWM_SIN_QUARTER_MASK + 1ul) - u32Pos;
+    }
+
+    u32Idx  = u32Pos >> SVPWM_SIN_FRAC_BITS;
+    u32Frac = u32Pos & SVPWM_SIN_FRAC_MASK;
+    i32Val  = (int32_t)m_au16SinTbl[u32Idx];
+    if (u32Idx < SVPWM_SIN_TBL_SEG)
+    {
+        i32Val += (((int32_t)m_au16SinTbl[u32Idx + 1ul] - i32Val) * (int32_t)u32Frac) >> SVPWM_SIN_FRAC_BITS;
+    }
+
+    if (0u != (u16Angle & SVPWM_ANGLE_180))
+    {
+        i32Val = -i32Val;
+    }
+
+    return (int16_t)i32Val;
+}
+
+/**
+ * @brief  Cosine of the electrical angle.
+ * @param  [in] u16Angle                Electrical angle, see @ref SVPWM_Angle.
+ * @retval Cosine in Q15, -32767 ~ 32767.
+ */
+int16_t SVPWM_Cos(uint16_t u16Angle)
+{
+    return SVPWM_Sin((uint16_t)(u16Angle + SVPWM_ANGLE_90));
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SVPWM_Local_Functions SVPWM Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Configure an OCO low channel, OP is high when the counter is above OCCR.
+ * @param  [in] u32Ch                   Timer4 OCO low channel.
+ * @param  [in] u16OccrVal              Initial compare value.
+ * @retval None
+ */
+static void SvpwmOcoConfig(uint32_t u32Ch, uint16_t u16OccrVal)
+{
+    stc_timer4_oco_init_t stcOcoInit;
+    stc_oco_low_ch_compare_mode_t stcLowChCmpMode;
+
+    TIMER4_OCO_StructInit(&stcOcoInit);
+    stcOcoInit.u16OccrVal = u16OccrVal;
+    stcOcoInit.u16OccrBufMode = TIMER4_OCO_OCCR_BUF_CNT_ZERO;
+    stcOcoInit.enOccrLinkTransfer = Disable;
+    stcOcoInit.enOcoCmd = Enable;
+    (void)TIMER4_OCO_Init(u32Ch, &stcOcoInit);
+
+    /* OCCR = 0 matches at zero only: always high. OCCR = CPSR matches at the peak
+       only: always low. The high channel is unused, the extended states follow. */
+    stcLowChCmpMode.OCMRx = 0ul;
+    stcLowChCmpMode.OCMRx_f.OPDCL = TIMER4_OCO_OP_LOW;
+    stcLowChCmpMode.OCMRx_f.OPPKL = TIMER4_OCO_OP_LOW;
+    stcLowChCmpMode.OCMRx_f.OPUCL = TIMER4_OCO_OP_HIGH;
+    stcLowChCmpMode.OCMRx_f.OPZRL = TIMER4_OCO_OP_HIGH;
+    stcLowChCmpMode.OCMRx_f.OPNPKL = TIMER4_OCO_OP_HOLD;
+    stcLowChCmpMode.OCMRx_f.OPNZRL = TIMER4_OCO_OP_HOLD;
+    stcLowChCmpMode.OCMRx_f.EOPNDCL = TIMER4_OCO_OP_HOLD;
+    stcLowChCmpMode.OCMRx_f.EOPNUCL = TIMER4_OCO_OP_HOLD;
+    stcLowChCmpMode.OCMRx_f.EOPDCL = TIMER4_OCO_OP_LOW;
+    stcLowChCmpMode.OCMRx_f.EOPPKL = TIMER4_OCO_OP_LOW;
+    stcLowChCmpMode.OCMRx_f.EOPUCL = TIMER4_OCO_OP_HIGH;
+    stcLowChCmpMode.OCMRx_f.EOPZRL = TIMER4_OCO_OP_HIGH;
+    stcLowChCmpMode.OCMRx_f.EOPNPKL = TIMER4_OCO_OP_HOLD;
+    stcLowChCmpMode.OCMRx_f.EOPNZRL = TIMER4_OCO_OP_HOLD;
+    stcLowChCmpMode.enExtendMatchCondCmd = Disable;
+    (void)TIMER4_OCO_SetLowChCompareMode(u32Ch, &stcLowChCmpMode);
+}
+
+/**
+ * @brief  Calculate OCCR of a phase voltage.
+ * @param  [in] u16Period               Counter cycle value(CPSR).
+ * @param  [in] i32Volt                 Phase voltage in Q15, see @ref SVPWM_Mode.
+ * @retval OCCR value, 0 ~ CPSR.
+ */
+static uint16_t SvpwmCalcOccr(uint16_t u16Period, int32_t i32Volt)
+{
+    /* Duty = 1/2 + v / sqrt(3), in Q15. */
+    int32_t i32Duty = SVPWM_Q15_HALF + ((i32Volt * SVPWM_INV_SQRT3_Q15) >> 15u);
+
+    if (i32Duty < 0l)
+    {
+        i32Duty = 0l;
+    }
+    else if (i32Duty > SVPWM_Q15_ONE)
+    {
+        i32Duty = SVPWM_Q15_ONE;
+    }
+
+    return (uint16_t)(u16Period - (uint16_t)(((uint32_t)i32Duty * (uint32_t)u16Period) >> 15u));
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_SVPWM_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
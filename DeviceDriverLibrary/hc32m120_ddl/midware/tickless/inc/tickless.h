@@ -0,0 +1,205 @@
+/**
+ *******************************************************************************
+ * @file  tickless.h
+ * @brief This file contains all the functions prototypes of the tickless idle
+ *        midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __TICKLESS_H__
+#define __TICKLESS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_TICKLESS
+ * @{
+ */
+
+#if (MW_TICKLESS_ENABLE == DDL_ON)
+
+#if (DDL_TIMER2_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMER2_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_PWC_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_PWC_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_UTILITY_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_UTILITY_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Global_Types TICKLESS Global Types
+ * @{
+ */
+
+/**
+ * @brief Tickless idle configuration structure definition
+ * @note  TIMER2 counts LRC, which keeps running in stop mode, and wakes the CPU by
+ *        the counter match interrupt. The clock of TIMER2 and the LRC are enabled
+ *        by the application, the SysTick is initialized by SysTick_Init().
+ *        TIMER2 runs from TICKLESS_Init() on, between the idles the match
+ *        interrupt occurs once per 65536 counts at the wrap of the counter.
+ */
+typedef struct
+{
+    uint16_t u16ClkPrescaler;           /*!< Prescaler of LRC, the longest idle is 65536 * prescaler / 32768 seconds.
+                                             This parameter can be a value of @ref TICKLESS_Clock_Prescaler */
+    uint8_t  u8HPorSel;                 /*!< High POR in stop mode.
+                                             This parameter can be a value of @ref PWC_HPOR_config */
+    uint8_t  u8HrcSel;                  /*!< System clock after stop mode.
+                                             This parameter can be a value of @ref PWC_CKSHRC_config */
+    uint32_t u32MinIdleMs;              /*!< A shorter idle only waits for an interrupt, with the SysTick running. */
+    IRQn_Type enIRQn;                   /*!< IRQ number of INT_TMR2_GCMP, Int018_IRQn or Int019_IRQn. */
+} stc_tickless_cfg_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Global_Macros TICKLESS Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TICKLESS_Clock_Prescaler TICKLESS Clock Prescaler
+ * @{
+ */
+#define TICKLESS_CLK_PRESCALER_1        (TIMER2_CLK_PRESCALER_1)    /*!< Up to 2 seconds, resolution 30.5us. */
+#define TICKLESS_CLK_PRESCALER_2        (TIMER2_CLK_PRESCALER_2)
+#define TICKLESS_CLK_PRESCALER_4        (TIMER2_CLK_PRESCALER_4)
+#define TICKLESS_CLK_PRESCALER_8        (TIMER2_CLK_PRESCALER_8)
+#define TICKLESS_CLK_PRESCALER_16       (TIMER2_CLK_PRESCALER_16)
+#define TICKLESS_CLK_PRESCALER_32       (TIMER2_CLK_PRESCALER_32)   /*!< Up to 64 seconds, resolution 977us. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TICKLESS_Idle_Mode TICKLESS Idle Mode
+ * @{
+ */
+#define TICKLESS_MODE_WFI               ((uint8_t)0u)   /*!< Short idle, waited for an interrupt with the SysTick running. */
+#define TICKLESS_MODE_SLEEP             ((uint8_t)1u)   /*!< Sleep mode, stop mode is locked. */
+#define TICKLESS_MODE_STOP              ((uint8_t)2u)   /*!< Stop mode. */
+/**
+ * @}
+ */
+
+/* No deadline, idle as long as TIMER2 can count. */
+#define TICKLESS_IDLE_FOREVER           (0xFFFFFFFFul)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TICKLESS_Global_Functions
+ * @{
+ */
+en_result_t TICKLESS_Init(const stc_tickless_cfg_t *pstcCfg);
+void TICKLESS_StopLock(void);
+void TICKLESS_StopUnlock(void);
+uint32_t TICKLESS_Idle(uint32_t u32IdleMs);
+uint8_t TICKLESS_GetLastMode(void);
+/**
+ * @}
+ */
+
+#endif /* MW_TICKLESS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TICKLESS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,471 @@
+/**
+ *******************************************************************************
+ * @file  tickless.c
+ * @brief This midware file provides firmware functions to idle until the next
+ *        deadline in sleep or stop mode, timed by TIMER2 on LRC.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Chengy          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "tickless.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_TICKLESS TICKLESS
+ * @brief Tickless Idle Midware Library
+ * @{
+ */
+
+#if (MW_TICKLESS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Local_Macros TICKLESS Local Macros
+ * @{
+ */
+
+/* LRC cycles per second is 2^15. */
+#define TICKLESS_LRC_SHIFT              (15u)
+#define TICKLESS_LRC_FRAC_MASK          ((1ul << TICKLESS_LRC_SHIFT) - 1ul)
+
+/* A write to TIMER2 is synchronized in 3 LRC cycles. */
+#define TICKLESS_SYNC_CYCLE             (3ul)
+
+#define TICKLESS_COUNT_MAX              (0xFFFFul)
+
+#define IS_TICKLESS_CLK_PRESCALER(x)                                           \
+(   ((x) == TICKLESS_CLK_PRESCALER_1)           ||                             \
+    ((x) == TICKLESS_CLK_PRESCALER_2)           ||                             \
+    ((x) == TICKLESS_CLK_PRESCALER_4)           ||                             \
+    ((x) == TICKLESS_CLK_PRESCALER_8)           ||                             \
+    ((x) == TICKLESS_CLK_PRESCALER_16)          ||                             \
+    ((x) == TICKLESS_CLK_PRESCALER_32))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static uint32_t TicklessMsToCount(uint32_t u32Ms);
+static uint16_t TicklessReadCnt(void);
+static uint32_t TicklessElapsedCount(uint16_t u16StartCnt, uint32_t u32Cmp);
+static void TicklessCmpIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/* log2 of the prescaler, 0 ~ 5. */
+static uint32_t m_u32PrescalerShift = 0ul;
+static uint32_t m_u32MinIdleMs = 0ul;
+static __IO uint32_t m_u32StopLock = 0ul;
+static uint8_t m_u8LastMode = TICKLESS_MODE_WFI;
+
+/* Idle time not added to the SysTick yet, in 1/1000 LRC cycles. */
+static uint32_t m_u32FracTime = 0ul;
+/* Counter of TIMER2 at the last write to TIMER2. */
+static uint16_t m_u16WriteCnt = 0u;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TICKLESS_Global_Functions TICKLESS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the tickless idle: TIMER2, the stop mode and the wake up source.
+ * @note   TIMER2 is used by the tickless idle only.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_tickless_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcCfg == NULL
+ */
+en_result_t TICKLESS_Init(const stc_tickless_cfg_t *pstcCfg)
+{
+    stc_timer2_config_t stcTmr2Cfg;
+    stc_pwc_stop_cfg_t stcStopCfg;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if (NULL != pstcCfg)
+    {
+        DDL_ASSERT(IS_TICKLESS_CLK_PRESCALER(pstcCfg->u16ClkPrescaler));
+
+        m_u32PrescalerShift = (uint32_t)pstcCfg->u16ClkPrescaler >> TMR2_BCONR_CKDIVA_POS;
+        m_u32MinIdleMs = pstcCfg->u32MinIdleMs;
+        m_u32StopLock = 0ul;
+        m_u32FracTime = 0ul;
+        m_u8LastMode = TICKLESS_MODE_WFI;
+
+        TIMER2_DeInit();
+        (void)TIMER2_StructInit(&stcTmr2Cfg);
+        stcTmr2Cfg.u16ClkSource = TIMER2_ASYNC_CS_LRC;
+        stcTmr2Cfg.u16ClkPrescaler = pstcCfg->u16ClkPrescaler;
+        stcTmr2Cfg.u16CompareVal = (uint16_t)TICKLESS_COUNT_MAX;
+        stcTmr2Cfg.enMatchIntCmd = Enable;
+        (void)TIMER2_TimerConfig(&stcTmr2Cfg);
+        /* TIMER2 runs from now on, the counter counts from 0 once the start is
+           synchronized. */
+        TIMER2_Start();
+        m_u16WriteCnt = 0u;
+
+        stcStopCfg.u8HPorSel = pstcCfg->u8HPorSel;
+        stcStopCfg.u8HrcSel = pstcCfg->u8HrcSel;
+        (void)PWC_StopMdConfig(&stcStopCfg);
+
+        INTC_WakeupSrcCmd(INTC_WUPENR_TMR2CMPWUEN, Enable);
+
+        /* Register counter match IRQ handler && configure NVIC. */
+        stcIrqRegiConf.enIRQn = pstcCfg->enIRQn;
+        stcIrqRegiConf.enIntSrc = INT_TMR2_GCMP;
+        stcIrqRegiConf.pfnCallback = &TicklessCmpIrqCallback;
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Forbid the stop mode, the idle uses the sleep mode instead.
+ * @note   Called by a driver which needs HCLK, e.g. before a transfer by USART
+ *         or DMA. The calls are counted and nest.
+ * @param  None
+ * @retval None
+ */
+void TICKLESS_StopLock(void)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    m_u32StopLock++;
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Allow the stop mode again, one call for each TICKLESS_StopLock().
+ * @param  None
+ * @retval None
+ */
+void TICKLESS_StopUnlock(void)
+{
+    uint32_t u32Primask = __get_PRIMASK();
+
+    __disable_irq();
+    if (m_u32StopLock > 0ul)
+    {
+        m_u32StopLock--;
+    }
+    __set_PRIMASK(u32Primask);
+}
+
+/**
+ * @brief  Idle until the deadline or an interrupt, whichever is first.
+ * @note   1. The SysTick and its interrupt are stopped during the idle, TIMER2 wakes
+ *            the CPU at the deadline and the idle time is added to the SysTick
+ *            tick by SysTick_AddTick(). The part less than 1ms is carried to the
+ *            next idle, so the SysTick tick does not drift.
+ *         2. The deepest allowed mode is used: stop mode, or sleep mode while the
+ *            stop mode is locked by TICKLESS_StopLock(). Timers clocked by HCLK or
+ *            PCLK do not count in stop mode.
+ *         3. The deadline is computed and this function is called with the
+ *            interrupts disabled, so that an interrupt between them which moves
+ *            the deadline ends the idle at once. The interrupt is served after
+ *            the caller enables the interrupts.
+ *         4. TIMER2 is never stopped, its counter wraps at TICKLESS_COUNT_MAX. The
+ *            idle only sets the compare value ahead of the counter. The counter
+ *            also proves that the last write to TIMER2 is synchronized, so the
+ *            idle delays the LRC synchronization time only when it follows the
+ *            last write within that time.
+ * @param  [in] u32IdleMs               Milliseconds to the next deadline, or TICKLESS_IDLE_FOREVER.
+ *                                      It is cut to the longest time TIMER2 can count,
+ *                                      and at the wrap of the counter.
+ * @retval Milliseconds added to the SysTick tick.
+ */
+uint32_t TICKLESS_Idle(uint32_t u32IdleMs)
+{
+    uint32_t u32Primask;
+    uint32_t u32SysTickCtrl;
+    uint32_t u32Count;
+    uint32_t u32Cmp;
+    uint16_t u16Cnt;
+    uint16_t u16StartCnt;
+    uint32_t u32Ms = 0ul;
+    /* The synchronization time of the compare value in counts, plus one count. */
+    const uint32_t u32MinCount = (TICKLESS_SYNC_CYCLE >> m_u32PrescalerShift) + 2ul;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (u32IdleMs < m_u32MinIdleMs)
+    {
+        m_u8LastMode = TICKLESS_MODE_WFI;
+        __WFI();
+    }
+    else
+    {
+        u32Count = TicklessMsToCount(u32IdleMs);
+        if (u32Count < u32MinCount)
+        {
+            u32Count = u32MinCount;
+        }
+
+        /* The last writes to TIMER2 are synchronized. */
+        u16Cnt = TicklessReadCnt();
+        if (Reset == DDL_LrcSyncCntElapsed(m_u16WriteCnt, u16Cnt, m_u32PrescalerShift))
+        {
+            DDL_LrcSyncDelay();
+        }
+        /* A match at the wrap while the interrupts are disabled. */
+        if (Set == TIMER2_GetFlag(TIMER2_FLAG_CNT_MATCH))
+        {
+            TIMER2_ClrFlag(TIMER2_FLAG_CNT_MATCH);
+        }
+
+        /* The compare value is at least u32MinCount ahead, the counter cannot
+           pass it before it is synchronized. Beyond the wrap, TICKLESS_COUNT_MAX
+           stays the compare value. */
+        u16StartCnt = TicklessReadCnt();
+        u32Cmp = TICKLESS_COUNT_MAX;
+        if (((uint32_t)u16StartCnt + u32Count) < TICKLESS_COUNT_MAX)
+        {
+            u32Cmp = (uint32_t)u16StartCnt + u32Count;
+            TIMER2_SetCompareVal((uint16_t)u32Cmp);
+        }
+        m_u16WriteCnt = TicklessReadCnt();
+
+        u32SysTickCtrl = SysTick->CTRL;
+
+        SysTick->CTRL = u32SysTickCtrl & ~(SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk);
+
+        if (0ul == m_u32StopLock)
+        {
+            m_u8LastMode = TICKLESS_MODE_STOP;
+            PWC_EnterStopMode();
+        }
+        else
+        {
+            m_u8LastMode = TICKLESS_MODE_SLEEP;
+            PWC_EnterSleepMode();
+        }
+
+        u32Count = TicklessElapsedCount(u16StartCnt, u32Cmp);
+        /* The compare value of the idle is synchronized before the next write. */
+        if (Reset == DDL_LrcSyncCntElapsed(m_u16WriteCnt, TicklessReadCnt(), m_u32PrescalerShift))
+        {
+            DDL_LrcSyncDelay();
+        }
+        if (TICKLESS_COUNT_MAX != u32Cmp)
+        {
+            TIMER2_SetCompareVal((uint16_t)TICKLESS_COUNT_MAX);
+        }
+        TIMER2_ClrFlag(TIMER2_FLAG_CNT_MATCH);
+        m_u16WriteCnt = TicklessReadCnt();
+
+        if (0ul != u32Count)
+        {
+            m_u32FracTime += (u32Count << m_u32PrescalerShift) * 1000ul;
+            u32Ms = m_u32FracTime >> TICKLESS_LRC_SHIFT;
+            m_u32FracTime &= TICKLESS_LRC_FRAC_MASK;
+            SysTick_AddTick(u32Ms);
+        }
+
+        SysTick->CTRL = u32SysTickCtrl;
+    }
+
+    __set_PRIMASK(u32Primask);
+
+    return u32Ms;
+}
+
+/**
+ * @brief  Get the mode used by the last TICKLESS_Idle().
+ * @param  None
+ * @retval A value of @ref TICKLESS_Idle_Mode
+ */
+uint8_t TICKLESS_GetLastMode(void)
+{
+    return m_u8LastMode;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TICKLESS_Local_Functions TICKLESS Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Convert the idle time to the TIMER2 count, rounded down.
+ * @param  [in] u32Ms                   Milliseconds.
+ * @retval Count of TIMER2, 1 ~ TICKLESS_COUNT_MAX.
+ */
+static uint32_t TicklessMsToCount(uint32_t u32Ms)
+{
+    uint32_t u32Count = TICKLESS_COUNT_MAX;
+    /* The longest idle: 65535 counts is more than 1999ms with the prescaler 1. */
+    const uint32_t u32MaxMs = 1999ul << m_u32PrescalerShift;
+
+    if (u32Ms < u32MaxMs)
+    {
+        u32Count = (u32Ms << TICKLESS_LRC_SHIFT) / (1000ul << m_u32PrescalerShift);
+        if (0ul == u32Count)
+        {
+            u32Count = 1ul;
+        }
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Read the counter of TIMER2.
+ * @note   The counter runs on LRC, it is read until two reads agree.
+ * @param  None
+ * @retval The counter.
+ */
+static uint16_t TicklessReadCnt(void)
+{
+    uint16_t u16Cnt;
+
+    do
+    {
+        u16Cnt = TIMER2_GetCounterVal();
+    } while (u16Cnt != TIMER2_GetCounterVal());
+
+    return u16Cnt;
+}
+
+/**
+ * @brief  Read the TIMER2 counts since the start of the idle.
+ * @note   The counter is cleared at the next count after the match, the match
+ *         flag tells whether the counter passed the compare value. The counter
+ *         cannot reach the compare value before it is synchronized.
+ * @param  [in] u16StartCnt             Counter at the start of the idle.
+ * @param  [in] u32Cmp                  Compare value of the idle.
+ * @retval Counts since the start of the idle.
+ */
+static uint32_t TicklessElapsedCount(uint16_t u16StartCnt, uint32_t u32Cmp)
+{
+    en_flag_status_t enMatch;
+    uint32_t u32Count;
+    uint16_t u16Cnt;
+
+    do
+    {
+        enMatch = TIMER2_GetFlag(TIMER2_FLAG_CNT_MATCH);
+        u16Cnt = TicklessReadCnt();
+    } while (enMatch != TIMER2_GetFlag(TIMER2_FLAG_CNT_MATCH));
+
+    if (Set == enMatch)
+    {
+        u32Count = (u32Cmp - (uint32_t)u16StartCnt) + 1ul + (uint32_t)u16Cnt;
+    }
+    else
+    {
+        u32Count = (uint32_t)u16Cnt - (uint32_t)u16StartCnt;
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  TIMER2 counter match IRQ callback, only wakes the CPU.
+ * @param  None
+ * @retval None
+ */
+static void TicklessCmpIrqCallback(void)
+{
+    if (Set == TIMER2_GetFlag(TIMER2_FLAG_CNT_MATCH))
+    {
+        TIMER2_ClrFlag(TIMER2_FLAG_CNT_MATCH);
+        m_u16WriteCnt = TicklessReadCnt();
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_TICKLESS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
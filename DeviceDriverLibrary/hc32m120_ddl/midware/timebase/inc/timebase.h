@@ -0,0 +1,165 @@
+/**
+ *******************************************************************************
+ * @file  timebase.h
+ * @brief This file contains all the functions prototypes of the timebase
+ *        midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Hongjh          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __TIMEBASE_H__
+#define __TIMEBASE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_TIMEBASE
+ * @{
+ */
+
+#if (MW_TIMEBASE_ENABLE == DDL_ON)
+
+#if (DDL_TIMERB_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_TIMERB_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TIMEBASE_Global_Types TIMEBASE Global Types
+ * @{
+ */
+
+/**
+ * @brief Timebase configuration structure definition
+ * @note  The low unit counts HCLK / division, the high unit counts the overflows
+ *        of the low unit, together they are a 32 bits free running counter. The
+ *        overflow interrupt of the high unit extends it to 64 bits. The units
+ *        are a pair: M0P_TMRB1 and M0P_TMRB2, or M0P_TMRB3 and M0P_TMRB4, in
+ *        either order. Their clocks are enabled by the application.
+ */
+typedef struct
+{
+    M0P_TMRB_TypeDef *TMRBLow;          /*!< TimerB unit of the low 16 bits. */
+    M0P_TMRB_TypeDef *TMRBHigh;         /*!< TimerB unit of the high 16 bits. */
+    uint16_t  u16ClkDiv;                /*!< Tick = the clock division / HCLK.
+                                             This parameter can be a value of @ref TIMERB_Count_Clock_Division */
+    en_int_src_t enIntSrc;              /*!< Overflow interrupt of the high unit, INT_TMRB_x_OVF. */
+    IRQn_Type enIRQn;                   /*!< IRQ number of the overflow interrupt. */
+} stc_timebase_cfg_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TIMEBASE_Global_Functions
+ * @{
+ */
+en_result_t TIMEBASE_Init(const stc_timebase_cfg_t *pstcCfg);
+uint32_t TIMEBASE_GetTickFreq(void);
+
+uint32_t TIMEBASE_GetTick32(void);
+uint64_t TIMEBASE_GetTick64(void);
+uint32_t TIMEBASE_GetUs32(void);
+uint64_t TIMEBASE_GetUs64(void);
+
+uint32_t TIMEBASE_TickToUs(uint32_t u32Tick);
+uint32_t TIMEBASE_TickToNs(uint32_t u32Tick);
+uint32_t TIMEBASE_UsToTick(uint32_t u32Us);
+/**
+ * @}
+ */
+
+#endif /* MW_TIMEBASE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TIMEBASE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
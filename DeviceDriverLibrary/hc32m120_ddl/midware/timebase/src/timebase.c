@@ -0,0 +1,448 @@
+/**
+ *******************************************************************************
+ * @file  timebase.c
+ * @brief This midware file provides firmware functions to manage the free
+ *        running timebase on two cascaded TimerB units.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Hongjh          First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "timebase.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_TIMEBASE TIMEBASE
+ * @brief Timebase Midware Library
+ * @{
+ */
+
+#if (MW_TIMEBASE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TIMEBASE_Local_Types TIMEBASE Local Types
+ * @{
+ */
+
+/**
+ * @brief Unit conversion by multiply and shift: y = (x * u32Mult) >> u32Shift.
+ */
+typedef struct
+{
+    uint32_t u32Mult;
+    uint32_t u32Shift;
+} stc_timebase_factor_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TIMEBASE_Local_Macros TIMEBASE Local Macros
+ * @{
+ */
+
+/* The high unit counts the overflow of the low unit a few HCLK cycles later.
+   A low half less than this time after the wrap is read again, the high half
+   may not be updated yet. The guard in low unit counts scales with the division. */
+#define TIMEBASE_WRAP_CLK               (8ul)
+
+#define TIMEBASE_US_PER_S               (1000000ul)
+#define TIMEBASE_NS_PER_S               (1000000000ul)
+
+#define IS_TIMEBASE_UNIT_PAIR(low, high)                                       \
+(   (((low) == M0P_TMRB1) && ((high) == M0P_TMRB2))    ||                      \
+    (((low) == M0P_TMRB2) && ((high) == M0P_TMRB1))    ||                      \
+    (((low) == M0P_TMRB3) && ((high) == M0P_TMRB4))    ||                      \
+    (((low) == M0P_TMRB4) && ((high) == M0P_TMRB3)))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void TimebaseFactorInit(stc_timebase_factor_t *pstcFactor,
+                               uint32_t u32Num, uint32_t u32Den);
+static uint32_t TimebaseMulShift(uint32_t u32Val, const stc_timebase_factor_t *pstcFactor);
+static uint32_t TimebaseRead32(void);
+static void TimebaseOvfIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static M0P_TMRB_TypeDef *m_pstcTimebaseLow = NULL;
+static M0P_TMRB_TypeDef *m_pstcTimebaseHigh = NULL;
+
+/* Bits 32 ~ 63 of the tick, counted by the overflow interrupt. */
+static __IO uint32_t m_u32TickExt = 0ul;
+
+static uint32_t m_u32TickFreq = 0ul;
+/* Low unit counts of TIMEBASE_WRAP_CLK, rounded up. */
+static uint16_t m_u16WrapGuard = 1u;
+/* The tick is 1us, the 32 bits microsecond counter is read directly. */
+static en_flag_status_t m_enTickIsUs = Reset;
+
+static stc_timebase_factor_t m_stcTickToUs;
+static stc_timebase_factor_t m_stcTickToNs;
+static stc_timebase_factor_t m_stcUsToTick;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TIMEBASE_Global_Functions TIMEBASE Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the timebase and start the TimerB units from 0.
+ * @note   1. The units are used by the timebase only.
+ *         2. The conversion factors are computed from SystemCoreClock(HCLK), call
+ *            this function again after the system clock is changed.
+ *         3. The timebase does not count in stop mode.
+ * @param  [in] pstcCfg                 Pointer to a @ref stc_timebase_cfg_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcCfg == NULL or the units are not a pair
+ */
+en_result_t TIMEBASE_Init(const stc_timebase_cfg_t *pstcCfg)
+{
+    stc_timerb_init_t stcTmrbInit;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcCfg) && IS_TIMEBASE_UNIT_PAIR(pstcCfg->TMRBLow, pstcCfg->TMRBHigh))
+    {
+        m_pstcTimebaseLow = pstcCfg->TMRBLow;
+        m_pstcTimebaseHigh = pstcCfg->TMRBHigh;
+        m_u32TickExt = 0ul;
+
+        m_u32TickFreq = SystemCoreClock >> ((uint32_t)pstcCfg->u16ClkDiv >> TMRB_BCSTR_CKDIV_POS);
+        m_u16WrapGuard = (uint16_t)((TIMEBASE_WRAP_CLK >> ((uint32_t)pstcCfg->u16ClkDiv >> TMRB_BCSTR_CKDIV_POS)) + 1ul);
+        m_enTickIsUs = (TIMEBASE_US_PER_S == m_u32TickFreq) ? Set : Reset;
+        TimebaseFactorInit(&m_stcTickToUs, TIMEBASE_US_PER_S, m_u32TickFreq);
+        TimebaseFactorInit(&m_stcTickToNs, TIMEBASE_NS_PER_S, m_u32TickFreq);
+        TimebaseFactorInit(&m_stcUsToTick, m_u32TickFreq, TIMEBASE_US_PER_S);
+
+        TIMERB_StructInit(&stcTmrbInit);
+        stcTmrbInit.u16PeriodVal = 0xFFFFu;
+        stcTmrbInit.u16ClkDiv = pstcCfg->u16ClkDiv;
+        (void)TIMERB_Init(m_pstcTimebaseLow, &stcTmrbInit);
+        stcTmrbInit.u16HwUpCondition = TIMERB_HWUP_OVERFLOW;
+        enRet = TIMERB_Init(m_pstcTimebaseHigh, &stcTmrbInit);
+        if (Ok == enRet)
+        {
+            TIMERB_ClearFlag(m_pstcTimebaseHigh, TIMERB_FLAG_OVF);
+            TIMERB_IntCmd(m_pstcTimebaseHigh, TIMERB_IT_OVF, Enable);
+
+            /* Register overflow IRQ handler && configure NVIC. */
+            stcIrqRegiConf.enIRQn = pstcCfg->enIRQn;
+            stcIrqRegiConf.enIntSrc = pstcCfg->enIntSrc;
+            stcIrqRegiConf.pfnCallback = &TimebaseOvfIrqCallback;
+            INTC_IrqRegistration(&stcIrqRegiConf);
+            NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+            NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+            NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+
+            /* The high unit is started first, it counts the overflow of the low unit. */
+            TIMERB_Start(m_pstcTimebaseHigh);
+            TIMERB_Start(m_pstcTimebaseLow);
+        }
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the tick frequency.
+ * @param  None
+ * @retval Ticks per second.
+ */
+uint32_t TIMEBASE_GetTickFreq(void)
+{
+    return m_u32TickFreq;
+}
+
+/**
+ * @brief  Get the 32 bits tick.
+ * @note   Safe in any context, no interrupt is disabled.
+ * @param  None
+ * @retval Ticks since TIMEBASE_Init(), wraps at 2^32.
+ */
+uint32_t TIMEBASE_GetTick32(void)
+{
+    return TimebaseRead32();
+}
+
+/**
+ * @brief  Get the 64 bits tick.
+ * @note   The interrupts are disabled for a few cycles, so that the 32 bits counter
+ *         and the extension belong together. An overflow whose interrupt is
+ *         not served yet is found by the overflow flag.
+ * @param  None
+ * @retval Ticks since TIMEBASE_Init().
+ */
+uint64_t TIMEBASE_GetTick64(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Low;
+    uint32_t u32High;
+
+    u32Primask = __get_PRIMASK();
+    __disable_irq();
+    u32Low = TimebaseRead32();
+    u32High = m_u32TickExt;
+    if ((Set == TIMERB_GetFlag(m_pstcTimebaseHigh, TIMERB_FLAG_OVF)) && (u32Low < 0x80000000ul))
+    {
+        u32High++;
+    }
+    __set_PRIMASK(u32Primask);
+
+    return (((uint64_t)u32High) << 32u) | (uint64_t)u32Low;
+}
+
+/**
+ * @brief  Get the 32 bits microsecond counter.
+ * @note   With a 1MHz tick it is the 32 bits tick, else it is converted from the
+ *         64 bits tick, so that it counts evenly through the wrap at 2^32.
+ * @param  None
+ * @retval Microseconds since TIMEBASE_Init(), wraps at 2^32.
+ */
+uint32_t TIMEBASE_GetUs32(void)
+{
+    uint32_t u32Us;
+
+    if (Set == m_enTickIsUs)
+    {
+        u32Us = TimebaseRead32();
+    }
+    else
+    {
+        u32Us = (uint32_t)TIMEBASE_GetUs64();
+    }
+
+    return u32Us;
+}
+
+/**
+ * @brief  Get the 64 bits microsecond counter.
+ * @param  None
+ * @retval Microseconds since TIMEBASE_Init().
+ */
+uint64_t TIMEBASE_GetUs64(void)
+{
+    uint64_t u64Tick;
+    uint64_t u64Us;
+
+    u64Tick = TIMEBASE_GetTick64();
+    if (Set == m_enTickIsUs)
+    {
+        u64Us = u64Tick;
+    }
+    else
+    {
+        /* (tick * mult) >> shift, the 96 bits product in two 64 bits parts. */
+        u64Us = ((uint64_t)(uint32_t)(u64Tick >> 32u) * m_stcTickToUs.u32Mult) << (32u - m_stcTickToUs.u32Shift);
+        u64Us += ((uint64_t)(uint32_t)u64Tick * m_stcTickToUs.u32Mult) >> m_stcTickToUs.u32Shift;
+    }
+
+    return u64Us;
+}
+
+/**
+ * @brief  Convert ticks to microseconds by multiply and shift.
+ * @param  [in] u32Tick                 Ticks, e.g. the difference of two TIMEBASE_GetTick32().
+ * @retval Microseconds, rounded down. Bits above 32 are lost.
+ */
+uint32_t TIMEBASE_TickToUs(uint32_t u32Tick)
+{
+    return TimebaseMulShift(u32Tick, &m_stcTickToUs);
+}
+
+/**
+ * @brief  Convert ticks to nanoseconds by multiply and shift.
+ * @param  [in] u32Tick                 Ticks, e.g. the difference of two TIMEBASE_GetTick32().
+ * @retval Nanoseconds, rounded down. Bits above 32 are lost, the tick difference
+ *         is up to 4.29s.
+ */
+uint32_t TIMEBASE_TickToNs(uint32_t u32Tick)
+{
+    return TimebaseMulShift(u32Tick, &m_stcTickToNs);
+}
+
+/**
+ * @brief  Convert microseconds to ticks by multiply and shift.
+ * @param  [in] u32Us                   Microseconds.
+ * @retval Ticks, rounded down. Bits above 32 are lost.
+ */
+uint32_t TIMEBASE_UsToTick(uint32_t u32Us)
+{
+    return TimebaseMulShift(u32Us, &m_stcUsToTick);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TIMEBASE_Local_Functions TIMEBASE Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Compute the multiply and shift factor of u32Num / u32Den.
+ * @note   The shift is the largest one, up to 32, that keeps the rounded
+ *         multiplier in 32 bits. The relative error is below 1 / multiplier,
+ *         e.g. 1.2E-8 for 1us / 48MHz tick. Only called by TIMEBASE_Init().
+ * @param  [out] pstcFactor             Pointer to the factor.
+ * @param  [in] u32Num                  Numerator.
+ * @param  [in] u32Den                  Denominator, not 0.
+ * @retval None
+ */
+static void TimebaseFactorInit(stc_timebase_factor_t *pstcFactor,
+                               uint32_t u32Num, uint32_t u32Den)
+{
+    uint32_t u32Shift = 32ul;
+    uint64_t u64Mult = 0ull;
+
+    if (0ul != u32Den)
+    {
+        for (;;)
+        {
+            u64Mult = ((((uint64_t)u32Num) << u32Shift) + (u32Den / 2ul)) / u32Den;
+            if ((u64Mult <= 0xFFFFFFFFull) || (0ul == u32Shift))
+            {
+                break;
+            }
+            u32Shift--;
+        }
+    }
+
+    pstcFactor->u32Mult = (uint32_t)u64Mult;
+    pstcFactor->u32Shift = u32Shift;
+}
+
+/**
+ * @brief  Multiply and shift.
+ * @param  [in] u32Val                  Input value.
+ * @param  [in] pstcFactor              Pointer to the factor.
+ * @retval Low 32 bits of (u32Val * mult) >> shift.
+ */
+static uint32_t TimebaseMulShift(uint32_t u32Val, const stc_timebase_factor_t *pstcFactor)
+{
+    return (uint32_t)(((uint64_t)u32Val * pstcFactor->u32Mult) >> pstcFactor->u32Shift);
+}
+
+/**
+ * @brief  Read the 32 bits counter of the cascaded units.
+ * @note   High, low, high. A change of the high half, or a low half which has
+ *         just wrapped, means the halves may not belong together: read again.
+ * @param  None
+ * @retval 32 bits tick.
+ */
+static uint32_t TimebaseRead32(void)
+{
+    uint16_t u16High1;
+    uint16_t u16High2;
+    uint16_t u16Low;
+
+    do
+    {
+        u16High1 = TIMERB_GetCounter(m_pstcTimebaseHigh);
+        u16Low = TIMERB_GetCounter(m_pstcTimebaseLow);
+        u16High2 = TIMERB_GetCounter(m_pstcTimebaseHigh);
+    } while ((u16High1 != u16High2) || (u16Low < m_u16WrapGuard));
+
+    return (((uint32_t)u16High1) << 16u) | (uint32_t)u16Low;
+}
+
+/**
+ * @brief  Overflow IRQ callback of the high unit, extends the tick to 64 bits.
+ * @param  None
+ * @retval None
+ */
+static void TimebaseOvfIrqCallback(void)
+{
+    TIMERB_ClearFlag(m_pstcTimebaseHigh, TIMERB_FLAG_OVF);
+    m_u32TickExt++;
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_TIMEBASE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
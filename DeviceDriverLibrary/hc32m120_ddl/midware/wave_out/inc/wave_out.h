@@ -0,0 +1,235 @@
+/**
+ *******************************************************************************
+ * @file  wave_out.h
+ * @brief This file contains all the functions prototypes of the DMA waveform
+ *        output midware library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Zhangxl         First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+#ifndef __WAVE_OUT_H__
+#define __WAVE_OUT_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ddl.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @addtogroup MW_WAVE_OUT
+ * @{
+ */
+
+#if (MW_WAVE_OUT_ENABLE == DDL_ON)
+
+#if (DDL_CLK_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_CLK_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_DMA_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_DMA_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+#if (DDL_INTERRUPTS_ENABLE == DDL_OFF)
+#error "please configure macro definition DDL_INTERRUPTS_ENABLE to DDL_ON in ddl_config.h"
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup WAVE_OUT_Global_Types WAVE_OUT Global Types
+ * @{
+ */
+
+/**
+ * @brief Segment complete callback, u8Seg is the index of the segment whose
+ *        last value has been written.
+ */
+typedef void (*func_ptr_wave_out_t)(uint8_t u8Seg);
+
+/**
+ * @brief Waveform segment structure definition
+ */
+typedef struct
+{
+    const void *pvData;                 /*!< Values of the segment, uint16_t or uint32_t as u32DataWidth. */
+    uint16_t u16Len;                    /*!< Number of values, 1 ~ WAVE_OUT_SEG_LEN_MAX. */
+} stc_wave_out_seg_t;
+
+/**
+ * @brief Waveform output handle structure definition
+ * @note  1. Each trigger event writes the next value of the segments into the
+ *           destination register, the segments are chained by the LLP descriptors
+ *           in pstcDesc. The timer, its output pin and the clock of the timer are
+ *           configured by the application, and the register holds the first value
+ *           of the waveform before the timer is started.
+ *        2. WAVE_OUT_MODE_ONESHOT: the segments are output once, the register keeps
+ *           the last value after the end. WAVE_OUT_MODE_CIRCULAR: the last segment
+ *           links back to the first one until WAVE_OUT_Stop(). A segment can be
+ *           refilled in pfnSegCpl when it is not the next one to be output, that is
+ *           with two segments or more.
+ *        3. Compare and period values are output together by two handles on the
+ *           two DMA channels with the same trigger event, started while the timer
+ *           is stopped.
+ */
+typedef struct
+{
+    uint32_t u32DestAddr;               /*!< Destination register.
+                                             This parameter can be a value of @ref WAVE_OUT_Dest */
+    en_event_src_t enTrigEvt;           /*!< Trigger event, EVT_TMRA_OVF, EVT_TMRB_x_OVF, EVT_TMR2_GCMP etc. */
+    uint32_t u32DataWidth;              /*!< DMA_DATAWIDTH_16BIT, or DMA_DATAWIDTH_32BIT for Timer2/Timer0. */
+    uint8_t  u8Mode;                    /*!< Output mode.
+                                             This parameter can be a value of @ref WAVE_OUT_Mode */
+    uint8_t  u8DmaCh;                   /*!< DMA channel, DMA_CHANNEL_0 or DMA_CHANNEL_1. */
+    IRQn_Type enDmaIRQn;                /*!< IRQ number of the DMA transfer complete interrupt. */
+    const stc_wave_out_seg_t *pstcSeg;  /*!< Segments of the waveform. */
+    uint8_t  u8SegNum;                  /*!< Number of segments, 1 ~ 255. */
+    stc_dma_llp_descriptor_t *pstcDesc; /*!< u8SegNum descriptors in SRAM, filled by WAVE_OUT_Init(). */
+    func_ptr_wave_out_t pfnSegCpl;      /*!< Called in the DMA interrupt after each segment, NULL: none. */
+    func_ptr_t pfnDone;                 /*!< Called at the end of a one-shot output, NULL: none. */
+
+    /* Internal state, set by WAVE_OUT_Init() */
+    __IO uint8_t u8Seg;                 /*!< Segment being output. */
+    __IO uint8_t u8Busy;                /*!< The output is running. */
+} stc_wave_out_handle_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup WAVE_OUT_Global_Macros WAVE_OUT Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup WAVE_OUT_Mode WAVE_OUT Mode
+ * @{
+ */
+#define WAVE_OUT_MODE_ONESHOT           ((uint8_t)0u)   /*!< The segments are output once. */
+#define WAVE_OUT_MODE_CIRCULAR          ((uint8_t)1u)   /*!< The segments are output repeatedly. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup WAVE_OUT_Dest WAVE_OUT Destination Register
+ * @note     WAVE_OUT_DEST_TMR2_CMP and WAVE_OUT_DEST_TMR0_CMP only with a synchronous
+ *           count clock. A write to the timer in asynchronous mode, e.g. on LRC, must
+ *           wait 3 cycles of its clock for the synchronization, which DMA does not.
+ * @{
+ */
+#define WAVE_OUT_DEST_TMRA_PERIOD       ((uint32_t)(&M0P_TMRA->PERAR))
+#define WAVE_OUT_DEST_TMRA_CMP1         ((uint32_t)(&M0P_TMRA->CMPAR1))
+#define WAVE_OUT_DEST_TMRA_CMP2         ((uint32_t)(&M0P_TMRA->CMPAR2))
+#define WAVE_OUT_DEST_TMRB_PERIOD(TMRBx)    ((uint32_t)(&(TMRBx)->PERAR))
+#define WAVE_OUT_DEST_TMRB_CMP(TMRBx)       ((uint32_t)(&(TMRBx)->CMPAR))
+#define WAVE_OUT_DEST_TMR2_CMP          ((uint32_t)(&M0P_TMR2->CMPAR))
+#define WAVE_OUT_DEST_TMR0_CMP          ((uint32_t)(&M0P_TMR0->CMPAR))
+/**
+ * @}
+ */
+
+/* Transfer count field of the DMA channel. */
+#define WAVE_OUT_SEG_LEN_MAX            (1023u)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup WAVE_OUT_Global_Functions
+ * @{
+ */
+en_result_t WAVE_OUT_Init(stc_wave_out_handle_t *pstcHandle);
+en_result_t WAVE_OUT_Start(stc_wave_out_handle_t *pstcHandle);
+en_result_t WAVE_OUT_Stop(stc_wave_out_handle_t *pstcHandle);
+en_flag_status_t WAVE_OUT_IsBusy(const stc_wave_out_handle_t *pstcHandle);
+/**
+ * @}
+ */
+
+#endif /* MW_WAVE_OUT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __WAVE_OUT_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,430 @@
+/**
+ *******************************************************************************
+ * @file  wave_out.c
+ * @brief This midware file provides firmware functions to output arbitrary
+ *        waveforms and pulse trains by streaming values into the compare or
+ *        period registers of the timers with DMA.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-19       Zhangxl         First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2016, Huada Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software is owned and published by:
+ * Huada Semiconductor Co., Ltd. ("HDSC").
+ *
+ * BY DOWNLOADING, INSTALLING OR USING THIS SOFTWARE, YOU AGREE TO BE BOUND
+ * BY ALL THE TERMS AND CONDITIONS OF THIS AGREEMENT.
+ *
+ * This software contains source code for use with HDSC
+ * components. This software is licensed by HDSC to be adapted only
+ * for use in systems utilizing HDSC components. HDSC shall not be
+ * responsible for misuse or illegal use of this software for devices not
+ * supported herein. HDSC is providing this software "AS IS" and will
+ * not be responsible for issues arising from incorrect user implementation
+ * of the software.
+ *
+ * Disclaimer:
+ * HDSC MAKES NO WARRANTY, EXPRESS OR IMPLIED, ARISING BY LAW OR OTHERWISE,
+ * REGARDING THE SOFTWARE (INCLUDING ANY ACCOMPANYING WRITTEN MATERIALS),
+ * ITS PERFORMANCE OR SUITABILITY FOR YOUR INTENDED USE, INCLUDING,
+ * WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, THE IMPLIED
+ * WARRANTY OF FITNESS FOR A PARTICULAR PURPOSE OR USE, AND THE IMPLIED
+ * WARRANTY OF NONINFRINGEMENT.
+ * HDSC SHALL HAVE NO LIABILITY (WHETHER IN CONTRACT, WARRANTY, TORT,
+ * NEGLIGENCE OR OTHERWISE) FOR ANY DAMAGES WHATSOEVER (INCLUDING, WITHOUT
+ * LIMITATION, DAMAGES FOR LOSS OF BUSINESS PROFITS, BUSINESS INTERRUPTION,
+ * LOSS OF BUSINESS INFORMATION, OR OTHER PECUNIARY LOSS) ARISING FROM USE OR
+ * INABILITY TO USE THE SOFTWARE, INCLUDING, WITHOUT LIMITATION, ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL OR CONSEQUENTIAL DAMAGES OR LOSS OF DATA,
+ * SAVINGS OR PROFITS,
+ * EVEN IF Disclaimer HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+ * YOU ASSUME ALL RESPONSIBILITIES FOR SELECTION OF THE SOFTWARE TO ACHIEVE YOUR
+ * INTENDED RESULTS, AND FOR THE INSTALLATION OF, USE OF, AND RESULTS OBTAINED
+ * FROM, THE SOFTWARE.
+ *
+ * This software may be replicated in part or whole for the licensed use,
+ * with the restriction that this Disclaimer and Copyright notice must be
+ * included with each copy of this software, whether used in part or whole,
+ * at all times.
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "wave_out.h"
+
+/**
+ * @addtogroup HC32M120_DDL_Midware
+ * @{
+ */
+
+/**
+ * @defgroup MW_WAVE_OUT WAVE_OUT
+ * @brief DMA Waveform Output Midware Library
+ * @{
+ */
+
+#if (MW_WAVE_OUT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup WAVE_OUT_Local_Macros WAVE_OUT Local Macros
+ * @{
+ */
+
+/* LLP field of CHxCTL0 holds bit[11:2] of the descriptor address. */
+#define WAVE_OUT_LLP_FIELD(addr)        (((addr) & 0x00000FFCul) << (DMA_CH0CTL0_LLP_POS - 2ul))
+
+#define IS_WAVE_OUT_DMA_CH(x)                                                  \
+(   ((x) == DMA_CHANNEL_0)                      ||                             \
+    ((x) == DMA_CHANNEL_1))
+
+#define IS_WAVE_OUT_MODE(x)                                                    \
+(   ((x) == WAVE_OUT_MODE_ONESHOT)              ||                             \
+    ((x) == WAVE_OUT_MODE_CIRCULAR))
+
+#define IS_WAVE_OUT_DATA_WIDTH(x)                                              \
+(   ((x) == DMA_DATAWIDTH_16BIT)                ||                             \
+    ((x) == DMA_DATAWIDTH_32BIT))
+
+/* Timer2 and Timer0 in asynchronous mode can not be written by DMA. */
+#define IS_WAVE_OUT_SYNC_DEST(addr)                                            \
+(   (((addr) != WAVE_OUT_DEST_TMR2_CMP)         ||                             \
+     (0ul == READ_REG32_BIT(M0P_TMR2->BCONR, TMR2_BCONR_SYNSA)))        &&     \
+    (((addr) != WAVE_OUT_DEST_TMR0_CMP)         ||                             \
+     (0ul == READ_REG32_BIT(M0P_TMR0->BCONR, TMR0_BCONR_SYNSA))))
+
+#define IS_WAVE_OUT_SEG(s)                                                     \
+(   (NULL != (s)->pvData)                       &&                             \
+    ((s)->u16Len >= 1u)                         &&                             \
+    ((s)->u16Len <= WAVE_OUT_SEG_LEN_MAX))
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+static void WaveOutDmaLoad(const stc_wave_out_handle_t *pstcHandle);
+static void WaveOutDmaTcHandler(uint8_t u8DmaCh);
+static void WaveOutDma0TcIrqCallback(void);
+static void WaveOutDma1TcIrqCallback(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_wave_out_handle_t *m_apstcWaveOutHandle[2u];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup WAVE_OUT_Global_Functions WAVE_OUT Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the waveform output, build the descriptor chain of the
+ *         segments and register the DMA interrupt.
+ * @note   The descriptors and the segment values are read by DMA while the output
+ *         runs, so they must be kept valid until the output is stopped or done, and
+ *         the descriptors must be located in SRAM.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_wave_out_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Initialize success
+ *           - ErrorInvalidParameter: pstcHandle == NULL, the mode, the data width,
+ *                                    the DMA channel or a segment is invalid
+ *           - ErrorNotReady: the DMA channel is busy with another output
+ */
+en_result_t WAVE_OUT_Init(stc_wave_out_handle_t *pstcHandle)
+{
+    uint32_t i;
+    uint32_t u32Next;
+    uint32_t u32Ctl0;
+    const stc_wave_out_handle_t *pstcOld;
+    stc_irq_regi_config_t stcIrqRegiConf;
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && IS_WAVE_OUT_MODE(pstcHandle->u8Mode) &&
+        IS_WAVE_OUT_DATA_WIDTH(pstcHandle->u32DataWidth) &&
+        IS_WAVE_OUT_DMA_CH(pstcHandle->u8DmaCh) && (NULL != pstcHandle->pstcSeg) &&
+        (NULL != pstcHandle->pstcDesc) && (0u != pstcHandle->u8SegNum))
+    {
+        enRet = Ok;
+        for (i = 0ul; i < (uint32_t)pstcHandle->u8SegNum; i++)
+        {
+            if (!IS_WAVE_OUT_SEG(&pstcHandle->pstcSeg[i]))
+            {
+                enRet = ErrorInvalidParameter;
+            }
+        }
+
+        pstcOld = m_apstcWaveOutHandle[pstcHandle->u8DmaCh];
+        if ((Ok == enRet) && (NULL != pstcOld) && (pstcOld != pstcHandle) && (0u != pstcOld->u8Busy))
+        {
+            enRet = ErrorNotReady;
+        }
+    }
+
+    if (Ok == enRet)
+    {
+        pstcHandle->u8Seg  = 0u;
+        pstcHandle->u8Busy = 0u;
+
+        /* Descriptor i outputs segment i, the source address keeps increasing and the
+           destination is the timer register. The last descriptor links back to the
+           first one in circular mode and ends the chain in one-shot mode. */
+        for (i = 0ul; i < (uint32_t)pstcHandle->u8SegNum; i++)
+        {
+            u32Next = (i + 1ul) % (uint32_t)pstcHandle->u8SegNum;
+            u32Ctl0 = 1ul | ((uint32_t)pstcHandle->pstcSeg[i].u16Len << DMA_CH0CTL0_CNT_POS) |
+                      pstcHandle->u32DataWidth;
+            if ((0ul != u32Next) || (WAVE_OUT_MODE_CIRCULAR == pstcHandle->u8Mode))
+            {
+                u32Ctl0 |= DMA_LLP_ENABLE | DMA_LLP_WAIT |
+                           WAVE_OUT_LLP_FIELD((uint32_t)(&pstcHandle->pstcDesc[u32Next]));
+            }
+            pstcHandle->pstcDesc[i].SARx    = (uint32_t)pstcHandle->pstcSeg[i].pvData;
+            pstcHandle->pstcDesc[i].DARx    = pstcHandle->u32DestAddr;
+            pstcHandle->pstcDesc[i].CHxCTL0 = u32Ctl0;
+            pstcHandle->pstcDesc[i].CHxCTL1 = DMA_SRCADDRINC_INC | DMA_DESADDRINC_FIX;
+        }
+
+        /* Enable peripheral clock */
+        CLK_FcgPeriphClockCmd(CLK_FCG_DMA | CLK_FCG_AOS, Enable);
+
+        m_apstcWaveOutHandle[pstcHandle->u8DmaCh] = pstcHandle;
+
+        /* Register DMA transfer complete IRQ handler && configure NVIC. */
+        stcIrqRegiConf.enIRQn = pstcHandle->enDmaIRQn;
+        if (DMA_CHANNEL_0 == pstcHandle->u8DmaCh)
+        {
+            stcIrqRegiConf.enIntSrc = INT_DAM_1_TC0;
+            stcIrqRegiConf.pfnCallback = &WaveOutDma0TcIrqCallback;
+        }
+        else
+        {
+            stcIrqRegiConf.enIntSrc = INT_DAM_2_TC0;
+            stcIrqRegiConf.pfnCallback = &WaveOutDma1TcIrqCallback;
+        }
+        INTC_IrqRegistration(&stcIrqRegiConf);
+        NVIC_ClearPendingIRQ(stcIrqRegiConf.enIRQn);
+        NVIC_SetPriority(stcIrqRegiConf.enIRQn, DDL_IRQ_PRIORITY_03);
+        NVIC_EnableIRQ(stcIrqRegiConf.enIRQn);
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Start the output from the first value of the first segment, each trigger
+ *         event from now on writes one value.
+ * @note   Timer2 or Timer0 as the destination must count a synchronous clock.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_wave_out_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Start success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or not initialized
+ */
+en_result_t WAVE_OUT_Start(stc_wave_out_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && IS_WAVE_OUT_DMA_CH(pstcHandle->u8DmaCh) &&
+        (pstcHandle == m_apstcWaveOutHandle[pstcHandle->u8DmaCh]))
+    {
+        DDL_ASSERT(IS_WAVE_OUT_SYNC_DEST(pstcHandle->u32DestAddr));
+
+        pstcHandle->u8Seg  = 0u;
+        pstcHandle->u8Busy = 1u;
+
+        WaveOutDmaLoad(pstcHandle);
+        DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+        DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Enable);
+        DMA_SetTriggerSrc(pstcHandle->u8DmaCh, pstcHandle->enTrigEvt);
+        DMA_ChannelEnable(pstcHandle->u8DmaCh);
+        DMA_Cmd(Enable);
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Stop the output, the register keeps the value written last.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_wave_out_handle_t structure
+ * @retval An en_result_t enumeration value:
+ *           - Ok: Stop success
+ *           - ErrorInvalidParameter: pstcHandle == NULL or not initialized
+ */
+en_result_t WAVE_OUT_Stop(stc_wave_out_handle_t *pstcHandle)
+{
+    en_result_t enRet = ErrorInvalidParameter;
+
+    if ((NULL != pstcHandle) && IS_WAVE_OUT_DMA_CH(pstcHandle->u8DmaCh) &&
+        (pstcHandle == m_apstcWaveOutHandle[pstcHandle->u8DmaCh]))
+    {
+        DMA_ChannelDisable(pstcHandle->u8DmaCh);
+        DMA_CplIrqCmd(pstcHandle->u8DmaCh, DMA_IRQ_TC, Disable);
+        DMA_ClearCplFlag(pstcHandle->u8DmaCh, DMA_FLAG_TC | DMA_FLAG_BTC);
+        pstcHandle->u8Busy = 0u;
+        enRet = Ok;
+    }
+
+    return enRet;
+}
+
+/**
+ * @brief  Get the state of the output.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_wave_out_handle_t structure
+ * @retval An en_flag_status_t enumeration value:
+ *           - Set: The output is running
+ *           - Reset: The output is stopped or a one-shot output is done
+ */
+en_flag_status_t WAVE_OUT_IsBusy(const stc_wave_out_handle_t *pstcHandle)
+{
+    en_flag_status_t enRet = Reset;
+
+    if ((NULL != pstcHandle) && (0u != pstcHandle->u8Busy))
+    {
+        enRet = Set;
+    }
+
+    return enRet;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup WAVE_OUT_Local_Functions WAVE_OUT Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Load the descriptor of the first segment into the DMA channel.
+ * @param  [in] pstcHandle              Pointer to a @ref stc_wave_out_handle_t structure
+ * @retval None
+ */
+static void WaveOutDmaLoad(const stc_wave_out_handle_t *pstcHandle)
+{
+    stc_dma_ch_cfg_t stcDmaCfg;
+    const stc_dma_llp_descriptor_t *pstcDesc = &pstcHandle->pstcDesc[0u];
+
+    DMA_ChannelDisable(pstcHandle->u8DmaCh);
+
+    stcDmaCfg.u32DataWidth   = pstcHandle->u32DataWidth;
+    stcDmaCfg.u32BlockSize   = 1ul;
+    stcDmaCfg.u32TransferCnt = (uint32_t)pstcHandle->pstcSeg[0u].u16Len;
+    stcDmaCfg.u32SrcAddr     = pstcDesc->SARx;
+    stcDmaCfg.u32DesAddr     = pstcDesc->DARx;
+    stcDmaCfg.u32SrcInc      = DMA_SRCADDRINC_INC;
+    stcDmaCfg.u32DesInc      = DMA_DESADDRINC_FIX;
+    DMA_ChannelCfg(pstcHandle->u8DmaCh, &stcDmaCfg);
+
+    if (0ul != (pstcDesc->CHxCTL0 & DMA_LLP_ENABLE))
+    {
+        DMA_LlpInit(pstcHandle->u8DmaCh, DMA_LLP_WAIT,
+                    (uint32_t)(&pstcHandle->pstcDesc[1u % (uint32_t)pstcHandle->u8SegNum]));
+    }
+    else
+    {
+        DMA_LlpCmd(pstcHandle->u8DmaCh, Disable);
+    }
+}
+
+/**
+ * @brief  DMA transfer complete IRQ handler, the last value of a segment has been
+ *         written and the channel goes on with the next descriptor.
+ * @param  [in] u8DmaCh                 DMA channel.
+ * @retval None
+ */
+static void WaveOutDmaTcHandler(uint8_t u8DmaCh)
+{
+    uint8_t u8Seg;
+    stc_wave_out_handle_t *pstcHandle = m_apstcWaveOutHandle[u8DmaCh];
+
+    DMA_ClearCplFlag(u8DmaCh, DMA_FLAG_TC);
+
+    if ((NULL != pstcHandle) && (0u != pstcHandle->u8Busy))
+    {
+        u8Seg = pstcHandle->u8Seg;
+        if ((u8Seg + 1u) < pstcHandle->u8SegNum)
+        {
+            pstcHandle->u8Seg = u8Seg + 1u;
+        }
+        else
+        {
+            pstcHandle->u8Seg = 0u;
+        }
+
+        if (NULL != pstcHandle->pfnSegCpl)
+        {
+            pstcHandle->pfnSegCpl(u8Seg);
+        }
+
+        /* The chain ends with the last segment of a one-shot output. */
+        if ((WAVE_OUT_MODE_ONESHOT == pstcHandle->u8Mode) && (0u == pstcHandle->u8Seg))
+        {
+            DMA_CplIrqCmd(u8DmaCh, DMA_IRQ_TC, Disable);
+            pstcHandle->u8Busy = 0u;
+            if (NULL != pstcHandle->pfnDone)
+            {
+                pstcHandle->pfnDone();
+            }
+        }
+    }
+}
+
+/**
+ * @brief  DMA channel 0 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void WaveOutDma0TcIrqCallback(void)
+{
+    WaveOutDmaTcHandler(DMA_CHANNEL_0);
+}
+
+/**
+ * @brief  DMA channel 1 transfer complete IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void WaveOutDma1TcIrqCallback(void)
+{
+    WaveOutDmaTcHandler(DMA_CHANNEL_1);
+}
+
+/**
+ * @}
+ */
+
+#endif /* MW_WAVE_OUT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/